@@ -177,24 +177,30 @@ group ""
 -- Tests
 -- ========================
 include "test/Catch2Common.lua"
+include "test/ImageConverterTests.lua"
 include "test/ObjCommonTestUtils.lua"
 include "test/ObjCommonTests.lua"
 include "test/ObjCompilingTests.lua"
 include "test/ObjLoadingTests.lua"
 include "test/ParserTestUtils.lua"
 include "test/ParserTests.lua"
+include "test/RawTemplaterTests.lua"
 include "test/ZoneCodeGeneratorLibTests.lua"
 include "test/ZoneCommonTests.lua"
+include "test/ZoneLoadingTests.lua"
 
 -- Tests group: Unit test and other tests projects
 group "Tests"
     Catch2Common:project()
+    ImageConverterTests:project()
     ObjCommonTestUtils:project()
     ObjCommonTests:project()
     ObjCompilingTests:project()
     ObjLoadingTests:project()
     ParserTestUtils:project()
     ParserTests:project()
+    RawTemplaterTests:project()
     ZoneCodeGeneratorLibTests:project()
     ZoneCommonTests:project()
+    ZoneLoadingTests:project()
 group ""
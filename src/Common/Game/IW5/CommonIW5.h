@@ -2,6 +2,8 @@
 
 #include "IW5.h"
 
+#include <span>
+
 namespace IW5
 {
     class Common
@@ -26,6 +28,7 @@ namespace IW5
 
         static PackedTexCoords Vec2PackTexCoords(const float (&in)[2]);
         static PackedUnitVec Vec3PackUnitVec(const float (&in)[3]);
+        static void Vec3PackUnitVecs(std::span<const float> in, std::span<PackedUnitVec> out);
         static GfxColor Vec4PackGfxColor(const float (&in)[4]);
         static void Vec2UnpackTexCoords(const PackedTexCoords& in, float (&out)[2]);
         static void Vec3UnpackUnitVec(const PackedUnitVec& in, float (&out)[3]);
@@ -2,7 +2,9 @@
 
 #include "Utils/Pack.h"
 
+#include <algorithm>
 #include <cctype>
+#include <vector>
 
 using namespace T5;
 
@@ -68,6 +70,18 @@ PackedUnitVec Common::Vec3PackUnitVec(const float (&in)[3])
     return PackedUnitVec{pack32::Vec3PackUnitVecScaleBased(in)};
 }
 
+void Common::Vec3PackUnitVecs(const std::span<const float> in, const std::span<PackedUnitVec> out)
+{
+    std::vector<uint32_t> packed(out.size());
+    pack32::Vec3PackUnitVecScaleBased(in, packed);
+    std::ranges::transform(packed,
+                           out.begin(),
+                           [](const uint32_t value)
+                           {
+                               return PackedUnitVec{value};
+                           });
+}
+
 GfxColor Common::Vec4PackGfxColor(const float (&in)[4])
 {
     return GfxColor{pack32::Vec4PackGfxColor(in)};
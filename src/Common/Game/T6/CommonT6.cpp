@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 using namespace T6;
 
@@ -17,6 +18,18 @@ PackedUnitVec Common::Vec3PackUnitVec(const float (&in)[3])
     return PackedUnitVec{pack32::Vec3PackUnitVecThirdBased(in)};
 }
 
+void Common::Vec3PackUnitVecs(const std::span<const float> in, const std::span<PackedUnitVec> out)
+{
+    std::vector<uint32_t> packed(out.size());
+    pack32::Vec3PackUnitVecThirdBased(in, packed);
+    std::ranges::transform(packed,
+                           out.begin(),
+                           [](const uint32_t value)
+                           {
+                               return PackedUnitVec{value};
+                           });
+}
+
 GfxColor Common::Vec4PackGfxColor(const float (&in)[4])
 {
     return GfxColor{pack32::Vec4PackGfxColor(in)};
@@ -0,0 +1,58 @@
+#include "CpuFeatures.h"
+
+#include <atomic>
+
+#if defined(ARCH_x86) || defined(ARCH_x64)
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#endif
+
+namespace
+{
+    std::atomic_bool avx2Disabled = false;
+
+    bool DetectAvx2()
+    {
+#if defined(ARCH_x86) || defined(ARCH_x64)
+#if defined(_MSC_VER)
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 0);
+        if (cpuInfo[0] < 7)
+            return false;
+
+        // The os must save the ymm registers on context switches
+        __cpuid(cpuInfo, 1);
+        constexpr auto osXSaveBit = 1 << 27;
+        constexpr auto avxBit = 1 << 28;
+        if ((cpuInfo[2] & osXSaveBit) == 0 || (cpuInfo[2] & avxBit) == 0)
+            return false;
+
+        constexpr auto xmmYmmStateMask = 0x6u;
+        if ((_xgetbv(0) & xmmYmmStateMask) != xmmYmmStateMask)
+            return false;
+
+        __cpuidex(cpuInfo, 7, 0);
+        constexpr auto avx2Bit = 1 << 5;
+        return (cpuInfo[1] & avx2Bit) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+#else
+        return false;
+#endif
+    }
+} // namespace
+
+bool CpuFeatures::HasAvx2()
+{
+    static const bool hasAvx2 = DetectAvx2();
+    return hasAvx2 && !avx2Disabled;
+}
+
+void CpuFeatures::SetAvx2Disabled(const bool disabled)
+{
+    avx2Disabled = disabled;
+}
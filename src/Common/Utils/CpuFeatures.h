@@ -0,0 +1,18 @@
+#pragma once
+
+class CpuFeatures
+{
+    CpuFeatures() = default;
+
+public:
+    /**
+     * \brief Whether the executing cpu and operating system support AVX2 instructions.
+     */
+    static bool HasAvx2();
+
+    /**
+     * \brief Makes \c HasAvx2 report no support regardless of the executing cpu.
+     * Allows tests to run the SSE2 code paths on cpus that support AVX2.
+     */
+    static void SetAvx2Disabled(bool disabled);
+};
@@ -1,5 +1,9 @@
 #include "HalfFloat.h"
 
+#include "PackSimd.h"
+
+#include <cassert>
+
 float HalfFloat::ToFloat(const half_float_t half)
 {
     if (half)
@@ -42,3 +46,19 @@ half_float_t HalfFloat::ToHalf(const float f)
 
     return (v3 & 0x3FFFu) | ((result.u >> 16) & 0xC000u);
 }
+
+void HalfFloat::ToFloat(const std::span<const half_float_t> halfs, const std::span<float> floats)
+{
+    assert(halfs.size() == floats.size());
+
+    for (auto i = pack_simd::HalfToFloat(halfs.data(), floats.data(), halfs.size()); i < halfs.size(); i++)
+        floats[i] = ToFloat(halfs[i]);
+}
+
+void HalfFloat::ToHalf(const std::span<const float> floats, const std::span<half_float_t> halfs)
+{
+    assert(floats.size() == halfs.size());
+
+    for (auto i = pack_simd::FloatToHalf(floats.data(), halfs.data(), floats.size()); i < floats.size(); i++)
+        halfs[i] = ToHalf(floats[i]);
+}
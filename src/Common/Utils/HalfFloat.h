@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
 typedef uint16_t half_float_t;
 
@@ -11,4 +12,10 @@ class HalfFloat
 public:
     static float ToFloat(half_float_t half);
     static half_float_t ToHalf(float f);
+
+    /**
+     * \brief Converts all values at once using vector instructions when available. The results match the single value conversions.
+     */
+    static void ToFloat(std::span<const half_float_t> halfs, std::span<float> floats);
+    static void ToHalf(std::span<const float> floats, std::span<half_float_t> halfs);
 };
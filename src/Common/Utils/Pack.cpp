@@ -1,8 +1,10 @@
 #include "Pack.h"
 
 #include "HalfFloat.h"
+#include "PackSimd.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <limits>
@@ -158,4 +160,126 @@ namespace pack32
         out[3] = static_cast<float>((in >> 24) & std::numeric_limits<uint8_t>::max()) / 255.0f;
     }
 
+    constexpr size_t TEX_COORD_CHUNK_SIZE = 256u;
+
+    void Vec2PackTexCoords(const std::span<const float> in, const std::span<uint32_t> out, const bool vFirst)
+    {
+        assert(in.size() == out.size() * 2u);
+
+        std::array<half_float_t, TEX_COORD_CHUNK_SIZE * 2u> halfs;
+        for (size_t offset = 0u; offset < out.size(); offset += TEX_COORD_CHUNK_SIZE)
+        {
+            const auto chunkCount = std::min(TEX_COORD_CHUNK_SIZE, out.size() - offset);
+            HalfFloat::ToHalf(in.subspan(offset * 2u, chunkCount * 2u), std::span(halfs).first(chunkCount * 2u));
+
+            for (auto i = 0u; i < chunkCount; i++)
+            {
+                const auto u = halfs[i * 2u + 0u];
+                const auto v = halfs[i * 2u + 1u];
+                out[offset + i] = vFirst ? static_cast<uint32_t>(u) << 16 | v : static_cast<uint32_t>(v) << 16 | u;
+            }
+        }
+    }
+
+    void Vec2UnpackTexCoords(const std::span<const uint32_t> in, const std::span<float> out, const bool vFirst)
+    {
+        assert(out.size() == in.size() * 2u);
+
+        std::array<half_float_t, TEX_COORD_CHUNK_SIZE * 2u> halfs;
+        for (size_t offset = 0u; offset < in.size(); offset += TEX_COORD_CHUNK_SIZE)
+        {
+            const auto chunkCount = std::min(TEX_COORD_CHUNK_SIZE, in.size() - offset);
+            for (auto i = 0u; i < chunkCount; i++)
+            {
+                const auto hi = static_cast<half_float_t>((in[offset + i] >> 16) & std::numeric_limits<uint16_t>::max());
+                const auto lo = static_cast<half_float_t>(in[offset + i] & std::numeric_limits<uint16_t>::max());
+                halfs[i * 2u + 0u] = vFirst ? hi : lo;
+                halfs[i * 2u + 1u] = vFirst ? lo : hi;
+            }
+
+            HalfFloat::ToFloat(std::span(halfs).first(chunkCount * 2u), out.subspan(offset * 2u, chunkCount * 2u));
+        }
+    }
+
+    template<size_t ComponentCount>
+    void PackBatch(const std::span<const float> in,
+                   const std::span<uint32_t> out,
+                   size_t (*packSimd)(const float*, uint32_t*, size_t),
+                   uint32_t (*pack)(const float (&)[ComponentCount]))
+    {
+        assert(in.size() == out.size() * ComponentCount);
+
+        for (auto i = packSimd(in.data(), out.data(), out.size()); i < out.size(); i++)
+        {
+            float value[ComponentCount];
+            std::copy_n(&in[i * ComponentCount], ComponentCount, value);
+            out[i] = pack(value);
+        }
+    }
+
+    template<size_t ComponentCount>
+    void UnpackBatch(const std::span<const uint32_t> in,
+                     const std::span<float> out,
+                     size_t (*unpackSimd)(const uint32_t*, float*, size_t),
+                     void (*unpack)(uint32_t, float (&)[ComponentCount]))
+    {
+        assert(out.size() == in.size() * ComponentCount);
+
+        for (auto i = unpackSimd(in.data(), out.data(), in.size()); i < in.size(); i++)
+        {
+            float value[ComponentCount];
+            unpack(in[i], value);
+            std::copy_n(value, ComponentCount, &out[i * ComponentCount]);
+        }
+    }
+
+    void Vec2PackTexCoordsUV(const std::span<const float> in, const std::span<uint32_t> out)
+    {
+        Vec2PackTexCoords(in, out, false);
+    }
+
+    void Vec2PackTexCoordsVU(const std::span<const float> in, const std::span<uint32_t> out)
+    {
+        Vec2PackTexCoords(in, out, true);
+    }
+
+    void Vec3PackUnitVecScaleBased(const std::span<const float> in, const std::span<uint32_t> out)
+    {
+        PackBatch<3>(in, out, pack_simd::Vec3PackUnitVecScaleBased, Vec3PackUnitVecScaleBased);
+    }
+
+    void Vec3PackUnitVecThirdBased(const std::span<const float> in, const std::span<uint32_t> out)
+    {
+        PackBatch<3>(in, out, pack_simd::Vec3PackUnitVecThirdBased, Vec3PackUnitVecThirdBased);
+    }
+
+    void Vec4PackGfxColor(const std::span<const float> in, const std::span<uint32_t> out)
+    {
+        PackBatch<4>(in, out, pack_simd::Vec4PackGfxColor, Vec4PackGfxColor);
+    }
+
+    void Vec2UnpackTexCoordsUV(const std::span<const uint32_t> in, const std::span<float> out)
+    {
+        Vec2UnpackTexCoords(in, out, false);
+    }
+
+    void Vec2UnpackTexCoordsVU(const std::span<const uint32_t> in, const std::span<float> out)
+    {
+        Vec2UnpackTexCoords(in, out, true);
+    }
+
+    void Vec3UnpackUnitVecScaleBased(const std::span<const uint32_t> in, const std::span<float> out)
+    {
+        UnpackBatch<3>(in, out, pack_simd::Vec3UnpackUnitVecScaleBased, Vec3UnpackUnitVecScaleBased);
+    }
+
+    void Vec3UnpackUnitVecThirdBased(const std::span<const uint32_t> in, const std::span<float> out)
+    {
+        UnpackBatch<3>(in, out, pack_simd::Vec3UnpackUnitVecThirdBased, Vec3UnpackUnitVecThirdBased);
+    }
+
+    void Vec4UnpackGfxColor(const std::span<const uint32_t> in, const std::span<float> out)
+    {
+        UnpackBatch<4>(in, out, pack_simd::Vec4UnpackGfxColor, Vec4UnpackGfxColor);
+    }
 } // namespace pack32
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
 namespace pack32
 {
@@ -15,4 +16,18 @@ namespace pack32
     void Vec3UnpackUnitVecScaleBased(uint32_t in, float (&out)[3]);
     void Vec3UnpackUnitVecThirdBased(uint32_t in, float (&out)[3]);
     void Vec4UnpackGfxColor(uint32_t in, float (&out)[4]);
+
+    // Batch variants that convert all vectors at once using vector instructions when available.
+    // The float spans hold the components of all vectors consecutively. Results match the single vector variants.
+    void Vec2PackTexCoordsUV(std::span<const float> in, std::span<uint32_t> out);
+    void Vec2PackTexCoordsVU(std::span<const float> in, std::span<uint32_t> out);
+    void Vec3PackUnitVecScaleBased(std::span<const float> in, std::span<uint32_t> out);
+    void Vec3PackUnitVecThirdBased(std::span<const float> in, std::span<uint32_t> out);
+    void Vec4PackGfxColor(std::span<const float> in, std::span<uint32_t> out);
+
+    void Vec2UnpackTexCoordsUV(std::span<const uint32_t> in, std::span<float> out);
+    void Vec2UnpackTexCoordsVU(std::span<const uint32_t> in, std::span<float> out);
+    void Vec3UnpackUnitVecScaleBased(std::span<const uint32_t> in, std::span<float> out);
+    void Vec3UnpackUnitVecThirdBased(std::span<const uint32_t> in, std::span<float> out);
+    void Vec4UnpackGfxColor(std::span<const uint32_t> in, std::span<float> out);
 }; // namespace pack32
@@ -0,0 +1,211 @@
+#include "PackSimd.h"
+
+#include "CpuFeatures.h"
+
+// Only enabled for x64 where the scalar implementations are guaranteed to use sse floating point math as well
+#if defined(ARCH_x64)
+#define PACK_SIMD_SUPPORTED
+#endif
+
+#ifdef PACK_SIMD_SUPPORTED
+
+#include <cstdint>
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PACK_SIMD_AVX2_ATTRIBUTE __attribute__((target("avx2")))
+#else
+#define PACK_SIMD_AVX2_ATTRIBUTE
+#endif
+
+namespace
+{
+    namespace sse2
+    {
+        constexpr size_t LANES = 4u;
+
+        typedef __m128 float_v;
+        typedef __m128i int_v;
+
+        // clang-format off
+        inline float_v SetF(const float value) { return _mm_set1_ps(value); }
+        inline float_v LoadF(const float* in) { return _mm_loadu_ps(in); }
+        inline void StoreF(float* out, const float_v v) { _mm_storeu_ps(out, v); }
+        inline float_v Add(const float_v a, const float_v b) { return _mm_add_ps(a, b); }
+        inline float_v Sub(const float_v a, const float_v b) { return _mm_sub_ps(a, b); }
+        inline float_v Mul(const float_v a, const float_v b) { return _mm_mul_ps(a, b); }
+        inline float_v Div(const float_v a, const float_v b) { return _mm_div_ps(a, b); }
+        inline float_v Sqrt(const float_v v) { return _mm_sqrt_ps(v); }
+        inline float_v Abs(const float_v v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+        inline float_v CmpLt(const float_v a, const float_v b) { return _mm_cmplt_ps(a, b); }
+        inline float_v CmpLe(const float_v a, const float_v b) { return _mm_cmple_ps(a, b); }
+        inline float_v CmpGt(const float_v a, const float_v b) { return _mm_cmpgt_ps(a, b); }
+        inline float_v CmpEq(const float_v a, const float_v b) { return _mm_cmpeq_ps(a, b); }
+        inline float_v And(const float_v a, const float_v b) { return _mm_and_ps(a, b); }
+        inline float_v Or(const float_v a, const float_v b) { return _mm_or_ps(a, b); }
+        inline float_v AndNot(const float_v mask, const float_v v) { return _mm_andnot_ps(mask, v); }
+        inline float_v Select(const float_v mask, const float_v a, const float_v b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+        inline bool AllTrue(const float_v mask) { return _mm_movemask_ps(mask) == 0xF; }
+        inline int_v FloatToIntTrunc(const float_v v) { return _mm_cvttps_epi32(v); }
+        inline float_v IntToFloat(const int_v v) { return _mm_cvtepi32_ps(v); }
+        inline float_v AsFloat(const int_v v) { return _mm_castsi128_ps(v); }
+        inline int_v AsInt(const float_v v) { return _mm_castps_si128(v); }
+
+        inline int_v SetI(const int32_t value) { return _mm_set1_epi32(value); }
+        inline int_v LoadI(const uint32_t* in) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)); }
+        inline void StoreI(uint32_t* out, const int_v v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v); }
+        inline int_v AddI(const int_v a, const int_v b) { return _mm_add_epi32(a, b); }
+        inline int_v SubI(const int_v a, const int_v b) { return _mm_sub_epi32(a, b); }
+        inline int_v AndI(const int_v a, const int_v b) { return _mm_and_si128(a, b); }
+        inline int_v OrI(const int_v a, const int_v b) { return _mm_or_si128(a, b); }
+        inline int_v XorI(const int_v a, const int_v b) { return _mm_xor_si128(a, b); }
+        inline int_v AndNotI(const int_v mask, const int_v v) { return _mm_andnot_si128(mask, v); }
+        inline int_v CmpGtI(const int_v a, const int_v b) { return _mm_cmpgt_epi32(a, b); }
+        inline int_v CmpEqI(const int_v a, const int_v b) { return _mm_cmpeq_epi32(a, b); }
+        inline int_v SelectI(const int_v mask, const int_v a, const int_v b) { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+        template<int Count> int_v SllI(const int_v v) { return _mm_slli_epi32(v, Count); }
+        template<int Count> int_v SrlI(const int_v v) { return _mm_srli_epi32(v, Count); }
+        template<int Count> int_v SraI(const int_v v) { return _mm_srai_epi32(v, Count); }
+        // clang-format on
+
+        inline int_v LoadU16(const uint16_t* in)
+        {
+            return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in)), _mm_setzero_si128());
+        }
+
+        inline void StoreU16(uint16_t* out, const int_v v)
+        {
+            // Sign extend the low 16 bits so the saturating pack keeps them unchanged
+            const auto signExtended = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packs_epi32(signExtended, signExtended));
+        }
+
+#define PACK_SIMD_TARGET
+#include "PackSimdKernels.inc.h"
+#undef PACK_SIMD_TARGET
+    } // namespace sse2
+
+    namespace avx2
+    {
+        constexpr size_t LANES = 8u;
+
+        typedef __m256 float_v;
+        typedef __m256i int_v;
+
+        // clang-format off
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v SetF(const float value) { return _mm256_set1_ps(value); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v LoadF(const float* in) { return _mm256_loadu_ps(in); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline void StoreF(float* out, const float_v v) { _mm256_storeu_ps(out, v); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v Add(const float_v a, const float_v b) { return _mm256_add_ps(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v Sub(const float_v a, const float_v b) { return _mm256_sub_ps(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v Mul(const float_v a, const float_v b) { return _mm256_mul_ps(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v Div(const float_v a, const float_v b) { return _mm256_div_ps(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v Sqrt(const float_v v) { return _mm256_sqrt_ps(v); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v Abs(const float_v v) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v CmpLt(const float_v a, const float_v b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v CmpLe(const float_v a, const float_v b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v CmpGt(const float_v a, const float_v b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v CmpEq(const float_v a, const float_v b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v And(const float_v a, const float_v b) { return _mm256_and_ps(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v Or(const float_v a, const float_v b) { return _mm256_or_ps(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v AndNot(const float_v mask, const float_v v) { return _mm256_andnot_ps(mask, v); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v Select(const float_v mask, const float_v a, const float_v b) { return _mm256_blendv_ps(b, a, mask); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline bool AllTrue(const float_v mask) { return _mm256_movemask_ps(mask) == 0xFF; }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v FloatToIntTrunc(const float_v v) { return _mm256_cvttps_epi32(v); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v IntToFloat(const int_v v) { return _mm256_cvtepi32_ps(v); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline float_v AsFloat(const int_v v) { return _mm256_castsi256_ps(v); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v AsInt(const float_v v) { return _mm256_castps_si256(v); }
+
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v SetI(const int32_t value) { return _mm256_set1_epi32(value); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v LoadI(const uint32_t* in) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in)); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline void StoreI(uint32_t* out, const int_v v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v AddI(const int_v a, const int_v b) { return _mm256_add_epi32(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v SubI(const int_v a, const int_v b) { return _mm256_sub_epi32(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v AndI(const int_v a, const int_v b) { return _mm256_and_si256(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v OrI(const int_v a, const int_v b) { return _mm256_or_si256(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v XorI(const int_v a, const int_v b) { return _mm256_xor_si256(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v AndNotI(const int_v mask, const int_v v) { return _mm256_andnot_si256(mask, v); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v CmpGtI(const int_v a, const int_v b) { return _mm256_cmpgt_epi32(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v CmpEqI(const int_v a, const int_v b) { return _mm256_cmpeq_epi32(a, b); }
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v SelectI(const int_v mask, const int_v a, const int_v b) { return _mm256_blendv_epi8(b, a, mask); }
+        template<int Count> PACK_SIMD_AVX2_ATTRIBUTE int_v SllI(const int_v v) { return _mm256_slli_epi32(v, Count); }
+        template<int Count> PACK_SIMD_AVX2_ATTRIBUTE int_v SrlI(const int_v v) { return _mm256_srli_epi32(v, Count); }
+        template<int Count> PACK_SIMD_AVX2_ATTRIBUTE int_v SraI(const int_v v) { return _mm256_srai_epi32(v, Count); }
+        // clang-format on
+
+        PACK_SIMD_AVX2_ATTRIBUTE inline int_v LoadU16(const uint16_t* in)
+        {
+            return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+        }
+
+        PACK_SIMD_AVX2_ATTRIBUTE inline void StoreU16(uint16_t* out, const int_v v)
+        {
+            // Sign extend the low 16 bits so the saturating pack keeps them unchanged
+            const auto signExtended = _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+
+            // The pack works per 128 bit lane so the results are in the first and third quadword
+            const auto packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(signExtended, signExtended), 0b1000);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+        }
+
+#define PACK_SIMD_TARGET PACK_SIMD_AVX2_ATTRIBUTE
+#include "PackSimdKernels.inc.h"
+#undef PACK_SIMD_TARGET
+    } // namespace avx2
+} // namespace
+
+#endif
+
+namespace pack_simd
+{
+#ifdef PACK_SIMD_SUPPORTED
+#define PACK_SIMD_DISPATCH(function, ...)                                                                                                                      \
+    if (CpuFeatures::HasAvx2())                                                                                                                                \
+        return avx2::function(__VA_ARGS__);                                                                                                                    \
+    return sse2::function(__VA_ARGS__);
+#else
+#define PACK_SIMD_DISPATCH(function, ...) return 0u;
+#endif
+
+    size_t HalfToFloat(const half_float_t* in, float* out, const size_t count)
+    {
+        PACK_SIMD_DISPATCH(HalfToFloat, in, out, count)
+    }
+
+    size_t FloatToHalf(const float* in, half_float_t* out, const size_t count)
+    {
+        PACK_SIMD_DISPATCH(FloatToHalf, in, out, count)
+    }
+
+    size_t Vec3PackUnitVecScaleBased(const float* in, uint32_t* out, const size_t count)
+    {
+        PACK_SIMD_DISPATCH(Vec3PackUnitVecScaleBased, in, out, count)
+    }
+
+    size_t Vec3PackUnitVecThirdBased(const float* in, uint32_t* out, const size_t count)
+    {
+        PACK_SIMD_DISPATCH(Vec3PackUnitVecThirdBased, in, out, count)
+    }
+
+    size_t Vec4PackGfxColor(const float* in, uint32_t* out, const size_t count)
+    {
+        PACK_SIMD_DISPATCH(Vec4PackGfxColor, in, out, count)
+    }
+
+    size_t Vec3UnpackUnitVecScaleBased(const uint32_t* in, float* out, const size_t count)
+    {
+        PACK_SIMD_DISPATCH(Vec3UnpackUnitVecScaleBased, in, out, count)
+    }
+
+    size_t Vec3UnpackUnitVecThirdBased(const uint32_t* in, float* out, const size_t count)
+    {
+        PACK_SIMD_DISPATCH(Vec3UnpackUnitVecThirdBased, in, out, count)
+    }
+
+    size_t Vec4UnpackGfxColor(const uint32_t* in, float* out, const size_t count)
+    {
+        PACK_SIMD_DISPATCH(Vec4UnpackGfxColor, in, out, count)
+    }
+
+#undef PACK_SIMD_DISPATCH
+} // namespace pack_simd
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "HalfFloat.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \brief Vectorized implementations of the conversions of \c pack32 and \c HalfFloat.
+ * The instruction set is chosen at runtime. All functions convert the leading elements that fill complete vectors
+ * and return the amount of converted elements. The remaining elements must be converted by the scalar implementations.
+ * Results match the scalar implementations bit for bit.
+ */
+namespace pack_simd
+{
+    size_t HalfToFloat(const half_float_t* in, float* out, size_t count);
+    size_t FloatToHalf(const float* in, half_float_t* out, size_t count);
+
+    size_t Vec3PackUnitVecScaleBased(const float* in, uint32_t* out, size_t count);
+    size_t Vec3PackUnitVecThirdBased(const float* in, uint32_t* out, size_t count);
+    size_t Vec4PackGfxColor(const float* in, uint32_t* out, size_t count);
+
+    size_t Vec3UnpackUnitVecScaleBased(const uint32_t* in, float* out, size_t count);
+    size_t Vec3UnpackUnitVecThirdBased(const uint32_t* in, float* out, size_t count);
+    size_t Vec4UnpackGfxColor(const uint32_t* in, float* out, size_t count);
+} // namespace pack_simd
@@ -0,0 +1,254 @@
+// This file is included once for every supported instruction set inside a namespace that provides the vector types and functions.
+// The kernels mirror the scalar implementations of Pack.cpp and HalfFloat.cpp operation for operation to produce the same results.
+
+#ifndef PACK_SIMD_TARGET
+#error Must define PACK_SIMD_TARGET
+#endif
+
+PACK_SIMD_TARGET size_t HalfToFloat(const half_float_t* in, float* out, const size_t count)
+{
+    const auto simdCount = count - count % LANES;
+    for (size_t i = 0; i < simdCount; i += LANES)
+    {
+        const auto half = LoadU16(&in[i]);
+        const auto shifted = SllI<14>(half);
+
+        const auto sign = AndI(SllI<16>(half), SetI(INT32_MIN));
+        const auto magnitude = SrlI<1>(XorI(SubI(AndI(shifted, SetI(0xFFFC000)), AndNotI(shifted, SetI(0x10000000))), SetI(INT32_MIN)));
+        const auto isZero = CmpEqI(half, SetI(0));
+
+        StoreF(&out[i], AsFloat(AndNotI(isZero, OrI(sign, magnitude))));
+    }
+
+    return simdCount;
+}
+
+PACK_SIMD_TARGET size_t FloatToHalf(const float* in, half_float_t* out, const size_t count)
+{
+    const auto simdCount = count - count % LANES;
+    for (size_t i = 0; i < simdCount; i += LANES)
+    {
+        const auto value = AsInt(LoadF(&in[i]));
+
+        const auto shifted = SraI<14>(XorI(AddI(value, value), SetI(INT32_MIN)));
+        const auto clampedTop = SelectI(CmpGtI(SetI(0x3FFF), shifted), shifted, SetI(0x3FFF));
+        const auto clamped = SelectI(CmpGtI(clampedTop, SetI(-16384)), clampedTop, SetI(0xC000));
+
+        StoreU16(&out[i], OrI(AndI(clamped, SetI(0x3FFF)), AndI(SrlI<16>(value), SetI(0xC000))));
+    }
+
+    return simdCount;
+}
+
+PACK_SIMD_TARGET inline float_v Vec3Length(const float_v x, const float_v y, const float_v z)
+{
+    const auto length = Sqrt(Add(Add(Mul(x, x), Mul(y, y)), Mul(z, z)));
+
+    return Select(CmpLe(length, SetF(0.0f)), SetF(1.0f), length);
+}
+
+PACK_SIMD_TARGET size_t Vec3PackUnitVecScaleBased(const float* in, uint32_t* out, const size_t count)
+{
+    const auto simdCount = count - count % LANES;
+    for (size_t i = 0; i < simdCount; i += LANES)
+    {
+        alignas(32) float inX[LANES];
+        alignas(32) float inY[LANES];
+        alignas(32) float inZ[LANES];
+        for (size_t lane = 0; lane < LANES; lane++)
+        {
+            inX[lane] = in[(i + lane) * 3u + 0u];
+            inY[lane] = in[(i + lane) * 3u + 1u];
+            inZ[lane] = in[(i + lane) * 3u + 2u];
+        }
+
+        auto normalizedX = LoadF(inX);
+        auto normalizedY = LoadF(inY);
+        auto normalizedZ = LoadF(inZ);
+        const auto lengthInv = Div(SetF(1.0f), Vec3Length(normalizedX, normalizedY, normalizedZ));
+        normalizedX = Mul(lengthInv, normalizedX);
+        normalizedY = Mul(lengthInv, normalizedY);
+        normalizedZ = Mul(lengthInv, normalizedZ);
+
+        auto result = SetI(0);
+        auto bestDirError = SetF(3.4028235e38f);
+        auto bestLenError = SetF(3.4028235e38f);
+        auto finished = AsFloat(SetI(0));
+
+        for (auto scaleIndex = 0; scaleIndex <= UINT8_MAX; scaleIndex++)
+        {
+            const auto encodeScale = SetF(32385.0f / (static_cast<float>(scaleIndex) - -192.0f));
+            const auto encodedX = AndI(FloatToIntTrunc(Add(Mul(normalizedX, encodeScale), SetF(127.5f))), SetI(UINT8_MAX));
+            const auto encodedY = AndI(FloatToIntTrunc(Add(Mul(normalizedY, encodeScale), SetF(127.5f))), SetI(UINT8_MAX));
+            const auto encodedZ = AndI(FloatToIntTrunc(Add(Mul(normalizedZ, encodeScale), SetF(127.5f))), SetI(UINT8_MAX));
+
+            const auto decodeScale = SetF((static_cast<float>(scaleIndex) - -192.0f) / 32385.0f);
+            auto decodedX = Mul(Sub(IntToFloat(encodedX), SetF(127.0f)), decodeScale);
+            auto decodedY = Mul(Sub(IntToFloat(encodedY), SetF(127.0f)), decodeScale);
+            auto decodedZ = Mul(Sub(IntToFloat(encodedZ), SetF(127.0f)), decodeScale);
+
+            const auto decodedLength = Vec3Length(decodedX, decodedY, decodedZ);
+            const auto decodedLengthInv = Div(SetF(1.0f), decodedLength);
+            decodedX = Mul(decodedLengthInv, decodedX);
+            decodedY = Mul(decodedLengthInv, decodedY);
+            decodedZ = Mul(decodedLengthInv, decodedZ);
+
+            const auto lenError = Abs(Sub(decodedLength, SetF(1.0f)));
+            const auto dirError =
+                Abs(Sub(Add(Add(Mul(decodedX, normalizedX), Mul(decodedY, normalizedY)), Mul(decodedZ, normalizedZ)), SetF(1.0f)));
+
+            const auto isBetter = Or(CmpGt(bestDirError, dirError), And(CmpLe(bestDirError, dirError), CmpGt(bestLenError, lenError)));
+            const auto isAccepted = AndNot(finished, And(CmpLt(lenError, SetF(0.001f)), isBetter));
+
+            bestDirError = Select(isAccepted, dirError, bestDirError);
+            bestLenError = Select(isAccepted, lenError, bestLenError);
+
+            const auto encodedScale = SetI(static_cast<int32_t>(static_cast<uint32_t>(scaleIndex) << 24u));
+            const auto encoded = OrI(OrI(encodedX, SllI<8>(encodedY)), OrI(SllI<16>(encodedZ), encodedScale));
+            result = SelectI(AsInt(isAccepted), encoded, result);
+
+            // Lanes with a perfect encoding stop searching just like the scalar implementation returns early
+            finished = Or(finished, And(isAccepted, CmpEq(Add(lenError, dirError), SetF(0.0f))));
+            if (AllTrue(finished))
+                break;
+        }
+
+        StoreI(&out[i], result);
+    }
+
+    return simdCount;
+}
+
+PACK_SIMD_TARGET size_t Vec3PackUnitVecThirdBased(const float* in, uint32_t* out, const size_t count)
+{
+    const auto simdCount = count - count % LANES;
+    for (size_t i = 0; i < simdCount; i += LANES)
+    {
+        alignas(32) float inX[LANES];
+        alignas(32) float inY[LANES];
+        alignas(32) float inZ[LANES];
+        for (size_t lane = 0; lane < LANES; lane++)
+        {
+            inX[lane] = in[(i + lane) * 3u + 0u];
+            inY[lane] = in[(i + lane) * 3u + 1u];
+            inZ[lane] = in[(i + lane) * 3u + 2u];
+        }
+
+        const auto x = AndI(AsInt(Mul(Sub(LoadF(inX), SetF(-24624.0939334638f)), SetF(0.0001218318939208984f))), SetI(0x3FF));
+        const auto y = AndI(AsInt(Mul(Sub(LoadF(inY), SetF(-24624.0939334638f)), SetF(0.0001218318939208984f))), SetI(0x3FF));
+        const auto z = AndI(AsInt(Mul(Sub(LoadF(inZ), SetF(-24624.0939334638f)), SetF(0.0001218318939208984f))), SetI(0x3FF));
+
+        const auto result = OrI(OrI(x, SllI<10>(y)), SllI<20>(z));
+        StoreI(&out[i], result);
+    }
+
+    return simdCount;
+}
+
+PACK_SIMD_TARGET inline int_v PackGfxColorComponent(const float_v value)
+{
+    // Same comparisons as std::clamp to treat nan the same way
+    const auto clamped = Select(CmpLt(value, SetF(0.0f)), SetF(0.0f), Select(CmpLt(SetF(1.0f), value), SetF(1.0f), value));
+
+    return AndI(FloatToIntTrunc(Mul(clamped, SetF(255.0f))), SetI(UINT8_MAX));
+}
+
+PACK_SIMD_TARGET size_t Vec4PackGfxColor(const float* in, uint32_t* out, const size_t count)
+{
+    const auto simdCount = count - count % LANES;
+    for (size_t i = 0; i < simdCount; i += LANES)
+    {
+        alignas(32) float inComponents[4][LANES];
+        for (size_t lane = 0; lane < LANES; lane++)
+        {
+            for (auto component = 0u; component < 4u; component++)
+                inComponents[component][lane] = in[(i + lane) * 4u + component];
+        }
+
+        const auto r = PackGfxColorComponent(LoadF(inComponents[0]));
+        const auto g = PackGfxColorComponent(LoadF(inComponents[1]));
+        const auto b = PackGfxColorComponent(LoadF(inComponents[2]));
+        const auto a = PackGfxColorComponent(LoadF(inComponents[3]));
+
+        const auto result = OrI(OrI(r, SllI<8>(g)), OrI(SllI<16>(b), SllI<24>(a)));
+        StoreI(&out[i], result);
+    }
+
+    return simdCount;
+}
+
+PACK_SIMD_TARGET size_t Vec3UnpackUnitVecScaleBased(const uint32_t* in, float* out, const size_t count)
+{
+    const auto simdCount = count - count % LANES;
+    for (size_t i = 0; i < simdCount; i += LANES)
+    {
+        const auto packed = LoadI(&in[i]);
+        const auto decodeScale = Div(Add(IntToFloat(SrlI<24>(packed)), SetF(192.0f)), SetF(32385.0f));
+
+        alignas(32) float outComponents[3][LANES];
+        StoreF(outComponents[0], Mul(Add(IntToFloat(AndI(packed, SetI(UINT8_MAX))), SetF(-127.0f)), decodeScale));
+        StoreF(outComponents[1], Mul(Add(IntToFloat(AndI(SrlI<8>(packed), SetI(UINT8_MAX))), SetF(-127.0f)), decodeScale));
+        StoreF(outComponents[2], Mul(Add(IntToFloat(AndI(SrlI<16>(packed), SetI(UINT8_MAX))), SetF(-127.0f)), decodeScale));
+
+        for (size_t lane = 0; lane < LANES; lane++)
+        {
+            for (auto component = 0u; component < 3u; component++)
+                out[(i + lane) * 3u + component] = outComponents[component][lane];
+        }
+    }
+
+    return simdCount;
+}
+
+PACK_SIMD_TARGET inline float_v UnpackThirdBasedComponent(const int_v bits)
+{
+    const auto signBit = AndI(bits, SetI(0x200));
+    const auto adjusted = AddI(SubI(bits, AddI(signBit, signBit)), SetI(0x40400000));
+
+    return Mul(Sub(AsFloat(adjusted), SetF(3.0f)), SetF(8208.0312f));
+}
+
+PACK_SIMD_TARGET size_t Vec3UnpackUnitVecThirdBased(const uint32_t* in, float* out, const size_t count)
+{
+    const auto simdCount = count - count % LANES;
+    for (size_t i = 0; i < simdCount; i += LANES)
+    {
+        const auto packed = LoadI(&in[i]);
+
+        alignas(32) float outComponents[3][LANES];
+        StoreF(outComponents[0], UnpackThirdBasedComponent(AndI(packed, SetI(0x3FF))));
+        StoreF(outComponents[1], UnpackThirdBasedComponent(AndI(SrlI<10>(packed), SetI(0x3FF))));
+        StoreF(outComponents[2], UnpackThirdBasedComponent(AndI(SrlI<20>(packed), SetI(0x3FF))));
+
+        for (size_t lane = 0; lane < LANES; lane++)
+        {
+            for (auto component = 0u; component < 3u; component++)
+                out[(i + lane) * 3u + component] = outComponents[component][lane];
+        }
+    }
+
+    return simdCount;
+}
+
+PACK_SIMD_TARGET size_t Vec4UnpackGfxColor(const uint32_t* in, float* out, const size_t count)
+{
+    const auto simdCount = count - count % LANES;
+    for (size_t i = 0; i < simdCount; i += LANES)
+    {
+        const auto packed = LoadI(&in[i]);
+
+        alignas(32) float outComponents[4][LANES];
+        StoreF(outComponents[0], Div(IntToFloat(AndI(packed, SetI(UINT8_MAX))), SetF(255.0f)));
+        StoreF(outComponents[1], Div(IntToFloat(AndI(SrlI<8>(packed), SetI(UINT8_MAX))), SetF(255.0f)));
+        StoreF(outComponents[2], Div(IntToFloat(AndI(SrlI<16>(packed), SetI(UINT8_MAX))), SetF(255.0f)));
+        StoreF(outComponents[3], Div(IntToFloat(SrlI<24>(packed)), SetF(255.0f)));
+
+        for (size_t lane = 0; lane < LANES; lane++)
+        {
+            for (auto component = 0u; component < 4u; component++)
+                out[(i + lane) * 4u + component] = outComponents[component][lane];
+        }
+    }
+
+    return simdCount;
+}
@@ -8,14 +8,24 @@
 #include "Image/IwiWriter6.h"
 #include "Image/IwiWriter8.h"
 #include "Image/Texture.h"
+#include "Image/TextureConverter.h"
 #include "ImageConverterArgs.h"
 #include "Utils/StringUtils.h"
+#include "Utils/ThreadPool.h"
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <sstream>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -24,11 +34,105 @@ namespace image_converter
     constexpr auto EXTENSION_IWI = ".iwi";
     constexpr auto EXTENSION_DDS = ".dds";
 
+    // Upper limit for the size of all input files that are being converted at the same time
+    constexpr std::uintmax_t IN_FLIGHT_MEMORY_LIMIT = 1024u * 1024u * 1024u;
+
+    class MemoryBudget
+    {
+    public:
+        explicit MemoryBudget(const std::uintmax_t limit)
+            : m_limit(limit),
+              m_in_use(0u)
+        {
+        }
+
+        void Acquire(const std::uintmax_t size)
+        {
+            std::unique_lock lock(m_mutex);
+
+            // A single file exceeding the limit may still be converted when nothing else is in flight
+            m_condition.wait(lock,
+                             [this, size]
+                             {
+                                 return m_in_use == 0u || m_in_use + size <= m_limit;
+                             });
+            m_in_use += size;
+        }
+
+        void Release(const std::uintmax_t size)
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_in_use -= size;
+            }
+
+            m_condition.notify_all();
+        }
+
+    private:
+        std::uintmax_t m_limit;
+        std::uintmax_t m_in_use;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+    };
+
+    class MemoryReservation
+    {
+    public:
+        MemoryReservation(MemoryBudget& budget, const std::uintmax_t size)
+            : m_budget(budget),
+              m_size(size)
+        {
+            m_budget.Acquire(m_size);
+        }
+
+        ~MemoryReservation()
+        {
+            m_budget.Release(m_size);
+        }
+
+        MemoryReservation(const MemoryReservation& other) = delete;
+        MemoryReservation(MemoryReservation&& other) noexcept = delete;
+        MemoryReservation& operator=(const MemoryReservation& other) = delete;
+        MemoryReservation& operator=(MemoryReservation&& other) noexcept = delete;
+
+    private:
+        MemoryBudget& m_budget;
+        std::uintmax_t m_size;
+    };
+
+    /**
+     * \brief Collects the messages of converting a single image so that concurrent conversions do not interleave their output.
+     */
+    class ConversionLog
+    {
+    public:
+        std::ostringstream m_info;
+        std::ostringstream m_errors;
+
+        void Print() const
+        {
+            std::cout << m_info.str();
+            std::cerr << m_errors.str();
+        }
+    };
+
+    class ConversionStatistics
+    {
+    public:
+        std::atomic_uint m_converted_count{0u};
+        std::atomic_uint m_skipped_count{0u};
+        std::atomic_uint m_failed_count{0u};
+        std::atomic_uintmax_t m_bytes_read{0u};
+        std::atomic_uintmax_t m_bytes_written{0u};
+    };
+
     class ImageConverterImpl final : public ImageConverter
     {
     public:
         ImageConverterImpl()
-            : m_game_to_convert_to(image_converter::Game::UNKNOWN)
+            : m_game_to_convert_to(image_converter::Game::UNKNOWN),
+              m_memory_budget(IN_FLIGHT_MEMORY_LIMIT)
         {
         }
 
@@ -43,47 +147,236 @@ namespace image_converter
 
             m_game_to_convert_to = m_args.m_game_to_convert_to;
 
-            for (const auto& file : m_args.m_files_to_convert)
-                Convert(file);
+            const auto startTime = std::chrono::steady_clock::now();
+            const auto files = CollectFilesToConvert();
 
-            return true;
+            // The game selection may prompt the user so it has to happen before any worker starts
+            if (std::ranges::any_of(files, IsDdsFile) && !EnsureIwiWriterIsPresent())
+                return false;
+
+            ConvertAll(files);
+
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+            PrintSummary(duration.count());
+
+            return m_statistics.m_failed_count == 0u;
         }
 
     private:
-        void Convert(const std::string& file)
+        static bool IsDdsFile(const fs::path& filePath)
+        {
+            auto extension = filePath.extension().string();
+            utils::MakeStringLowerCase(extension);
+
+            return extension == EXTENSION_DDS;
+        }
+
+        [[nodiscard]] std::vector<fs::path> CollectFilesToConvert() const
+        {
+            std::vector<fs::path> files;
+
+            for (const auto& file : m_args.m_files_to_convert)
+            {
+                const fs::path filePath(file);
+                std::error_code ec;
+                if (!fs::is_directory(filePath, ec))
+                {
+                    files.emplace_back(filePath);
+                    continue;
+                }
+
+                // Folders are searched recursively, only picking up files that can be converted
+                for (const auto& entry : fs::recursive_directory_iterator(filePath, ec))
+                {
+                    if (!entry.is_regular_file())
+                        continue;
+
+                    auto extension = entry.path().extension().string();
+                    utils::MakeStringLowerCase(extension);
+                    if (extension == EXTENSION_IWI || extension == EXTENSION_DDS)
+                        files.emplace_back(entry.path());
+                }
+
+                if (ec)
+                    std::cerr << std::format("Failed to search folder {}: {}\n", filePath.string(), ec.message());
+            }
+
+            return files;
+        }
+
+        void ConvertAll(const std::vector<fs::path>& files)
+        {
+            if (m_args.m_job_count == 1u)
+            {
+                for (const auto& file : files)
+                {
+                    ConversionLog log;
+                    Convert(file, nullptr, log);
+                    log.Print();
+                }
+
+                return;
+            }
+
+            ThreadPool threadPool(m_args.m_job_count);
+
+            // A single image spreads its block compression across the pool instead
+            if (files.size() <= 1u)
+            {
+                for (const auto& file : files)
+                {
+                    ConversionLog log;
+                    Convert(file, &threadPool, log);
+                    log.Print();
+                }
+
+                return;
+            }
+
+            std::vector<ConversionLog> logs(files.size());
+            std::vector<std::future<void>> conversions;
+            conversions.reserve(files.size());
+
+            for (auto i = 0uz; i < files.size(); i++)
+            {
+                conversions.emplace_back(threadPool.Submit(
+                    [this, &file = files[i], &log = logs[i]]
+                    {
+                        Convert(file, nullptr, log);
+                    }));
+            }
+
+            // Messages are printed in the order of the input files, each as soon as its conversion and all conversions before it are done
+            for (auto i = 0uz; i < conversions.size(); i++)
+            {
+                conversions[i].get();
+                logs[i].Print();
+            }
+        }
+
+        void PrintSummary(const double seconds) const
+        {
+            std::cout << std::format("Converted {} images, skipped {} up to date images, {} failed\n",
+                                     m_statistics.m_converted_count.load(),
+                                     m_statistics.m_skipped_count.load(),
+                                     m_statistics.m_failed_count.load());
+            std::cout << std::format(
+                "Read {} bytes and wrote {} bytes in {:.2f}s\n", m_statistics.m_bytes_read.load(), m_statistics.m_bytes_written.load(), seconds);
+        }
+
+        static bool IsUpToDate(const fs::path& inputPath, const fs::path& outputPath)
+        {
+            std::error_code ec;
+            const auto outputTime = fs::last_write_time(outputPath, ec);
+            if (ec)
+                return false;
+
+            const auto inputTime = fs::last_write_time(inputPath, ec);
+            if (ec)
+                return false;
+
+            return outputTime >= inputTime;
+        }
+
+        void Convert(const fs::path& filePath, ThreadPool* threadPool, ConversionLog& log)
         {
-            const fs::path filePath(file);
             auto extension = filePath.extension().string();
             utils::MakeStringLowerCase(extension);
 
+            fs::path outPath = filePath;
             if (extension == EXTENSION_IWI)
-                ConvertIwi(filePath);
+                outPath.replace_extension(EXTENSION_DDS);
             else if (extension == EXTENSION_DDS)
-                ConvertDds(filePath);
+                outPath.replace_extension(EXTENSION_IWI);
             else
-                std::cerr << std::format("Unsupported extension {}\n", extension);
+            {
+                log.m_errors << std::format("Unsupported extension {}\n", extension);
+                ++m_statistics.m_failed_count;
+                return;
+            }
+
+            if (m_args.m_skip_up_to_date && IsUpToDate(filePath, outPath))
+            {
+                if (m_args.m_verbose)
+                    log.m_info << std::format("Skipping up to date image {}\n", filePath.string());
+
+                ++m_statistics.m_skipped_count;
+                return;
+            }
+
+            std::error_code ec;
+            const auto inputSize = fs::file_size(filePath, ec);
+
+            bool success;
+            {
+                MemoryReservation reservation(m_memory_budget, ec ? 0u : inputSize);
+
+                if (extension == EXTENSION_IWI)
+                    success = ConvertIwi(filePath, outPath, threadPool, log);
+                else
+                    success = ConvertDds(filePath, outPath, threadPool, log);
+            }
+
+            if (!success)
+            {
+                ++m_statistics.m_failed_count;
+                return;
+            }
+
+            if (m_args.m_verbose)
+                log.m_info << std::format("Converted {} to {}\n", filePath.string(), outPath.string());
+
+            ++m_statistics.m_converted_count;
+            m_statistics.m_bytes_read += ec ? 0u : inputSize;
+
+            const auto outputSize = fs::file_size(outPath, ec);
+            m_statistics.m_bytes_written += ec ? 0u : outputSize;
         }
 
-        bool ConvertIwi(const fs::path& iwiPath)
+        [[nodiscard]] std::unique_ptr<Texture>
+            ProcessTexture(std::unique_ptr<Texture> texture, const fs::path& filePath, ThreadPool* threadPool, ConversionLog& log) const
+        {
+            if (!texture || (!m_args.m_compression_format && !m_args.m_mip_filter))
+                return texture;
+
+            const auto* inputFormat = texture->GetFormat();
+            if (!TextureConverter::SupportsRgba8Conversion(inputFormat))
+            {
+                log.m_errors << std::format("Cannot compress or generate mip maps for image {} due to its format\n", filePath.string());
+                return nullptr;
+            }
+
+            const auto* targetFormat =
+                m_args.m_compression_format ? ImageFormat::ALL_FORMATS[static_cast<unsigned>(*m_args.m_compression_format)] : inputFormat;
+
+            TextureConverter converter(texture.get(), targetFormat, m_args.m_compression_quality, threadPool);
+            if (m_args.m_mip_filter)
+                converter.GenerateMipMaps(*m_args.m_mip_filter);
+
+            auto convertedTexture = converter.Convert();
+            if (!convertedTexture)
+                log.m_errors << std::format("Cannot convert image {} to the specified format\n", filePath.string());
+
+            return convertedTexture;
+        }
+
+        bool ConvertIwi(const fs::path& iwiPath, const fs::path& outPath, ThreadPool* threadPool, ConversionLog& log)
         {
             std::ifstream file(iwiPath, std::ios::in | std::ios::binary);
             if (!file.is_open())
             {
-                std::cerr << std::format("Failed to open input file {}\n", iwiPath.string());
+                log.m_errors << std::format("Failed to open input file {}\n", iwiPath.string());
                 return false;
             }
 
-            const auto texture = iwi::LoadIwi(file);
+            const auto texture = ProcessTexture(iwi::LoadIwi(file, log.m_errors), iwiPath, threadPool, log);
             if (!texture)
                 return false;
 
-            auto outPath = iwiPath;
-            outPath.replace_extension(".dds");
-
             std::ofstream outFile(outPath, std::ios::out | std::ios::binary);
             if (!outFile.is_open())
             {
-                std::cerr << std::format("Failed to open output file {}\n", outPath.string());
+                log.m_errors << std::format("Failed to open output file {}\n", outPath.string());
                 return false;
             }
 
@@ -91,29 +384,32 @@ namespace image_converter
             return true;
         }
 
-        bool ConvertDds(const fs::path& ddsPath)
+        bool ConvertDds(const fs::path& ddsPath, const fs::path& outPath, ThreadPool* threadPool, ConversionLog& log)
         {
             std::ifstream file(ddsPath, std::ios::in | std::ios::binary);
             if (!file.is_open())
             {
-                std::cerr << std::format("Failed to open input file {}\n", ddsPath.string());
+                log.m_errors << std::format("Failed to open input file {}\n", ddsPath.string());
                 return false;
             }
 
-            const auto texture = dds::LoadDds(file);
+            const auto texture = ProcessTexture(dds::LoadDds(file, log.m_errors), ddsPath, threadPool, log);
             if (!texture)
                 return false;
 
             if (!EnsureIwiWriterIsPresent())
                 return false;
 
-            auto outPath = ddsPath;
-            outPath.replace_extension(".iwi");
+            if (m_args.m_compression_format && !m_iwi_writer->SupportsImageFormat(texture->GetFormat()))
+            {
+                log.m_errors << std::format("Cannot write image {} as iwi with the specified compression format\n", ddsPath.string());
+                return false;
+            }
 
             std::ofstream outFile(outPath, std::ios::out | std::ios::binary);
             if (!outFile.is_open())
             {
-                std::cerr << std::format("Failed to open output file {}\n", outPath.string());
+                log.m_errors << std::format("Failed to open output file {}\n", outPath.string());
                 return false;
             }
 
@@ -193,6 +489,8 @@ namespace image_converter
         image_converter::Game m_game_to_convert_to;
         DdsWriter m_dds_writer;
         std::unique_ptr<IImageWriter> m_iwi_writer;
+        MemoryBudget m_memory_budget;
+        ConversionStatistics m_statistics;
     };
 } // namespace image_converter
 
@@ -1,7 +1,9 @@
 #include "ImageConverterArgs.h"
 
 #include "GitVersion.h"
+#include "Utils/Arguments/JobCountOption.h"
 #include "Utils/Arguments/UsageInformation.h"
+#include "Utils/StringUtils.h"
 
 #include <format>
 #include <iostream>
@@ -28,6 +30,41 @@ const CommandLineOption* const OPTION_VERBOSE =
     .WithDescription("Outputs a lot more and more detailed messages.")
     .Build();
 
+const CommandLineOption* const OPTION_JOBS =
+    CommandLineOption::Builder::Create()
+    .WithShortName("j")
+    .WithLongName("jobs")
+    .WithDescription("Specifies the amount of images to convert concurrently. Specify 0 to use all hardware threads. Defaults to 1.")
+    .WithParameter("jobCount")
+    .Build();
+
+const CommandLineOption* const OPTION_SKIP_UP_TO_DATE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("skip-up-to-date")
+    .WithDescription("Skips images whose output file is newer than the input file.")
+    .Build();
+
+const CommandLineOption* const OPTION_COMPRESS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("compress")
+    .WithDescription("Block compresses the converted images to the specified format. Valid formats are bc1, bc2, bc3, bc4 and bc5.")
+    .WithParameter("format")
+    .Build();
+
+const CommandLineOption* const OPTION_QUALITY =
+    CommandLineOption::Builder::Create()
+    .WithLongName("quality")
+    .WithDescription("Specifies the quality to block compress images with. Valid qualities are fast, normal and high. Defaults to normal.")
+    .WithParameter("quality")
+    .Build();
+
+const CommandLineOption* const OPTION_GENERATE_MIP_MAPS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("generate-mip-maps")
+    .WithDescription("Generates all mip maps of the converted images from their first mip map. Valid filters are box and kaiser.")
+    .WithParameter("filter")
+    .Build();
+
 constexpr auto CATEGORY_GAME = "Game";
 
 const CommandLineOption* const OPTION_GAME_IW3 =
@@ -70,6 +107,11 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_HELP,
     OPTION_VERSION,
     OPTION_VERBOSE,
+    OPTION_JOBS,
+    OPTION_SKIP_UP_TO_DATE,
+    OPTION_COMPRESS,
+    OPTION_QUALITY,
+    OPTION_GENERATE_MIP_MAPS,
     OPTION_GAME_IW3,
     OPTION_GAME_IW4,
     OPTION_GAME_IW5,
@@ -79,7 +121,10 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
 
 ImageConverterArgs::ImageConverterArgs()
     : m_verbose(false),
+      m_job_count(1u),
+      m_skip_up_to_date(false),
       m_game_to_convert_to(image_converter::Game::UNKNOWN),
+      m_compression_quality(bc::CompressionQuality::NORMAL),
       m_argument_parser(COMMAND_LINE_OPTIONS, std::extent_v<decltype(COMMAND_LINE_OPTIONS)>)
 {
 }
@@ -93,7 +138,7 @@ void ImageConverterArgs::PrintUsage()
         usage.AddCommandLineOption(commandLineOption);
     }
 
-    usage.AddArgument("fileToConvert");
+    usage.AddArgument("fileOrFolderToConvert");
     usage.SetVariableArguments(true);
 
     usage.Print();
@@ -109,6 +154,91 @@ void ImageConverterArgs::SetVerbose(const bool isVerbose)
     m_verbose = isVerbose;
 }
 
+void ImageConverterArgs::SetGameToConvertTo()
+{
+    if (m_argument_parser.IsOptionSpecified(OPTION_GAME_IW3))
+        m_game_to_convert_to = image_converter::Game::IW3;
+    else if (m_argument_parser.IsOptionSpecified(OPTION_GAME_IW4))
+        m_game_to_convert_to = image_converter::Game::IW4;
+    else if (m_argument_parser.IsOptionSpecified(OPTION_GAME_IW5))
+        m_game_to_convert_to = image_converter::Game::IW5;
+    else if (m_argument_parser.IsOptionSpecified(OPTION_GAME_T5))
+        m_game_to_convert_to = image_converter::Game::T5;
+    else if (m_argument_parser.IsOptionSpecified(OPTION_GAME_T6))
+        m_game_to_convert_to = image_converter::Game::T6;
+}
+
+bool ImageConverterArgs::SetCompressionFormat()
+{
+    if (!m_argument_parser.IsOptionSpecified(OPTION_COMPRESS))
+        return true;
+
+    auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_COMPRESS);
+    utils::MakeStringLowerCase(specifiedValue);
+
+    if (specifiedValue == "bc1")
+        m_compression_format = ImageFormatId::BC1;
+    else if (specifiedValue == "bc2")
+        m_compression_format = ImageFormatId::BC2;
+    else if (specifiedValue == "bc3")
+        m_compression_format = ImageFormatId::BC3;
+    else if (specifiedValue == "bc4")
+        m_compression_format = ImageFormatId::BC4;
+    else if (specifiedValue == "bc5")
+        m_compression_format = ImageFormatId::BC5;
+    else
+    {
+        std::cerr << std::format("Illegal value: \"{}\" is not a valid compression format.\n", specifiedValue);
+        return false;
+    }
+
+    return true;
+}
+
+bool ImageConverterArgs::SetCompressionQuality()
+{
+    if (!m_argument_parser.IsOptionSpecified(OPTION_QUALITY))
+        return true;
+
+    auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_QUALITY);
+    utils::MakeStringLowerCase(specifiedValue);
+
+    if (specifiedValue == "fast")
+        m_compression_quality = bc::CompressionQuality::FAST;
+    else if (specifiedValue == "normal")
+        m_compression_quality = bc::CompressionQuality::NORMAL;
+    else if (specifiedValue == "high")
+        m_compression_quality = bc::CompressionQuality::HIGH;
+    else
+    {
+        std::cerr << std::format("Illegal value: \"{}\" is not a valid compression quality.\n", specifiedValue);
+        return false;
+    }
+
+    return true;
+}
+
+bool ImageConverterArgs::SetMipFilter()
+{
+    if (!m_argument_parser.IsOptionSpecified(OPTION_GENERATE_MIP_MAPS))
+        return true;
+
+    auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_GENERATE_MIP_MAPS);
+    utils::MakeStringLowerCase(specifiedValue);
+
+    if (specifiedValue == "box")
+        m_mip_filter = mip::MipFilter::BOX;
+    else if (specifiedValue == "kaiser")
+        m_mip_filter = mip::MipFilter::KAISER;
+    else
+    {
+        std::cerr << std::format("Illegal value: \"{}\" is not a valid mip map filter.\n", specifiedValue);
+        return false;
+    }
+
+    return true;
+}
+
 bool ImageConverterArgs::ParseArgs(const int argc, const char** argv, bool& shouldContinue)
 {
     shouldContinue = true;
@@ -145,5 +275,25 @@ bool ImageConverterArgs::ParseArgs(const int argc, const char** argv, bool& shou
     // -v; --verbose
     SetVerbose(m_argument_parser.IsOptionSpecified(OPTION_VERBOSE));
 
+    // -j; --jobs
+    if (!ReadJobCountOption(m_argument_parser, OPTION_JOBS, m_job_count))
+    {
+        PrintUsage();
+        return false;
+    }
+
+    // --skip-up-to-date
+    m_skip_up_to_date = m_argument_parser.IsOptionSpecified(OPTION_SKIP_UP_TO_DATE);
+
+    // --compress; --quality; --generate-mip-maps
+    if (!SetCompressionFormat() || !SetCompressionQuality() || !SetMipFilter())
+    {
+        PrintUsage();
+        return false;
+    }
+
+    // --iw3; --iw4; --iw5; --t5; --t6
+    SetGameToConvertTo();
+
     return true;
 }
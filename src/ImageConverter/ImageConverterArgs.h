@@ -1,8 +1,11 @@
 #pragma once
 
+#include "Image/BlockCompression.h"
+#include "Image/MipMapGenerator.h"
 #include "Utils/Arguments/ArgumentParser.h"
 
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -26,8 +29,13 @@ public:
     bool ParseArgs(int argc, const char** argv, bool& shouldContinue);
 
     bool m_verbose;
+    unsigned m_job_count;
+    bool m_skip_up_to_date;
     std::vector<std::string> m_files_to_convert;
     image_converter::Game m_game_to_convert_to;
+    std::optional<ImageFormatId> m_compression_format;
+    bc::CompressionQuality m_compression_quality;
+    std::optional<mip::MipFilter> m_mip_filter;
 
 private:
     /**
@@ -37,6 +45,10 @@ private:
     static void PrintVersion();
 
     void SetVerbose(bool isVerbose);
+    void SetGameToConvertTo();
+    bool SetCompressionFormat();
+    bool SetCompressionQuality();
+    bool SetMipFilter();
 
     ArgumentParser m_argument_parser;
 };
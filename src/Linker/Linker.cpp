@@ -2,11 +2,15 @@
 
 #include "LinkerArgs.h"
 #include "LinkerPaths.h"
+#include "Obj/Gdt/GdtCache.h"
 #include "ObjContainer/SoundBank/SoundBankWriter.h"
 #include "ObjWriting.h"
+#include "Pool/GlobalAssetPool.h"
 #include "SearchPath/OutputPathFilesystem.h"
+#include "SearchPath/SearchPathSynchronized.h"
 #include "SearchPath/SearchPaths.h"
 #include "Utils/ObjFileStream.h"
+#include "Utils/ThreadPool.h"
 #include "Zone/AssetList/AssetList.h"
 #include "Zone/AssetList/AssetListReader.h"
 #include "Zone/Definition/ZoneDefinitionStream.h"
@@ -15,11 +19,20 @@
 #include "ZoneLoading.h"
 #include "ZoneWriting.h"
 
+#include <algorithm>
 #include <deque>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -38,9 +51,20 @@ namespace
 
         [[nodiscard]] ISearchPath& GetSearchPaths()
         {
+            if (m_synchronized_search_paths)
+                return *m_synchronized_search_paths;
+
             return m_search_paths;
         }
 
+        void SetSynchronized(const bool synchronized)
+        {
+            if (synchronized)
+                m_synchronized_search_paths = std::make_unique<SearchPathSynchronized>(m_search_paths);
+            else
+                m_synchronized_search_paths.reset();
+        }
+
         void LoadProjectSpecific(const std::string& projectName)
         {
             m_project_specific_search_paths = m_search_path_builder.BuildSearchPathsSpecificToProject(projectName);
@@ -79,6 +103,7 @@ namespace
         std::unique_ptr<ISearchPath> m_project_specific_search_paths;
         std::unique_ptr<ISearchPath> m_game_specific_search_paths;
         SearchPaths m_search_paths;
+        std::unique_ptr<SearchPathSynchronized> m_synchronized_search_paths;
     };
 
     class LinkerPathManager
@@ -151,6 +176,33 @@ namespace
     private:
         LinkerPathManager& m_paths;
     };
+
+    class PathSynchronizedContext
+    {
+    public:
+        explicit PathSynchronizedContext(LinkerPathManager& paths)
+            : m_paths(paths)
+        {
+            m_paths.m_asset_paths.SetSynchronized(true);
+            m_paths.m_gdt_paths.SetSynchronized(true);
+            m_paths.m_source_paths.SetSynchronized(true);
+        }
+
+        ~PathSynchronizedContext()
+        {
+            m_paths.m_asset_paths.SetSynchronized(false);
+            m_paths.m_gdt_paths.SetSynchronized(false);
+            m_paths.m_source_paths.SetSynchronized(false);
+        }
+
+        PathSynchronizedContext(const PathSynchronizedContext& other) = delete;
+        PathSynchronizedContext(PathSynchronizedContext&& other) noexcept = delete;
+        PathSynchronizedContext& operator=(const PathSynchronizedContext& other) = delete;
+        PathSynchronizedContext& operator=(PathSynchronizedContext&& other) noexcept = delete;
+
+    private:
+        LinkerPathManager& m_paths;
+    };
 } // namespace
 
 class LinkerImpl final : public Linker
@@ -232,38 +284,111 @@ class LinkerImpl final : public Linker
         return true;
     }
 
-    static bool LoadGdtFilesFromZoneDefinition(std::vector<std::unique_ptr<Gdt>>& gdtList, const ZoneDefinition& zoneDefinition, ISearchPath* gdtSearchPath)
+    /**
+     * \brief Returns the mutex that guards the cache of a gdt file.
+     * Concurrently built targets may load the same gdt file, so the mutex is shared by the whole process.
+     */
+    static std::mutex& GetGdtCacheMutex(const fs::path& gdtPath)
+    {
+        static std::mutex cacheMutexesMutex;
+        static std::unordered_map<std::string, std::unique_ptr<std::mutex>> cacheMutexes;
+
+        std::error_code ec;
+        auto normalizedPath = fs::weakly_canonical(gdtPath, ec);
+        if (ec)
+            normalizedPath = fs::absolute(gdtPath, ec).lexically_normal();
+
+        std::lock_guard lock(cacheMutexesMutex);
+        auto& cacheMutex = cacheMutexes[gdt_cache::GetCachePath(normalizedPath).string()];
+        if (!cacheMutex)
+            cacheMutex = std::make_unique<std::mutex>();
+
+        return *cacheMutex;
+    }
+
+    static std::unique_ptr<Gdt> LoadGdtFile(const std::string& gdtName, const SearchPathOpenFile& gdtFile, const bool useGdtCache)
+    {
+        // Only gdt files on disk can be cached since the cache is validated against the last write time
+        const auto canUseCache = useGdtCache && !gdtFile.m_file_path.empty();
+
+        // Jobs loading the same gdt file wait for the first one to write its cache and then load the cache
+        std::unique_lock<std::mutex> cacheLock;
+        if (canUseCache)
+            cacheLock = std::unique_lock(GetGdtCacheMutex(gdtFile.m_file_path));
+
+        auto gdt = std::make_unique<Gdt>();
+        if (!canUseCache || !gdt_cache::Load(gdtFile.m_file_path, *gdt))
+        {
+            GdtReader gdtReader(*gdtFile.m_stream);
+            if (!gdtReader.Read(*gdt))
+            {
+                std::cerr << std::format("Failed to read gdt file \"{}\"\n", gdtName);
+                return nullptr;
+            }
+
+            if (canUseCache && !gdt_cache::Save(gdtFile.m_file_path, *gdt))
+                std::cerr << std::format("Failed to write cache for gdt file \"{}\"\n", gdtName);
+        }
+
+        return gdt;
+    }
+
+    /**
+     * \brief Opens all gdt files of the zone definition and starts parsing them on the thread pool.
+     * The parsed gdt files are collected in the order of the definition so later gdt files still override earlier ones.
+     */
+    static bool LoadGdtFilesFromZoneDefinition(std::vector<std::future<std::unique_ptr<Gdt>>>& loadingGdtList,
+                                               const ZoneDefinition& zoneDefinition,
+                                               ISearchPath* gdtSearchPath,
+                                               const bool useGdtCache,
+                                               ThreadPool& threadPool)
     {
         for (const auto& gdtName : zoneDefinition.m_gdts)
         {
-            const auto gdtFile = gdtSearchPath->Open(std::format("{}.gdt", gdtName));
+            auto gdtFile = gdtSearchPath->Open(std::format("{}.gdt", gdtName));
             if (!gdtFile.IsOpen())
             {
                 std::cerr << std::format("Failed to open file for gdt \"{}\"\n", gdtName);
                 return false;
             }
 
-            GdtReader gdtReader(*gdtFile.m_stream);
-            auto gdt = std::make_unique<Gdt>();
-            if (!gdtReader.Read(*gdt))
+            // Files that are not on disk may come from archives that cannot be read from another thread
+            if (gdtFile.m_file_path.empty())
             {
-                std::cerr << std::format("Failed to read gdt file \"{}\"\n", gdtName);
-                return false;
+                std::ostringstream ss;
+                ss << gdtFile.m_stream->rdbuf();
+                gdtFile.m_stream = std::make_unique<std::istringstream>(std::move(ss).str());
             }
 
-            gdtList.emplace_back(std::move(gdt));
+            loadingGdtList.emplace_back(threadPool.Submit(
+                [gdtName, gdtFile = std::move(gdtFile), useGdtCache]
+                {
+                    return LoadGdtFile(gdtName, gdtFile, useGdtCache);
+                }));
         }
 
         return true;
     }
 
-    std::unique_ptr<Zone> CreateZoneForDefinition(
-        LinkerPathManager& paths, const fs::path& outDir, const fs::path& cacheDir, const std::string& targetName, ZoneDefinition& zoneDefinition) const
+    std::unique_ptr<Zone> CreateZoneForDefinition(LinkerPathManager& paths,
+                                                  const fs::path& outDir,
+                                                  const fs::path& cacheDir,
+                                                  const std::string& targetName,
+                                                  ZoneDefinition& zoneDefinition,
+                                                  ThreadPool* sharedGdtThreadPool) const
     {
+        // Targets that are built concurrently share one pool for their gdt files instead of creating one each
+        std::optional<ThreadPool> ownGdtThreadPool;
+        auto* gdtThreadPool = sharedGdtThreadPool;
+        if (!gdtThreadPool && !zoneDefinition.m_gdts.empty())
+            gdtThreadPool = &ownGdtThreadPool.emplace(std::min(static_cast<unsigned>(zoneDefinition.m_gdts.size()), ThreadPool::GetHardwareThreadCount()));
+
         ZoneCreationContext context(&zoneDefinition, &paths.m_asset_paths.GetSearchPaths(), outDir, cacheDir);
         if (!ProcessZoneDefinitionIgnores(paths, targetName, context))
             return nullptr;
-        if (!LoadGdtFilesFromZoneDefinition(context.m_gdt_files, zoneDefinition, &paths.m_gdt_paths.GetSearchPaths()))
+        if (!zoneDefinition.m_gdts.empty()
+            && !LoadGdtFilesFromZoneDefinition(
+                context.m_loading_gdt_files, zoneDefinition, &paths.m_gdt_paths.GetSearchPaths(), m_args.m_use_gdt_cache, *gdtThreadPool))
             return nullptr;
 
         return zone_creator::CreateZoneForDefinition(zoneDefinition.m_game, context);
@@ -291,16 +416,24 @@ class LinkerImpl final : public Linker
         return true;
     }
 
-    bool BuildFastFile(LinkerPathManager& paths, const std::string& projectName, const std::string& targetName, ZoneDefinition& zoneDefinition) const
+    static void SetSoundBankOutputPath(const LinkerPathManager& paths, const std::string& projectName, const GameId game)
+    {
+        SoundBankWriter::OutputPath = fs::path(paths.m_linker_paths->BuildOutputFolderPath(projectName, game));
+    }
+
+    bool BuildFastFile(LinkerPathManager& paths,
+                       const std::string& projectName,
+                       const std::string& targetName,
+                       ZoneDefinition& zoneDefinition,
+                       ThreadPool* sharedGdtThreadPool = nullptr) const
     {
         const fs::path outDir(paths.m_linker_paths->BuildOutputFolderPath(projectName, zoneDefinition.m_game));
 
         OutputPathFilesystem outputPath(outDir);
 
         const fs::path cacheDir(paths.m_linker_paths->BuildCacheFolderPath(projectName, zoneDefinition.m_game));
-        SoundBankWriter::OutputPath = outDir;
 
-        const auto zone = CreateZoneForDefinition(paths, outDir, cacheDir, targetName, zoneDefinition);
+        const auto zone = CreateZoneForDefinition(paths, outDir, cacheDir, targetName, zoneDefinition, sharedGdtThreadPool);
         auto result = zone != nullptr;
         if (zone)
             result = WriteZoneToFile(outputPath, *zone);
@@ -310,6 +443,9 @@ class LinkerImpl final : public Linker
 
     bool BuildProject(LinkerPathManager& paths, const std::string& projectName, const std::string& targetName) const
     {
+        if (m_args.m_job_count != 1u)
+            return BuildProjectConcurrently(paths, projectName, targetName);
+
         std::deque<std::string> targetsToBuild;
         std::unordered_set<std::string> alreadyBuiltTargets;
 
@@ -323,7 +459,7 @@ class LinkerImpl final : public Linker
 
             PathProjectContext projectContext(paths, projectName);
 
-            const auto zoneDefinition = ReadZoneDefinition(paths, targetName);
+            const auto zoneDefinition = ReadZoneDefinition(paths, currentTarget);
             if (!zoneDefinition)
                 return false;
 
@@ -331,7 +467,8 @@ class LinkerImpl final : public Linker
 
             if (!zoneDefinition->m_assets.empty())
             {
-                if (!BuildFastFile(paths, projectName, targetName, *zoneDefinition))
+                SetSoundBankOutputPath(paths, projectName, zoneDefinition->m_game);
+                if (!BuildFastFile(paths, projectName, currentTarget, *zoneDefinition))
                     return false;
 
                 for (const auto& referencedTarget : zoneDefinition->m_targets_to_build)
@@ -348,6 +485,96 @@ class LinkerImpl final : public Linker
         return true;
     }
 
+    /**
+     * \brief Builds a target and all targets it references with multiple jobs.
+     * Targets do not depend on the build output of each other, so after reading all zone definitions every target of the same game can be built concurrently.
+     * Each target gets its own zone and creation context and only sees the asset pools of zones that were loaded before building.
+     */
+    bool BuildProjectConcurrently(LinkerPathManager& paths, const std::string& projectName, const std::string& targetName) const
+    {
+        std::vector<std::pair<std::string, std::unique_ptr<ZoneDefinition>>> targets;
+        std::deque<std::string> targetsToRead;
+        std::unordered_set<std::string> alreadyReadTargets;
+
+        targetsToRead.emplace_back(targetName);
+        alreadyReadTargets.emplace(targetName);
+
+        {
+            PathProjectContext projectContext(paths, projectName);
+
+            while (!targetsToRead.empty())
+            {
+                auto currentTarget = std::move(targetsToRead.front());
+                targetsToRead.pop_front();
+
+                auto zoneDefinition = ReadZoneDefinition(paths, currentTarget);
+                if (!zoneDefinition)
+                    return false;
+
+                if (zoneDefinition->m_assets.empty())
+                    continue;
+
+                for (const auto& referencedTarget : zoneDefinition->m_targets_to_build)
+                {
+                    if (alreadyReadTargets.emplace(referencedTarget).second)
+                    {
+                        targetsToRead.emplace_back(referencedTarget);
+                        std::cout << std::format("Building referenced target \"{}\"\n", referencedTarget);
+                    }
+                }
+
+                targets.emplace_back(std::move(currentTarget), std::move(zoneDefinition));
+            }
+        }
+
+        // Search paths are specific to a game, so only targets of the same game can be built at the same time
+        std::vector<GameId> games;
+        for (const auto& [_, zoneDefinition] : targets)
+        {
+            if (std::ranges::find(games, zoneDefinition->m_game) == games.end())
+                games.emplace_back(zoneDefinition->m_game);
+        }
+
+        auto result = true;
+        for (const auto game : games)
+        {
+            PathProjectContext projectContext(paths, projectName);
+            PathGameContext gameContext(paths, projectName, game);
+            PathSynchronizedContext synchronizedContext(paths);
+            SetSoundBankOutputPath(paths, projectName, game);
+
+            std::vector<std::future<bool>> builds;
+            {
+                // Gdt files are loaded on a separate pool since the build jobs wait for them
+                ThreadPool gdtThreadPool(m_args.m_job_count);
+                ThreadPool threadPool(m_args.m_job_count);
+                for (auto& [currentTarget, zoneDefinition] : targets)
+                {
+                    if (zoneDefinition->m_game != game)
+                        continue;
+
+                    builds.emplace_back(threadPool.Submit(
+                        [this, &paths, &projectName, &currentTarget, &zoneDefinition, &gdtThreadPool]
+                        {
+                            const GlobalAssetPoolThreadIsolation isolation;
+                            return BuildFastFile(paths, projectName, currentTarget, *zoneDefinition, &gdtThreadPool);
+                        }));
+                }
+            }
+
+            for (auto& build : builds)
+            {
+                if (!build.get())
+                    result = false;
+            }
+
+            if (!result)
+                break;
+        }
+
+        return result;
+    }
+
     bool LoadZones()
     {
         for (const auto& zonePath : m_args.m_zones_to_load)
@@ -3,10 +3,13 @@
 #include "GitVersion.h"
 #include "ObjLoading.h"
 #include "ObjWriting.h"
+#include "Utils/Arguments/JobCountOption.h"
 #include "Utils/Arguments/UsageInformation.h"
 #include "Utils/FileUtils.h"
 #include "Utils/PathUtils.h"
+#include "Utils/ThreadPool.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <format>
 #include <iostream>
@@ -109,6 +112,26 @@ const CommandLineOption* const OPTION_MENU_NO_OPTIMIZATION =
                         "information when dumped though.)")
     .Build();
 
+const CommandLineOption* const OPTION_XMODEL_OPTIMIZE_VERTEX_CACHE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("xmodel-optimize-vertex-cache")
+    .WithDescription("Reorders triangles and vertices of xmodel surfaces to make better use of the vertex cache of the gpu.")
+    .Build();
+
+const CommandLineOption* const OPTION_GDT_CACHE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("gdt-cache")
+    .WithDescription("Caches parsed gdt files in a binary file next to them. The cache is reused as long as the gdt file is unchanged.")
+    .Build();
+
+const CommandLineOption* const OPTION_JOBS =
+    CommandLineOption::Builder::Create()
+    .WithShortName("j")
+    .WithLongName("jobs")
+    .WithDescription("Specifies the amount of targets of a project to build concurrently. Specify 0 to use all hardware threads. Defaults to 1.")
+    .WithParameter("jobCount")
+    .Build();
+
 // clang-format on
 
 const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
@@ -125,10 +148,15 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_LOAD,
     OPTION_MENU_PERMISSIVE,
     OPTION_MENU_NO_OPTIMIZATION,
+    OPTION_XMODEL_OPTIMIZE_VERTEX_CACHE,
+    OPTION_GDT_CACHE,
+    OPTION_JOBS,
 };
 
 LinkerArgs::LinkerArgs()
     : m_verbose(false),
+      m_use_gdt_cache(false),
+      m_job_count(1u),
       m_argument_parser(COMMAND_LINE_OPTIONS, std::extent_v<decltype(COMMAND_LINE_OPTIONS)>)
 {
 }
@@ -278,5 +306,27 @@ bool LinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldContin
     if (m_argument_parser.IsOptionSpecified(OPTION_MENU_NO_OPTIMIZATION))
         ObjLoading::Configuration.MenuNoOptimization = true;
 
+    // --xmodel-optimize-vertex-cache
+    if (m_argument_parser.IsOptionSpecified(OPTION_XMODEL_OPTIMIZE_VERTEX_CACHE))
+        ObjLoading::Configuration.XModelOptimizeVertexCache = true;
+
+    // --gdt-cache
+    m_use_gdt_cache = m_argument_parser.IsOptionSpecified(OPTION_GDT_CACHE);
+
+    // -j; --jobs
+    if (!ReadJobCountOption(m_argument_parser, OPTION_JOBS, m_job_count))
+    {
+        PrintUsage();
+        return false;
+    }
+
+    // Targets that are built concurrently share the hardware threads for loading their menu files and xmodels
+    if (m_job_count != 1u)
+    {
+        const auto hardwareThreadCount = ThreadPool::GetHardwareThreadCount();
+        const auto jobCount = m_job_count == 0u ? hardwareThreadCount : m_job_count;
+        ObjLoading::Configuration.LoadingThreadCount = std::max(hardwareThreadCount / jobCount, 1u);
+    }
+
     return true;
 }
@@ -18,6 +18,8 @@ public:
     bool ParseArgs(int argc, const char** argv, bool& shouldContinue);
 
     bool m_verbose;
+    bool m_use_gdt_cache;
+    unsigned m_job_count;
 
     std::vector<std::string> m_zones_to_load;
     std::vector<std::string> m_project_specifiers_to_build;
@@ -5,6 +5,7 @@
 #include "Zone/Definition/ZoneDefinition.h"
 
 #include <filesystem>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -16,6 +17,8 @@ public:
     std::filesystem::path m_out_dir;
     std::filesystem::path m_cache_dir;
     std::vector<std::unique_ptr<Gdt>> m_gdt_files;
+    // Gdt files that are still being loaded in the order of the definition. A gdt that failed to load results in a nullptr.
+    std::vector<std::future<std::unique_ptr<Gdt>>> m_loading_gdt_files;
     AssetList m_ignored_assets;
 
     ZoneCreationContext();
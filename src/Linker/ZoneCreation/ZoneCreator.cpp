@@ -14,9 +14,9 @@ namespace
         return std::make_unique<Zone>(context.m_definition->m_name, 0, IGame::GetGameById(gameId));
     }
 
-    std::vector<Gdt*> CreateGdtList(const ZoneCreationContext& context)
+    std::vector<const Gdt*> CreateGdtList(const ZoneCreationContext& context)
     {
-        std::vector<Gdt*> gdtList;
+        std::vector<const Gdt*> gdtList;
         gdtList.reserve(context.m_gdt_files.size());
         for (const auto& gdt : context.m_gdt_files)
             gdtList.push_back(gdt.get());
@@ -24,6 +24,22 @@ namespace
         return gdtList;
     }
 
+    bool FinishLoadingGdtFiles(ZoneCreationContext& context)
+    {
+        auto success = true;
+        for (auto& loadingGdt : context.m_loading_gdt_files)
+        {
+            auto gdt = loadingGdt.get();
+            if (gdt)
+                context.m_gdt_files.emplace_back(std::move(gdt));
+            else
+                success = false;
+        }
+        context.m_loading_gdt_files.clear();
+
+        return success;
+    }
+
     void IgnoreReferencesFromAssets(ZoneCreationContext& context)
     {
         for (const auto& assetEntry : context.m_definition->m_assets)
@@ -38,17 +54,22 @@ namespace
 
 namespace zone_creator
 {
-    void InitLookup(const ZoneCreationContext& context, GdtLookup& lookup)
+    void InitLookup(ZoneCreationContext& context, GdtLookup& lookup, bool& gdtFilesLoaded)
     {
-        std::vector<const Gdt*> gdtFiles;
-        gdtFiles.reserve(context.m_gdt_files.size());
-
-        for (const auto& gdt : context.m_gdt_files)
+        gdtFilesLoaded = true;
+        if (context.m_loading_gdt_files.empty())
         {
-            gdtFiles.emplace_back(gdt.get());
+            lookup.Initialize(CreateGdtList(context));
+            return;
         }
 
-        lookup.Initialize(gdtFiles);
+        // Only wait for the gdt files when the first asset needs them
+        lookup.InitializeOnFirstQuery(
+            [&context, &gdtFilesLoaded]
+            {
+                gdtFilesLoaded = FinishLoadingGdtFiles(context);
+                return CreateGdtList(context);
+            });
     }
 
     std::unique_ptr<Zone> CreateZoneForDefinition(GameId gameId, ZoneCreationContext& context)
@@ -59,7 +80,8 @@ namespace zone_creator
         IgnoredAssetLookup ignoredAssetLookup(context.m_ignored_assets);
 
         GdtLookup lookup;
-        InitLookup(context, lookup);
+        bool gdtFilesLoaded;
+        InitLookup(context, lookup, gdtFilesLoaded);
 
         const auto* objCompiler = IObjCompiler::GetObjCompilerForGame(gameId);
         const auto* objLoader = IObjLoader::GetObjLoaderForGame(gameId);
@@ -84,6 +106,11 @@ namespace zone_creator
             ++zoneDefinitionContext.m_asset_index_in_definition;
         }
 
+        if (!context.m_loading_gdt_files.empty())
+            gdtFilesLoaded = FinishLoadingGdtFiles(context);
+        if (!gdtFilesLoaded)
+            return nullptr;
+
         creatorCollection.FinalizeZone(creationContext);
 
         return zone;
@@ -3,7 +3,7 @@
 #include "Utils/StringUtils.h"
 
 #include <cstdlib>
-#include <sstream>
+#include <string>
 
 constexpr char CSV_SEPARATOR = ',';
 
@@ -111,17 +111,15 @@ bool CsvInputStream::EmitNextRow(const std::function<void(std::string)>& cb) con
 {
     auto c = m_stream.get();
     const auto isEof = c == EOF;
-    std::ostringstream col;
+    std::string col;
     auto content = false;
     while (c != EOF)
     {
         if (c == CSV_SEPARATOR)
         {
-            auto value = col.str();
-            utils::StringTrimR(value);
-            cb(std::move(value));
-            col.clear();
-            col.str(std::string());
+            utils::StringTrimR(col);
+            cb(std::move(col));
+            col = std::string();
             content = false;
         }
         else if (c == '\r')
@@ -129,7 +127,7 @@ bool CsvInputStream::EmitNextRow(const std::function<void(std::string)>& cb) con
             c = m_stream.get();
             if (c == '\n')
                 break;
-            col << '\r';
+            col.push_back('\r');
         }
         else if (c == '\n')
         {
@@ -138,12 +136,12 @@ bool CsvInputStream::EmitNextRow(const std::function<void(std::string)>& cb) con
         else if (isspace(c))
         {
             if (content)
-                col << static_cast<char>(c);
+                col.push_back(static_cast<char>(c));
         }
         else
         {
             content = true;
-            col << static_cast<char>(c);
+            col.push_back(static_cast<char>(c));
         }
 
         c = m_stream.get();
@@ -151,9 +149,8 @@ bool CsvInputStream::EmitNextRow(const std::function<void(std::string)>& cb) con
 
     if (!isEof)
     {
-        auto value = col.str();
-        utils::StringTrimR(value);
-        cb(std::move(value));
+        utils::StringTrimR(col);
+        cb(std::move(col));
     }
 
     return !isEof;
@@ -1,5 +1,6 @@
 #include "InfoString.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -7,26 +8,46 @@
 
 const std::string InfoString::EMPTY_VALUE;
 
-bool InfoString::HasKey(const std::string& key) const
+std::vector<size_t>::const_iterator InfoString::LowerBound(const std::string_view key) const
 {
-    return m_values.find(key) != m_values.end();
+    return std::lower_bound(m_sorted_entry_indices.begin(),
+                            m_sorted_entry_indices.end(),
+                            key,
+                            [this](const size_t entryIndex, const std::string_view& k)
+                            {
+                                return std::string_view(m_entries[entryIndex].first) < k;
+                            });
 }
 
-const std::string& InfoString::GetValueForKey(const std::string& key) const
+const InfoString::entry_t* InfoString::FindEntry(const std::string_view key) const
 {
-    const auto& value = m_values.find(key);
+    const auto foundIndex = LowerBound(key);
+    if (foundIndex == m_sorted_entry_indices.end() || m_entries[*foundIndex].first != key)
+        return nullptr;
 
-    if (value == m_values.end())
+    return &m_entries[*foundIndex];
+}
+
+bool InfoString::HasKey(const std::string_view key) const
+{
+    return FindEntry(key) != nullptr;
+}
+
+const std::string& InfoString::GetValueForKey(const std::string_view key) const
+{
+    const auto* entry = FindEntry(key);
+
+    if (entry == nullptr)
         return EMPTY_VALUE;
 
-    return value->second;
+    return entry->second;
 }
 
-const std::string& InfoString::GetValueForKey(const std::string& key, bool* foundValue) const
+const std::string& InfoString::GetValueForKey(const std::string_view key, bool* foundValue) const
 {
-    const auto& value = m_values.find(key);
+    const auto* entry = FindEntry(key);
 
-    if (value == m_values.end())
+    if (entry == nullptr)
     {
         if (foundValue)
             *foundValue = false;
@@ -35,23 +56,42 @@ const std::string& InfoString::GetValueForKey(const std::string& key, bool* foun
 
     if (foundValue)
         *foundValue = true;
-    return value->second;
+    return entry->second;
 }
 
-void InfoString::SetValueForKey(const std::string& key, std::string value)
+void InfoString::SetValueForKey(const std::string_view key, std::string value)
 {
-    if (!HasKey(key))
-        m_keys_by_insertion.push_back(key);
+    const auto foundIndex = LowerBound(key);
+    if (foundIndex != m_sorted_entry_indices.end() && m_entries[*foundIndex].first == key)
+    {
+        m_entries[*foundIndex].second = std::move(value);
+        return;
+    }
 
-    m_values[key] = std::move(value);
+    m_sorted_entry_indices.insert(foundIndex, m_entries.size());
+    m_entries.emplace_back(std::string(key), std::move(value));
 }
 
-void InfoString::RemoveKey(const std::string& key)
+void InfoString::RemoveKey(const std::string_view key)
 {
-    const auto& value = m_values.find(key);
+    const auto foundIndex = LowerBound(key);
+    if (foundIndex == m_sorted_entry_indices.end() || m_entries[*foundIndex].first != key)
+        return;
 
-    if (value != m_values.end())
-        m_values.erase(value);
+    const auto entryIndex = *foundIndex;
+    m_sorted_entry_indices.erase(foundIndex);
+    m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(entryIndex));
+
+    for (auto& sortedEntryIndex : m_sorted_entry_indices)
+    {
+        if (sortedEntryIndex > entryIndex)
+            sortedEntryIndex--;
+    }
+}
+
+const std::vector<InfoString::entry_t>& InfoString::GetEntries() const
+{
+    return m_entries;
 }
 
 std::string InfoString::ToString() const
@@ -59,15 +99,14 @@ std::string InfoString::ToString() const
     std::stringstream ss;
     bool first = true;
 
-    for (const auto& key : m_keys_by_insertion)
+    for (const auto& [key, value] : m_entries)
     {
-        const auto value = m_values.find(key);
         if (!first)
             ss << '\\';
         else
             first = false;
 
-        ss << key << '\\' << value->second;
+        ss << key << '\\' << value;
     }
 
     return ss.str();
@@ -78,22 +117,16 @@ std::string InfoString::ToString(const std::string& prefix) const
     std::stringstream ss;
     ss << prefix;
 
-    for (const auto& key : m_keys_by_insertion)
-    {
-        const auto value = m_values.find(key);
-        ss << '\\' << key << '\\' << value->second;
-    }
+    for (const auto& [key, value] : m_entries)
+        ss << '\\' << key << '\\' << value;
 
     return ss.str();
 }
 
 void InfoString::ToGdtProperties(const std::string& prefix, GdtEntry& gdtEntry) const
 {
-    for (const auto& key : m_keys_by_insertion)
-    {
-        const auto value = m_values.find(key);
-        gdtEntry.m_properties[key] = value->second;
-    }
+    for (const auto& [key, value] : m_entries)
+        gdtEntry.m_properties[key] = value;
 
     gdtEntry.m_properties[GDT_PREFIX_FIELD] = prefix;
 }
@@ -112,7 +145,7 @@ public:
 
     bool NextField(std::string& value)
     {
-        std::ostringstream str;
+        value.clear();
 
         auto c = m_stream.get();
         if (c == EOF)
@@ -129,12 +162,11 @@ public:
 
         while (c != EOF && c != '\\')
         {
-            str << static_cast<char>(c);
+            value.push_back(static_cast<char>(c));
             c = m_stream.get();
         }
 
         m_last_separator = c;
-        value = str.str();
         return true;
     }
 };
@@ -150,16 +182,7 @@ bool InfoString::FromStream(std::istream& stream)
         if (!infoStream.NextField(value))
             return false;
 
-        const auto existingEntry = m_values.find(key);
-        if (existingEntry == m_values.end())
-        {
-            m_keys_by_insertion.push_back(key);
-            m_values.emplace(std::make_pair(key, value));
-        }
-        else
-        {
-            existingEntry->second = value;
-        }
+        SetValueForKey(key, std::move(value));
     }
 
     return true;
@@ -187,10 +210,10 @@ bool InfoString::FromStream(const std::string& prefix, std::istream& stream)
     {
         if (key.empty())
         {
-            if (m_keys_by_insertion.empty())
+            if (m_entries.empty())
                 std::cerr << "Invalid info string: Got empty key at the start of the info string\n";
             else
-                std::cerr << "Invalid info string: Got empty key after key \"" << m_keys_by_insertion[m_keys_by_insertion.size() - 1] << "\"\n";
+                std::cerr << "Invalid info string: Got empty key after key \"" << m_entries.back().first << "\"\n";
 
             return false;
         }
@@ -202,16 +225,7 @@ bool InfoString::FromStream(const std::string& prefix, std::istream& stream)
             return false;
         }
 
-        const auto existingEntry = m_values.find(key);
-        if (existingEntry == m_values.end())
-        {
-            m_keys_by_insertion.push_back(key);
-            m_values.emplace(std::make_pair(key, value));
-        }
-        else
-        {
-            existingEntry->second = value;
-        }
+        SetValueForKey(key, std::move(value));
     }
 
     return true;
@@ -237,16 +251,7 @@ bool InfoString::FromGdtProperties(const GdtEntry& gdtEntry)
 
         for (const auto& [key, value] : currentEntry->m_properties)
         {
-            auto existingEntry = m_values.find(key);
-            if (existingEntry == m_values.end())
-            {
-                m_keys_by_insertion.push_back(key);
-                m_values.emplace(std::make_pair(key, value));
-            }
-            else
-            {
-                existingEntry->second = value;
-            }
+            SetValueForKey(key, value);
         }
     }
 
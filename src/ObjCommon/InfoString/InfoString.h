@@ -4,23 +4,38 @@
 
 #include <istream>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 class InfoString
 {
     static constexpr const char* GDT_PREFIX_FIELD = "configstringFileType";
 
+public:
+    typedef std::pair<std::string, std::string> entry_t;
+
+private:
     static const std::string EMPTY_VALUE;
-    std::unordered_map<std::string, std::string> m_values;
-    std::vector<std::string> m_keys_by_insertion;
+
+    // Entries are kept in insertion order in a flat array, lookups binary search a key-sorted index into it
+    std::vector<entry_t> m_entries;
+    std::vector<size_t> m_sorted_entry_indices;
+
+    _NODISCARD std::vector<size_t>::const_iterator LowerBound(std::string_view key) const;
+    _NODISCARD const entry_t* FindEntry(std::string_view key) const;
 
 public:
-    _NODISCARD bool HasKey(const std::string& key) const;
-    _NODISCARD const std::string& GetValueForKey(const std::string& key) const;
-    const std::string& GetValueForKey(const std::string& key, bool* foundValue) const;
-    void SetValueForKey(const std::string& key, std::string value);
-    void RemoveKey(const std::string& key);
+    _NODISCARD bool HasKey(std::string_view key) const;
+    _NODISCARD const std::string& GetValueForKey(std::string_view key) const;
+    const std::string& GetValueForKey(std::string_view key, bool* foundValue) const;
+    void SetValueForKey(std::string_view key, std::string value);
+    void RemoveKey(std::string_view key);
+
+    /**
+     * \brief Returns all key value pairs in insertion order.
+     */
+    _NODISCARD const std::vector<entry_t>& GetEntries() const;
 
     _NODISCARD std::string ToString() const;
     _NODISCARD std::string ToString(const std::string& prefix) const;
@@ -0,0 +1,278 @@
+#include "GdtCache.h"
+
+#include "Utils/FileUtils.h"
+
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string_view>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr auto CACHE_MAGIC = FileUtils::MakeMagic32('G', 'D', 'T', 'C');
+    constexpr std::uint32_t CACHE_VERSION = 1u;
+    constexpr std::uint32_t NO_PARENT = std::numeric_limits<std::uint32_t>::max();
+
+    class CacheHeader
+    {
+    public:
+        std::uint32_t m_magic;
+        std::uint32_t m_version;
+        std::uint64_t m_source_size;
+        std::int64_t m_source_write_time;
+    };
+
+    bool GetSourceHeader(const fs::path& gdtPath, CacheHeader& header)
+    {
+        std::error_code ec;
+        const auto sourceSize = fs::file_size(gdtPath, ec);
+        if (ec)
+            return false;
+
+        const auto sourceWriteTime = fs::last_write_time(gdtPath, ec);
+        if (ec)
+            return false;
+
+        header.m_magic = CACHE_MAGIC;
+        header.m_version = CACHE_VERSION;
+        header.m_source_size = static_cast<std::uint64_t>(sourceSize);
+        header.m_source_write_time = static_cast<std::int64_t>(sourceWriteTime.time_since_epoch().count());
+
+        return true;
+    }
+
+    class CacheWriter
+    {
+    public:
+        explicit CacheWriter(std::ostream& stream)
+            : m_stream(stream)
+        {
+        }
+
+        template<typename T> void Write(const T& value)
+        {
+            m_stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void WriteString(const std::string& str)
+        {
+            Write(static_cast<std::uint32_t>(str.size()));
+            m_stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+        }
+
+    private:
+        std::ostream& m_stream;
+    };
+
+    class CacheReader
+    {
+    public:
+        explicit CacheReader(const std::string& buffer)
+            : m_position(buffer.data()),
+              m_end(buffer.data() + buffer.size())
+        {
+        }
+
+        template<typename T> bool Read(T& value)
+        {
+            if (static_cast<size_t>(m_end - m_position) < sizeof(T))
+                return false;
+
+            std::memcpy(&value, m_position, sizeof(T));
+            m_position += sizeof(T);
+            return true;
+        }
+
+        bool ReadString(std::string& str)
+        {
+            std::uint32_t length;
+            if (!Read(length) || static_cast<size_t>(m_end - m_position) < length)
+                return false;
+
+            str.assign(m_position, length);
+            m_position += length;
+            return true;
+        }
+
+        [[nodiscard]] bool AtEnd() const
+        {
+            return m_position == m_end;
+        }
+
+    private:
+        const char* m_position;
+        const char* m_end;
+    };
+
+    bool ReadCache(const std::string& buffer, const CacheHeader& expectedHeader, Gdt& gdt)
+    {
+        CacheReader reader(buffer);
+
+        CacheHeader header{};
+        if (!reader.Read(header) || header.m_magic != expectedHeader.m_magic || header.m_version != expectedHeader.m_version
+            || header.m_source_size != expectedHeader.m_source_size || header.m_source_write_time != expectedHeader.m_source_write_time)
+        {
+            return false;
+        }
+
+        std::int32_t version;
+        std::uint32_t entryCount;
+        if (!reader.ReadString(gdt.m_version.m_game) || !reader.Read(version) || !reader.Read(entryCount))
+            return false;
+        gdt.m_version.m_version = version;
+
+        gdt.m_entries.reserve(entryCount);
+        for (auto entryIndex = 0u; entryIndex < entryCount; entryIndex++)
+        {
+            auto entry = std::make_unique<GdtEntry>();
+
+            std::uint32_t parentIndex;
+            std::uint32_t propertyCount;
+            if (!reader.ReadString(entry->m_name) || !reader.ReadString(entry->m_gdf_name) || !reader.Read(parentIndex) || !reader.Read(propertyCount))
+                return false;
+
+            // Parents always precede their children
+            if (parentIndex != NO_PARENT)
+            {
+                if (parentIndex >= entryIndex)
+                    return false;
+                entry->m_parent = gdt.m_entries[parentIndex].get();
+            }
+
+            entry->m_properties.reserve(propertyCount);
+            for (auto propertyIndex = 0u; propertyIndex < propertyCount; propertyIndex++)
+            {
+                std::string key;
+                std::string value;
+                if (!reader.ReadString(key) || !reader.ReadString(value))
+                    return false;
+
+                entry->m_properties.emplace(std::move(key), std::move(value));
+            }
+
+            gdt.m_entries.emplace_back(std::move(entry));
+        }
+
+        return reader.AtEnd();
+    }
+
+    bool WriteCache(std::ostream& stream, const CacheHeader& header, const Gdt& gdt)
+    {
+        std::unordered_map<const GdtEntry*, std::uint32_t> entryIndices;
+        entryIndices.reserve(gdt.m_entries.size());
+
+        CacheWriter writer(stream);
+        writer.Write(header);
+        writer.WriteString(gdt.m_version.m_game);
+        writer.Write(static_cast<std::int32_t>(gdt.m_version.m_version));
+        writer.Write(static_cast<std::uint32_t>(gdt.m_entries.size()));
+
+        for (const auto& entry : gdt.m_entries)
+        {
+            auto parentIndex = NO_PARENT;
+            if (entry->m_parent)
+            {
+                const auto foundParent = entryIndices.find(entry->m_parent);
+                if (foundParent == entryIndices.end())
+                    return false;
+
+                parentIndex = foundParent->second;
+            }
+
+            entryIndices.emplace(entry.get(), static_cast<std::uint32_t>(entryIndices.size()));
+
+            writer.WriteString(entry->m_name);
+            writer.WriteString(entry->m_gdf_name);
+            writer.Write(parentIndex);
+            writer.Write(static_cast<std::uint32_t>(entry->m_properties.size()));
+
+            for (const auto& [key, value] : entry->m_properties)
+            {
+                writer.WriteString(key);
+                writer.WriteString(value);
+            }
+        }
+
+        return static_cast<bool>(stream);
+    }
+} // namespace
+
+namespace gdt_cache
+{
+    fs::path GetCachePath(const fs::path& gdtPath)
+    {
+        auto cachePath = gdtPath;
+        cachePath += ".cache";
+
+        return cachePath;
+    }
+
+    bool Load(const fs::path& gdtPath, Gdt& gdt)
+    {
+        CacheHeader expectedHeader{};
+        if (!GetSourceHeader(gdtPath, expectedHeader))
+            return false;
+
+        const auto cachePath = GetCachePath(gdtPath);
+        std::error_code ec;
+        const auto cacheSize = fs::file_size(cachePath, ec);
+        if (ec)
+            return false;
+
+        std::ifstream cacheFile(cachePath, std::ios::in | std::ios::binary);
+        if (!cacheFile.is_open())
+            return false;
+
+        std::string buffer(static_cast<size_t>(cacheSize), '\0');
+        if (!cacheFile.read(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+            return false;
+
+        if (ReadCache(buffer, expectedHeader, gdt))
+            return true;
+
+        // Do not leave a partially loaded gdt behind
+        gdt = Gdt();
+        return false;
+    }
+
+    bool Save(const fs::path& gdtPath, const Gdt& gdt)
+    {
+        CacheHeader header{};
+        if (!GetSourceHeader(gdtPath, header))
+            return false;
+
+        // The cache is written to a temporary file first so a failed or concurrent write never leaves a truncated cache behind
+        const auto cachePath = GetCachePath(gdtPath);
+        auto tempPath = cachePath;
+        tempPath += std::format(".{:08x}.tmp", std::random_device()());
+
+        bool success;
+        {
+            std::ofstream cacheFile(tempPath, std::ios::out | std::ios::binary);
+            if (!cacheFile.is_open())
+                return false;
+
+            success = WriteCache(cacheFile, header, gdt);
+            cacheFile.close();
+            success = success && !cacheFile.fail();
+        }
+
+        std::error_code ec;
+        if (success)
+            fs::rename(tempPath, cachePath, ec);
+
+        if (!success || ec)
+        {
+            fs::remove(tempPath, ec);
+            return false;
+        }
+
+        return true;
+    }
+} // namespace gdt_cache
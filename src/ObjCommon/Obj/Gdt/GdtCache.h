@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Gdt.h"
+
+#include <filesystem>
+
+namespace gdt_cache
+{
+    /**
+     * \brief Returns the path of the binary cache file that belongs to a gdt file.
+     */
+    [[nodiscard]] std::filesystem::path GetCachePath(const std::filesystem::path& gdtPath);
+
+    /**
+     * \brief Loads a gdt from its binary cache file.
+     * The cache is only used when the size and the last write time of the gdt file match the ones the cache was created from.
+     * \param gdtPath The path to the gdt file.
+     * \param gdt The gdt to load into. Must be empty.
+     * \return \c true if the cache was up to date and could be loaded, otherwise \c false.
+     */
+    bool Load(const std::filesystem::path& gdtPath, Gdt& gdt);
+
+    /**
+     * \brief Writes a binary cache file for a gdt that was parsed from the specified gdt file.
+     * \param gdtPath The path to the gdt file.
+     * \param gdt The gdt that was parsed from the gdt file.
+     * \return \c true if the cache was written, otherwise \c false.
+     */
+    bool Save(const std::filesystem::path& gdtPath, const Gdt& gdt);
+} // namespace gdt_cache
@@ -1,5 +1,128 @@
 #include "GdtEntry.h"
 
+#include <algorithm>
+#include <stdexcept>
+
+GdtProperties::iterator GdtProperties::LowerBound(const std::string_view key)
+{
+    // Properties are usually added in order so check for appending first
+    if (m_properties.empty() || std::string_view(m_properties.back().first) < key)
+        return m_properties.end();
+
+    return std::ranges::lower_bound(m_properties,
+                                    key,
+                                    {},
+                                    [](const value_type& property)
+                                    {
+                                        return std::string_view(property.first);
+                                    });
+}
+
+GdtProperties::const_iterator GdtProperties::LowerBound(const std::string_view key) const
+{
+    return std::ranges::lower_bound(m_properties,
+                                    key,
+                                    {},
+                                    [](const value_type& property)
+                                    {
+                                        return std::string_view(property.first);
+                                    });
+}
+
+GdtProperties::iterator GdtProperties::find(const std::string_view key)
+{
+    const auto foundProperty = LowerBound(key);
+    if (foundProperty == m_properties.end() || foundProperty->first != key)
+        return m_properties.end();
+
+    return foundProperty;
+}
+
+GdtProperties::const_iterator GdtProperties::find(const std::string_view key) const
+{
+    const auto foundProperty = LowerBound(key);
+    if (foundProperty == m_properties.end() || foundProperty->first != key)
+        return m_properties.end();
+
+    return foundProperty;
+}
+
+std::string& GdtProperties::at(const std::string_view key)
+{
+    const auto foundProperty = find(key);
+    if (foundProperty == m_properties.end())
+        throw std::out_of_range("Gdt entry does not have property");
+
+    return foundProperty->second;
+}
+
+const std::string& GdtProperties::at(const std::string_view key) const
+{
+    const auto foundProperty = find(key);
+    if (foundProperty == m_properties.end())
+        throw std::out_of_range("Gdt entry does not have property");
+
+    return foundProperty->second;
+}
+
+std::string& GdtProperties::operator[](const std::string_view key)
+{
+    auto foundProperty = LowerBound(key);
+    if (foundProperty == m_properties.end() || foundProperty->first != key)
+        foundProperty = m_properties.emplace(foundProperty, std::string(key), std::string());
+
+    return foundProperty->second;
+}
+
+std::pair<GdtProperties::iterator, bool> GdtProperties::emplace(value_type property)
+{
+    const auto foundProperty = LowerBound(property.first);
+    if (foundProperty != m_properties.end() && foundProperty->first == property.first)
+        return std::make_pair(foundProperty, false);
+
+    return std::make_pair(m_properties.emplace(foundProperty, std::move(property)), true);
+}
+
+void GdtProperties::reserve(const size_t capacity)
+{
+    m_properties.reserve(capacity);
+}
+
+void GdtProperties::clear()
+{
+    m_properties.clear();
+}
+
+size_t GdtProperties::size() const
+{
+    return m_properties.size();
+}
+
+bool GdtProperties::empty() const
+{
+    return m_properties.empty();
+}
+
+GdtProperties::iterator GdtProperties::begin()
+{
+    return m_properties.begin();
+}
+
+GdtProperties::iterator GdtProperties::end()
+{
+    return m_properties.end();
+}
+
+GdtProperties::const_iterator GdtProperties::begin() const
+{
+    return m_properties.begin();
+}
+
+GdtProperties::const_iterator GdtProperties::end() const
+{
+    return m_properties.end();
+}
+
 GdtEntry::GdtEntry()
     : m_parent(nullptr)
 {
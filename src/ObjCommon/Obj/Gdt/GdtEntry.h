@@ -1,7 +1,57 @@
 #pragma once
 
-#include <map>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief The properties of a gdt entry, stored as a vector sorted by key.
+ * Gdt files list properties in sorted order which makes building the vector a sequence of appends.
+ * Like with \c std::vector adding a property invalidates all iterators and references to properties,
+ * so properties must be looked up again after adding one.
+ */
+class GdtProperties
+{
+public:
+    using value_type = std::pair<std::string, std::string>;
+    using container_type = std::vector<value_type>;
+    using iterator = container_type::iterator;
+    using const_iterator = container_type::const_iterator;
+
+    [[nodiscard]] iterator find(std::string_view key);
+    [[nodiscard]] const_iterator find(std::string_view key) const;
+    [[nodiscard]] std::string& at(std::string_view key);
+    [[nodiscard]] const std::string& at(std::string_view key) const;
+    std::string& operator[](std::string_view key);
+
+    /**
+     * \brief Adds a property if no property with the same key is present.
+     * \return The iterator to the property with the key and whether it was inserted.
+     */
+    std::pair<iterator, bool> emplace(value_type property);
+
+    template<typename... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return emplace(value_type(std::forward<Args>(args)...));
+    }
+
+    void reserve(size_t capacity);
+    void clear();
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] bool empty() const;
+
+    [[nodiscard]] iterator begin();
+    [[nodiscard]] iterator end();
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] const_iterator end() const;
+
+private:
+    [[nodiscard]] iterator LowerBound(std::string_view key);
+    [[nodiscard]] const_iterator LowerBound(std::string_view key) const;
+
+    container_type m_properties;
+};
 
 class GdtEntry
 {
@@ -9,7 +59,7 @@ public:
     std::string m_name;
     std::string m_gdf_name;
     GdtEntry* m_parent;
-    std::map<std::string, std::string> m_properties;
+    GdtProperties m_properties;
 
     GdtEntry();
     GdtEntry(std::string name, std::string gdfName);
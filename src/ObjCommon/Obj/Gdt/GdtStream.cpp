@@ -1,7 +1,6 @@
 #include "GdtStream.h"
 
 #include <iostream>
-#include <sstream>
 
 class GdtConst
 {
@@ -17,68 +16,87 @@ void GdtReader::PrintError(const std::string& message) const
     std::cout << "GDT Error at line " << m_line << ": " << message << "\n";
 }
 
-int GdtReader::PeekChar()
+void GdtReader::ReadBuffer()
 {
-    if (m_peeked)
-        return m_char;
+    // Reading the whole file at once is a lot faster than reading it character by character
+    constexpr auto READ_CHUNK_SIZE = 0x10000u;
 
-    int c;
-    do
+    m_buffer.clear();
+    while (m_stream)
     {
-        c = m_stream.get();
-    } while (isspace(c));
+        const auto offset = m_buffer.size();
+        m_buffer.resize(offset + READ_CHUNK_SIZE);
+        m_stream.read(&m_buffer[offset], READ_CHUNK_SIZE);
+        m_buffer.resize(offset + static_cast<size_t>(m_stream.gcount()));
+    }
 
-    m_peeked = true;
-    m_char = c;
-    return c;
+    m_position = m_buffer.data();
+    m_end = m_buffer.data() + m_buffer.size();
+    m_line = 1;
 }
 
-int GdtReader::NextChar()
+int GdtReader::PeekChar()
 {
-    if (m_peeked)
+    while (m_position < m_end && isspace(static_cast<unsigned char>(*m_position)))
     {
-        m_peeked = false;
-        return m_char;
+        if (*m_position == '\n')
+            m_line++;
+        m_position++;
     }
 
-    int c;
-    do
-    {
-        c = m_stream.get();
-    } while (isspace(c));
+    if (m_position >= m_end)
+        return EOF;
+
+    return static_cast<unsigned char>(*m_position);
+}
+
+int GdtReader::NextChar()
+{
+    const auto c = PeekChar();
+    if (c != EOF)
+        m_position++;
 
     return c;
 }
 
 bool GdtReader::ReadStringContent(std::string& str)
 {
-    std::ostringstream ss;
-
     if (NextChar() != '"')
     {
         PrintError("Expected string opening tag");
         return false;
     }
 
-    auto c = m_stream.get();
+    // Most strings do not contain any escape sequences and can be copied as a whole
+    const auto* stringStart = m_position;
+    while (m_position < m_end && *m_position != '"' && *m_position != '\\' && *m_position != '\n')
+        m_position++;
+
+    str.assign(stringStart, m_position);
+
     auto escaped = false;
-    while ((escaped || c != '"' && c != '\n') && c != EOF)
+    while (m_position < m_end && (escaped || *m_position != '"' && *m_position != '\n'))
     {
+        const auto c = *m_position++;
         if (escaped)
         {
             switch (c)
             {
             case '\n':
+                m_line++;
+                str += '\n';
+                break;
+
             case 'n':
-                ss << '\n';
+                str += '\n';
                 break;
 
             case 'r':
-                ss << '\r';
+                str += '\r';
                 break;
 
             default:
-                ss << static_cast<char>(c);
+                str += c;
                 break;
             }
             escaped = false;
@@ -89,31 +107,19 @@ bool GdtReader::ReadStringContent(std::string& str)
         }
         else
         {
-            ss << static_cast<char>(c);
+            str += c;
         }
-        c = m_stream.get();
     }
 
-    if (c == '"')
+    if (m_position < m_end && *m_position == '"')
     {
-        str = ss.str();
+        m_position++;
         return true;
     }
 
     return false;
 }
 
-GdtEntry* GdtReader::GetEntryByName(const Gdt& gdt, const std::string& name)
-{
-    for (const auto& entry : gdt.m_entries)
-    {
-        if (entry->m_name == name)
-            return entry.get();
-    }
-
-    return nullptr;
-}
-
 bool GdtReader::ReadProperties(GdtEntry& entry)
 {
     while (PeekChar() == '"')
@@ -142,7 +148,7 @@ bool GdtReader::ReadProperties(GdtEntry& entry)
     return true;
 }
 
-bool GdtReader::AddEntry(Gdt& gdt, GdtEntry& entry) const
+bool GdtReader::AddEntry(Gdt& gdt, GdtEntry& entry)
 {
     if (entry.m_name == GdtConst::VERSION_ENTRY_NAME && entry.m_gdf_name == GdtConst::VERSION_ENTRY_GDF)
     {
@@ -164,7 +170,10 @@ bool GdtReader::AddEntry(Gdt& gdt, GdtEntry& entry) const
     }
     else
     {
-        gdt.m_entries.emplace_back(std::make_unique<GdtEntry>(std::move(entry)));
+        const auto& newEntry = gdt.m_entries.emplace_back(std::make_unique<GdtEntry>(std::move(entry)));
+
+        // The first entry with a name is the one children refer to
+        m_entries_by_name.emplace(newEntry->m_name, newEntry.get());
     }
 
     return true;
@@ -172,14 +181,20 @@ bool GdtReader::AddEntry(Gdt& gdt, GdtEntry& entry) const
 
 GdtReader::GdtReader(std::istream& stream)
     : m_stream(stream),
-      m_char(0),
-      m_peeked(false),
+      m_position(nullptr),
+      m_end(nullptr),
       m_line(0)
 {
 }
 
 bool GdtReader::Read(Gdt& gdt)
 {
+    ReadBuffer();
+
+    m_entries_by_name.clear();
+    for (const auto& entry : gdt.m_entries)
+        m_entries_by_name.emplace(entry->m_name, entry.get());
+
     if (NextChar() != '{')
     {
         PrintError("Expected opening tag");
@@ -224,12 +239,13 @@ bool GdtReader::Read(Gdt& gdt)
                 PrintError("Expected closing square brackets");
                 return false;
             }
-            entry.m_parent = GetEntryByName(gdt, parentName);
-            if (entry.m_parent == nullptr)
+            const auto foundParent = m_entries_by_name.find(parentName);
+            if (foundParent == m_entries_by_name.end())
             {
                 PrintError("Could not find parent with name");
                 return false;
             }
+            entry.m_parent = foundParent->second;
             auto* currentParentEntry = entry.m_parent;
             while (currentParentEntry->m_parent)
                 currentParentEntry = currentParentEntry->m_parent;
@@ -2,21 +2,26 @@
 #include "Gdt.h"
 
 #include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
 class GdtReader
 {
     std::istream& m_stream;
-    char m_char;
-    bool m_peeked;
+    std::string m_buffer;
+    const char* m_position;
+    const char* m_end;
     int m_line;
+    std::unordered_map<std::string_view, GdtEntry*> m_entries_by_name;
 
-    static GdtEntry* GetEntryByName(const Gdt& gdt, const std::string& name);
     void PrintError(const std::string& message) const;
+    void ReadBuffer();
     int PeekChar();
     int NextChar();
     bool ReadStringContent(std::string& str);
     bool ReadProperties(GdtEntry& entry);
-    bool AddEntry(Gdt& gdt, GdtEntry& entry) const;
+    bool AddEntry(Gdt& gdt, GdtEntry& entry);
 
 public:
     explicit GdtReader(std::istream& stream);
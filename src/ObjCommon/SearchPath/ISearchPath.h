@@ -4,6 +4,7 @@
 #include "Utils/ClassUtils.h"
 
 #include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <istream>
 #include <memory>
@@ -14,11 +15,14 @@ class SearchPathOpenFile
 public:
     std::unique_ptr<std::istream> m_stream;
     int64_t m_length;
+    // The path of the file on disk if it was opened from the filesystem, otherwise empty
+    std::filesystem::path m_file_path;
 
     _NODISCARD bool IsOpen() const;
 
     SearchPathOpenFile();
     SearchPathOpenFile(std::unique_ptr<std::istream> stream, int64_t length);
+    SearchPathOpenFile(std::unique_ptr<std::istream> stream, int64_t length, std::filesystem::path filePath);
 };
 
 class ISearchPath
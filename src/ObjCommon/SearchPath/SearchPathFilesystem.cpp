@@ -25,7 +25,7 @@ SearchPathOpenFile SearchPathFilesystem::Open(const std::string& fileName)
     std::ifstream file(filePath.string(), std::fstream::in | std::fstream::binary);
 
     if (file.is_open())
-        return SearchPathOpenFile(std::make_unique<std::ifstream>(std::move(file)), static_cast<int64_t>(file_size(filePath)));
+        return SearchPathOpenFile(std::make_unique<std::ifstream>(std::move(file)), static_cast<int64_t>(file_size(filePath)), filePath);
 
     return SearchPathOpenFile();
 }
@@ -0,0 +1,39 @@
+#include "SearchPathSynchronized.h"
+
+#include <sstream>
+
+SearchPathSynchronized::SearchPathSynchronized(ISearchPath& searchPath)
+    : m_search_path(searchPath)
+{
+}
+
+SearchPathOpenFile SearchPathSynchronized::Open(const std::string& fileName)
+{
+    std::lock_guard lock(m_mutex);
+
+    auto file = m_search_path.Open(fileName);
+    if (!file.IsOpen())
+        return SearchPathOpenFile();
+
+    // Files on disk have their own stream and can be read from any thread
+    if (!file.m_file_path.empty())
+        return file;
+
+    std::ostringstream ss;
+    ss << file.m_stream->rdbuf();
+    auto data = std::move(ss).str();
+    const auto length = static_cast<int64_t>(data.size());
+
+    return SearchPathOpenFile(std::make_unique<std::istringstream>(std::move(data)), length, std::move(file.m_file_path));
+}
+
+const std::string& SearchPathSynchronized::GetPath()
+{
+    return m_search_path.GetPath();
+}
+
+void SearchPathSynchronized::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback)
+{
+    std::lock_guard lock(m_mutex);
+    m_search_path.Find(options, callback);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "ISearchPath.h"
+
+#include <mutex>
+#include <string>
+
+/**
+ * \brief Makes a search path usable from multiple threads at once.
+ * Opened files that are not on disk are read into memory completely before being returned since some search paths like iwds can only have one file open
+ * at a time.
+ */
+class SearchPathSynchronized final : public ISearchPath
+{
+    ISearchPath& m_search_path;
+    std::mutex m_mutex;
+
+public:
+    explicit SearchPathSynchronized(ISearchPath& searchPath);
+
+    SearchPathOpenFile Open(const std::string& fileName) override;
+    const std::string& GetPath() override;
+    void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+};
@@ -1,9 +1,11 @@
 #include "D3D9ShaderAnalyser.h"
 
+#include "Utils/ConcurrentCache.h"
 #include "Utils/FileUtils.h"
 
 #include <cassert>
 #include <cstring>
+#include <string>
 
 using namespace d3d9;
 
@@ -248,3 +250,18 @@ std::unique_ptr<ShaderInfo> ShaderAnalyser::GetShaderInfo(const void* shaderByte
 
     return shaderInfo;
 }
+
+const ShaderInfo* ShaderAnalyser::GetCachedShaderInfo(const void* shaderByteCode, const size_t shaderByteCodeSize)
+{
+    // Failed analyses are cached as well so broken shaders are not analysed again
+    static ConcurrentCache<std::string, ShaderInfo> cachedShaderInfo(true);
+
+    if (shaderByteCode == nullptr || shaderByteCodeSize == 0)
+        return nullptr;
+
+    return cachedShaderInfo.GetOrCreate(std::string(static_cast<const char*>(shaderByteCode), shaderByteCodeSize),
+                                        [shaderByteCode, shaderByteCodeSize]
+                                        {
+                                            return GetShaderInfo(shaderByteCode, shaderByteCodeSize);
+                                        });
+}
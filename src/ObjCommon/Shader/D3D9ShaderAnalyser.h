@@ -96,5 +96,13 @@ namespace d3d9
     {
     public:
         static std::unique_ptr<ShaderInfo> GetShaderInfo(const void* shaderByteCode, size_t shaderByteCodeSize);
+
+        /**
+         * \brief Returns the shader info of the specified shader byte code from a process wide cache.
+         * The cache is keyed by the byte code itself, so the same shader is only analysed once no matter which zone or file it is loaded from.
+         * Can be called from multiple threads. The returned shader info stays valid until the process exits.
+         * \return The shader info or \c nullptr if the byte code could not be analysed.
+         */
+        static const ShaderInfo* GetCachedShaderInfo(const void* shaderByteCode, size_t shaderByteCodeSize);
     };
 } // namespace d3d9
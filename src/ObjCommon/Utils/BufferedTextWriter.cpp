@@ -0,0 +1,116 @@
+#include "BufferedTextWriter.h"
+
+#include <cassert>
+#include <charconv>
+#include <cstring>
+
+BufferedTextWriter::BufferedTextWriter(std::ostream& stream)
+    : m_stream(stream),
+      m_buffer(std::make_unique<char[]>(BUFFER_SIZE)),
+      m_buffer_pos(0u)
+{
+}
+
+BufferedTextWriter::~BufferedTextWriter()
+{
+    Flush();
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const std::string_view text)
+{
+    if (m_buffer_pos + text.size() > BUFFER_SIZE)
+    {
+        Flush();
+
+        // Text that does not fit into the buffer is written directly
+        if (text.size() > BUFFER_SIZE)
+        {
+            m_stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+            return *this;
+        }
+    }
+
+    std::memcpy(&m_buffer[m_buffer_pos], text.data(), text.size());
+    m_buffer_pos += text.size();
+
+    return *this;
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const char c)
+{
+    if (m_buffer_pos >= BUFFER_SIZE)
+        Flush();
+
+    m_buffer[m_buffer_pos++] = c;
+
+    return *this;
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const float value)
+{
+    auto* start = ReserveNumber();
+
+    // std::ostream formats floats like printf with %g and a precision of 6
+    const auto result = std::to_chars(start, &start[MAX_NUMBER_LENGTH], value, std::chars_format::general, 6);
+    assert(result.ec == std::errc());
+    m_buffer_pos += static_cast<size_t>(result.ptr - start);
+
+    return *this;
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const Fixed value)
+{
+    auto* start = ReserveNumber();
+
+    const auto result = std::to_chars(start, &start[MAX_NUMBER_LENGTH], value.value, std::chars_format::fixed, value.precision);
+    assert(result.ec == std::errc());
+    m_buffer_pos += static_cast<size_t>(result.ptr - start);
+
+    return *this;
+}
+
+BufferedTextWriter& BufferedTextWriter::operator<<(const Shortest value)
+{
+    auto* start = ReserveNumber();
+
+    const auto result = std::to_chars(start, &start[MAX_NUMBER_LENGTH], value.value);
+    assert(result.ec == std::errc());
+    m_buffer_pos += static_cast<size_t>(result.ptr - start);
+
+    return *this;
+}
+
+void BufferedTextWriter::Flush()
+{
+    if (m_buffer_pos == 0u)
+        return;
+
+    m_stream.write(m_buffer.get(), static_cast<std::streamsize>(m_buffer_pos));
+    m_buffer_pos = 0u;
+}
+
+char* BufferedTextWriter::ReserveNumber()
+{
+    if (m_buffer_pos + MAX_NUMBER_LENGTH > BUFFER_SIZE)
+        Flush();
+
+    return &m_buffer[m_buffer_pos];
+}
+
+void BufferedTextWriter::WriteInteger(const long long value)
+{
+    auto* start = ReserveNumber();
+
+    const auto result = std::to_chars(start, &start[MAX_NUMBER_LENGTH], value);
+    assert(result.ec == std::errc());
+    m_buffer_pos += static_cast<size_t>(result.ptr - start);
+}
+
+void BufferedTextWriter::WriteInteger(const unsigned long long value)
+{
+    auto* start = ReserveNumber();
+
+    const auto result = std::to_chars(start, &start[MAX_NUMBER_LENGTH], value);
+    assert(result.ec == std::errc());
+    m_buffer_pos += static_cast<size_t>(result.ptr - start);
+}
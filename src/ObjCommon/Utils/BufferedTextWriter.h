@@ -0,0 +1,72 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * \brief Formats text into a local buffer and writes it to the underlying stream in large chunks.
+ * Numbers are formatted with std::to_chars and produce the same text as writing them to a std::ostream or through std::format.
+ */
+class BufferedTextWriter
+{
+public:
+    /**
+     * \brief Formats a float like std::format("{:.6f}") with the specified precision.
+     */
+    struct Fixed
+    {
+        float value;
+        int precision = 6;
+    };
+
+    /**
+     * \brief Formats a float as the shortest text that reads back as the same value like std::format("{}").
+     */
+    struct Shortest
+    {
+        float value;
+    };
+
+    explicit BufferedTextWriter(std::ostream& stream);
+    ~BufferedTextWriter();
+    BufferedTextWriter(const BufferedTextWriter& other) = delete;
+    BufferedTextWriter(BufferedTextWriter&& other) noexcept = delete;
+    BufferedTextWriter& operator=(const BufferedTextWriter& other) = delete;
+    BufferedTextWriter& operator=(BufferedTextWriter&& other) noexcept = delete;
+
+    BufferedTextWriter& operator<<(std::string_view text);
+    BufferedTextWriter& operator<<(char c);
+
+    /**
+     * \brief Formats a float the same way a std::ostream with default settings does.
+     */
+    BufferedTextWriter& operator<<(float value);
+    BufferedTextWriter& operator<<(Fixed value);
+    BufferedTextWriter& operator<<(Shortest value);
+
+    template<std::integral T>
+        requires(!std::same_as<T, char> && !std::same_as<T, bool>)
+    BufferedTextWriter& operator<<(const T value)
+    {
+        WriteInteger(static_cast<std::conditional_t<std::signed_integral<T>, long long, unsigned long long>>(value));
+        return *this;
+    }
+
+    void Flush();
+
+private:
+    static constexpr size_t BUFFER_SIZE = 0x10000;
+    static constexpr size_t MAX_NUMBER_LENGTH = 128;
+
+    char* ReserveNumber();
+    void WriteInteger(long long value);
+    void WriteInteger(unsigned long long value);
+
+    std::ostream& m_stream;
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_buffer_pos;
+};
@@ -1,82 +1,186 @@
 #include "IwdCreator.h"
 
 #include "Utils/FileToZlibWrapper.h"
+#include "Utils/ThreadPool.h"
 
 #include <chrono>
+#include <cstdint>
+#include <deque>
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <zip.h>
+#include <zlib.h>
 
-IwdToCreate::IwdToCreate(std::string name)
-    : m_name(std::move(name))
+namespace
 {
-}
+    // Limits the amount of read and compressed entries that are kept in memory at the same time
+    constexpr auto MAX_IN_FLIGHT_ENTRIES_PER_THREAD = 4u;
 
-void IwdToCreate::AddFile(std::string filePath)
-{
-    m_file_paths.emplace_back(std::move(filePath));
-}
+    // Same settings minizip uses when compressing entries itself
+    constexpr auto DEFLATE_MEM_LEVEL = 8;
 
-void IwdToCreate::Build(ISearchPath& searchPath, IOutputPath& outPath)
-{
-    const auto fileName = std::format("{}.iwd", m_name);
-    const auto file = outPath.Open(fileName);
-    if (!file)
+    class CompressedIwdEntry
     {
-        std::cerr << std::format("Failed to open file for iwd {}\n", m_name);
-        return;
-    }
+    public:
+        CompressedIwdEntry()
+            : m_success(false),
+              m_crc32(0u),
+              m_uncompressed_size(0u)
+        {
+        }
 
-    auto functions = FileToZlibWrapper::CreateFunctions32ForFile(file.get());
+        bool m_success;
+        std::vector<std::uint8_t> m_compressed_data;
+        uLong m_crc32;
+        uLong m_uncompressed_size;
+    };
 
-    const auto zipFile = zipOpen2(fileName.c_str(), APPEND_STATUS_CREATE, nullptr, &functions);
-    if (!zipFile)
+    bool ReadEntryData(ISearchPath& searchPath, std::mutex& searchPathMutex, const std::string& filePath, std::vector<std::uint8_t>& data)
     {
-        std::cerr << std::format("Failed to open file as zip for iwd {}\n", m_name);
-        return;
-    }
+        // Search paths are not required to be thread safe
+        std::lock_guard lock(searchPathMutex);
 
-    for (const auto& filePath : m_file_paths)
-    {
-        auto readFile = searchPath.Open(filePath);
+        const auto readFile = searchPath.Open(filePath);
         if (!readFile.IsOpen())
+            return false;
+
+        if (readFile.m_length >= 0)
         {
-            std::cerr << std::format("Failed to open file for iwd: {}\n", filePath);
-            continue;
+            data.resize(static_cast<size_t>(readFile.m_length));
+            readFile.m_stream->read(reinterpret_cast<char*>(data.data()), readFile.m_length);
+            data.resize(static_cast<size_t>(readFile.m_stream->gcount()));
+            return true;
         }
 
-        auto localNow = std::chrono::zoned_time{std::chrono::current_zone(), std::chrono::system_clock::now()}.get_local_time();
-        auto nowDays = std::chrono::floor<std::chrono::days>(localNow);
-        std::chrono::year_month_day ymd(std::chrono::floor<std::chrono::days>(localNow));
-        std::chrono::hh_mm_ss hms(std::chrono::floor<std::chrono::milliseconds>(localNow - nowDays));
-
-        zip_fileinfo fileInfo{};
-        fileInfo.dosDate = 0u;
-        fileInfo.tmz_date.tm_year = static_cast<int>(ymd.year());
-        fileInfo.tmz_date.tm_mon = static_cast<int>(static_cast<unsigned>(ymd.month()) - static_cast<unsigned>(std::chrono::January));
-        fileInfo.tmz_date.tm_mday = static_cast<int>(static_cast<unsigned>(ymd.day()));
-        fileInfo.tmz_date.tm_hour = static_cast<int>(hms.hours().count());
-        fileInfo.tmz_date.tm_min = static_cast<int>(hms.minutes().count());
-        fileInfo.tmz_date.tm_sec = static_cast<int>(hms.seconds().count());
-        zipOpenNewFileInZip(zipFile, filePath.c_str(), &fileInfo, nullptr, 0, nullptr, 0, nullptr, Z_DEFLATED, Z_DEFAULT_COMPRESSION);
-
         char tempBuffer[0x1000];
-
         do
         {
             readFile.m_stream->read(tempBuffer, sizeof(tempBuffer));
             const auto readCount = readFile.m_stream->gcount();
             if (readCount > 0)
-                zipWriteInFileInZip(zipFile, tempBuffer, static_cast<unsigned>(readCount));
+                data.insert(data.end(), tempBuffer, tempBuffer + readCount);
         } while (!readFile.m_stream->eof());
 
-        zipCloseFileInZip(zipFile);
+        return true;
     }
 
-    zipClose(zipFile, nullptr);
+    CompressedIwdEntry CompressEntry(ISearchPath& searchPath, std::mutex& searchPathMutex, const std::string& filePath)
+    {
+        CompressedIwdEntry result;
+
+        std::vector<std::uint8_t> uncompressedData;
+        if (!ReadEntryData(searchPath, searchPathMutex, filePath, uncompressedData))
+            return result;
+
+        result.m_uncompressed_size = static_cast<uLong>(uncompressedData.size());
+        result.m_crc32 = crc32(0u, uncompressedData.data(), static_cast<uInt>(uncompressedData.size()));
+
+        z_stream zs{};
+        if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, DEFLATE_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
+            return result;
+
+        result.m_compressed_data.resize(deflateBound(&zs, static_cast<uLong>(uncompressedData.size())));
+
+        zs.next_in = uncompressedData.data();
+        zs.avail_in = static_cast<uInt>(uncompressedData.size());
+        zs.next_out = result.m_compressed_data.data();
+        zs.avail_out = static_cast<uInt>(result.m_compressed_data.size());
+
+        const auto deflateResult = deflate(&zs, Z_FINISH);
+        result.m_compressed_data.resize(zs.total_out);
+        deflateEnd(&zs);
+
+        result.m_success = deflateResult == Z_STREAM_END;
+        return result;
+    }
+
+    class IwdWriter
+    {
+    public:
+        IwdWriter(const std::string& iwdName, IOutputPath& outPath)
+            : m_zip_file(nullptr),
+              m_file_info{}
+        {
+            const auto fileName = std::format("{}.iwd", iwdName);
+            m_file = outPath.Open(fileName);
+            if (!m_file)
+            {
+                std::cerr << std::format("Failed to open file for iwd {}\n", iwdName);
+                return;
+            }
+
+            auto functions = FileToZlibWrapper::CreateFunctions32ForFile(m_file.get());
+
+            m_zip_file = zipOpen2(fileName.c_str(), APPEND_STATUS_CREATE, nullptr, &functions);
+            if (!m_zip_file)
+            {
+                std::cerr << std::format("Failed to open file as zip for iwd {}\n", iwdName);
+                return;
+            }
+
+            auto localNow = std::chrono::zoned_time{std::chrono::current_zone(), std::chrono::system_clock::now()}.get_local_time();
+            auto nowDays = std::chrono::floor<std::chrono::days>(localNow);
+            std::chrono::year_month_day ymd(std::chrono::floor<std::chrono::days>(localNow));
+            std::chrono::hh_mm_ss hms(std::chrono::floor<std::chrono::milliseconds>(localNow - nowDays));
+
+            m_file_info.dosDate = 0u;
+            m_file_info.tmz_date.tm_year = static_cast<int>(ymd.year());
+            m_file_info.tmz_date.tm_mon = static_cast<int>(static_cast<unsigned>(ymd.month()) - static_cast<unsigned>(std::chrono::January));
+            m_file_info.tmz_date.tm_mday = static_cast<int>(static_cast<unsigned>(ymd.day()));
+            m_file_info.tmz_date.tm_hour = static_cast<int>(hms.hours().count());
+            m_file_info.tmz_date.tm_min = static_cast<int>(hms.minutes().count());
+            m_file_info.tmz_date.tm_sec = static_cast<int>(hms.seconds().count());
+        }
+
+        ~IwdWriter()
+        {
+            if (m_zip_file)
+                zipClose(m_zip_file, nullptr);
+        }
+
+        IwdWriter(const IwdWriter& other) = delete;
+        IwdWriter(IwdWriter&& other) noexcept = delete;
+        IwdWriter& operator=(const IwdWriter& other) = delete;
+        IwdWriter& operator=(IwdWriter&& other) noexcept = delete;
 
-    std::cout << std::format("Created iwd {} with {} entries\n", m_name, m_file_paths.size());
+        [[nodiscard]] bool IsOpen() const
+        {
+            return m_zip_file != nullptr;
+        }
+
+        void WriteEntry(const std::string& filePath, const CompressedIwdEntry& entry) const
+        {
+            // The entry has already been deflated so minizip only has to write the raw data
+            zipOpenNewFileInZip2(m_zip_file, filePath.c_str(), &m_file_info, nullptr, 0, nullptr, 0, nullptr, Z_DEFLATED, Z_DEFAULT_COMPRESSION, 1);
+
+            if (!entry.m_compressed_data.empty())
+                zipWriteInFileInZip(m_zip_file, entry.m_compressed_data.data(), static_cast<unsigned>(entry.m_compressed_data.size()));
+
+            zipCloseFileInZipRaw(m_zip_file, entry.m_uncompressed_size, entry.m_crc32);
+        }
+
+    private:
+        std::unique_ptr<std::ostream> m_file;
+        zipFile m_zip_file;
+        zip_fileinfo m_file_info;
+    };
+} // namespace
+
+IwdToCreate::IwdToCreate(std::string name)
+    : m_name(std::move(name))
+{
+}
+
+void IwdToCreate::AddFile(std::string filePath)
+{
+    m_file_paths.emplace_back(std::move(filePath));
+}
+
+const std::string& IwdToCreate::GetName() const
+{
+    return m_name;
 }
 
 const std::vector<std::string>& IwdToCreate::GetFilePaths() const
@@ -101,8 +205,60 @@ IwdToCreate* IwdCreator::GetOrAddIwd(const std::string& iwdName)
 void IwdCreator::Finalize(ISearchPath& searchPath, IOutputPath& outPath)
 {
     std::cout << std::format("Writing {} iwd files to disk\n", m_iwds.size());
+
+    ThreadPool threadPool;
+    std::mutex searchPathMutex;
+    const auto maxInFlightEntries = threadPool.GetThreadCount() * MAX_IN_FLIGHT_ENTRIES_PER_THREAD;
+
+    // Entries are compressed ahead across iwd boundaries so the next iwd is already being built while the current one is written
+    std::deque<std::future<CompressedIwdEntry>> inFlightEntries;
+    std::size_t submitIwdIndex = 0u;
+    std::size_t submitFileIndex = 0u;
+    const auto submitEntries = [&]
+    {
+        while (inFlightEntries.size() < maxInFlightEntries && submitIwdIndex < m_iwds.size())
+        {
+            const auto& filePaths = m_iwds[submitIwdIndex]->GetFilePaths();
+            if (submitFileIndex >= filePaths.size())
+            {
+                submitIwdIndex++;
+                submitFileIndex = 0u;
+                continue;
+            }
+
+            const auto* filePath = &filePaths[submitFileIndex++];
+            inFlightEntries.emplace_back(threadPool.Submit(
+                [&searchPath, &searchPathMutex, filePath]
+                {
+                    return CompressEntry(searchPath, searchPathMutex, *filePath);
+                }));
+        }
+    };
+
     for (const auto& iwdToCreate : m_iwds)
-        iwdToCreate->Build(searchPath, outPath);
+    {
+        const IwdWriter writer(iwdToCreate->GetName(), outPath);
+
+        for (const auto& filePath : iwdToCreate->GetFilePaths())
+        {
+            submitEntries();
+
+            const auto entry = inFlightEntries.front().get();
+            inFlightEntries.pop_front();
+
+            if (!entry.m_success)
+            {
+                std::cerr << std::format("Failed to open file for iwd: {}\n", filePath);
+                continue;
+            }
+
+            if (writer.IsOpen())
+                writer.WriteEntry(filePath, entry);
+        }
+
+        if (writer.IsOpen())
+            std::cout << std::format("Created iwd {} with {} entries\n", iwdToCreate->GetName(), iwdToCreate->GetFilePaths().size());
+    }
 
     m_iwds.clear();
     m_iwd_lookup.clear();
@@ -14,7 +14,7 @@ public:
     explicit IwdToCreate(std::string name);
 
     void AddFile(std::string filePath);
-    void Build(ISearchPath& searchPath, IOutputPath& outPath);
+    [[nodiscard]] const std::string& GetName() const;
     [[nodiscard]] const std::vector<std::string>& GetFilePaths() const;
 
 private:
@@ -26,6 +26,13 @@ class IwdCreator final : public IZoneAssetCreationState
 {
 public:
     IwdToCreate* GetOrAddIwd(const std::string& iwdName);
+
+    /**
+     * \brief Writes all iwds to the output path.
+     * Entries are compressed concurrently but written in the order they were added, so the output is the same for identical input.
+     * \param searchPath The search path to read the entry files from.
+     * \param outPath The output path to write the iwd files to.
+     */
     void Finalize(ISearchPath& searchPath, IOutputPath& outPath);
 
 private:
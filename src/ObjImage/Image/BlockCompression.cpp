@@ -0,0 +1,807 @@
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <limits>
+#include <vector>
+
+using namespace bc;
+
+namespace
+{
+    constexpr auto CHANNEL_COUNT = 4u;
+    constexpr auto ALPHA_THRESHOLD = 128u;
+    constexpr auto POWER_ITERATION_COUNT = 8u;
+    constexpr auto LEAST_SQUARES_ITERATION_COUNT = 2u;
+    constexpr auto ALPHA_ENDPOINT_SEARCH_RADIUS = 4;
+    constexpr auto BLOCK_ROW_CHUNKS_PER_THREAD = 4u;
+
+    using Vec3 = std::array<float, 3>;
+
+    // ==============================================
+    // =============== Color blocks =================
+    // ==============================================
+
+    std::uint16_t PackColor565(const Vec3& color)
+    {
+        const auto r = static_cast<std::uint16_t>(std::clamp(std::lround(color[0] * 31.0f / 255.0f), 0l, 31l));
+        const auto g = static_cast<std::uint16_t>(std::clamp(std::lround(color[1] * 63.0f / 255.0f), 0l, 63l));
+        const auto b = static_cast<std::uint16_t>(std::clamp(std::lround(color[2] * 31.0f / 255.0f), 0l, 31l));
+
+        return static_cast<std::uint16_t>(r << 11 | g << 5 | b);
+    }
+
+    void UnpackColor565(const std::uint16_t color, std::uint8_t* rgb)
+    {
+        const auto r = static_cast<unsigned>(color >> 11 & 0x1F);
+        const auto g = static_cast<unsigned>(color >> 5 & 0x3F);
+        const auto b = static_cast<unsigned>(color & 0x1F);
+
+        rgb[0] = static_cast<std::uint8_t>(r << 3 | r >> 2);
+        rgb[1] = static_cast<std::uint8_t>(g << 2 | g >> 4);
+        rgb[2] = static_cast<std::uint8_t>(b << 3 | b >> 2);
+    }
+
+    void ComputeColorPalette(const std::uint16_t color0, const std::uint16_t color1, const bool fourColorMode, std::uint8_t (&palette)[4][CHANNEL_COUNT])
+    {
+        UnpackColor565(color0, palette[0]);
+        UnpackColor565(color1, palette[1]);
+        palette[0][3] = 0xFF;
+        palette[1][3] = 0xFF;
+
+        for (auto channel = 0u; channel < 3u; channel++)
+        {
+            const auto c0 = static_cast<unsigned>(palette[0][channel]);
+            const auto c1 = static_cast<unsigned>(palette[1][channel]);
+
+            if (fourColorMode)
+            {
+                palette[2][channel] = static_cast<std::uint8_t>((2u * c0 + c1 + 1u) / 3u);
+                palette[3][channel] = static_cast<std::uint8_t>((c0 + 2u * c1 + 1u) / 3u);
+            }
+            else
+            {
+                palette[2][channel] = static_cast<std::uint8_t>((c0 + c1 + 1u) / 2u);
+                palette[3][channel] = 0u;
+            }
+        }
+
+        palette[2][3] = 0xFF;
+        palette[3][3] = fourColorMode ? 0xFF : 0u;
+    }
+
+    void DecodeColorBlock(const std::uint8_t* block, std::uint8_t* pixels, const bool isBc1)
+    {
+        const auto color0 = static_cast<std::uint16_t>(block[0] | block[1] << 8);
+        const auto color1 = static_cast<std::uint16_t>(block[2] | block[3] << 8);
+        const auto indices = static_cast<std::uint32_t>(block[4] | block[5] << 8 | block[6] << 16 | block[7] << 24);
+
+        // Only BC1 supports the three color mode with transparency, all other formats always use four colors
+        std::uint8_t palette[4][CHANNEL_COUNT];
+        ComputeColorPalette(color0, color1, !isBc1 || color0 > color1, palette);
+
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            const auto index = indices >> (2u * i) & 0x3u;
+            std::memcpy(&pixels[i * CHANNEL_COUNT], palette[index], CHANNEL_COUNT);
+        }
+    }
+
+    class ColorBlock
+    {
+    public:
+        ColorBlock(const std::uint8_t* pixels, const bool allowTransparency)
+            : m_opaque_count(0u),
+              m_has_transparency(false)
+        {
+            for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            {
+                const auto* pixel = &pixels[i * CHANNEL_COUNT];
+                m_colors[i] = {static_cast<float>(pixel[0]), static_cast<float>(pixel[1]), static_cast<float>(pixel[2])};
+                m_transparent[i] = allowTransparency && pixel[3] < ALPHA_THRESHOLD;
+
+                if (m_transparent[i])
+                    m_has_transparency = true;
+                else
+                    m_opaque_count++;
+            }
+        }
+
+        void ComputeBoundingBoxEndpoints(Vec3& endpoint0, Vec3& endpoint1) const
+        {
+            Vec3 min{255.0f, 255.0f, 255.0f};
+            Vec3 max{0.0f, 0.0f, 0.0f};
+            Vec3 mean{};
+
+            for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            {
+                if (m_transparent[i])
+                    continue;
+
+                for (auto channel = 0u; channel < 3u; channel++)
+                {
+                    min[channel] = std::min(min[channel], m_colors[i][channel]);
+                    max[channel] = std::max(max[channel], m_colors[i][channel]);
+                    mean[channel] += m_colors[i][channel];
+                }
+            }
+
+            for (auto& value : mean)
+                value /= static_cast<float>(m_opaque_count);
+
+            // The bounding box has four diagonals, pick the one matching the correlation of the channels with the widest range
+            auto widestChannel = 0u;
+            for (auto channel = 1u; channel < 3u; channel++)
+            {
+                if (max[channel] - min[channel] > max[widestChannel] - min[widestChannel])
+                    widestChannel = channel;
+            }
+
+            for (auto channel = 0u; channel < 3u; channel++)
+            {
+                if (channel == widestChannel)
+                    continue;
+
+                auto covariance = 0.0f;
+                for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+                {
+                    if (!m_transparent[i])
+                        covariance += (m_colors[i][widestChannel] - mean[widestChannel]) * (m_colors[i][channel] - mean[channel]);
+                }
+
+                if (covariance < 0.0f)
+                    std::swap(min[channel], max[channel]);
+            }
+
+            // Inset the endpoints slightly since the interpolated colors cover the extremes well enough
+            for (auto channel = 0u; channel < 3u; channel++)
+            {
+                const auto inset = (max[channel] - min[channel]) / 16.0f;
+                endpoint0[channel] = max[channel] - inset;
+                endpoint1[channel] = min[channel] + inset;
+            }
+        }
+
+        void ComputePrincipalAxisEndpoints(Vec3& endpoint0, Vec3& endpoint1) const
+        {
+            Vec3 mean{};
+            for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            {
+                if (m_transparent[i])
+                    continue;
+
+                for (auto channel = 0u; channel < 3u; channel++)
+                    mean[channel] += m_colors[i][channel];
+            }
+
+            for (auto& value : mean)
+                value /= static_cast<float>(m_opaque_count);
+
+            float covariance[3][3]{};
+            for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            {
+                if (m_transparent[i])
+                    continue;
+
+                const Vec3 delta{m_colors[i][0] - mean[0], m_colors[i][1] - mean[1], m_colors[i][2] - mean[2]};
+                for (auto row = 0u; row < 3u; row++)
+                {
+                    for (auto column = 0u; column < 3u; column++)
+                        covariance[row][column] += delta[row] * delta[column];
+                }
+            }
+
+            Vec3 axis{1.0f, 1.0f, 1.0f};
+            for (auto iteration = 0u; iteration < POWER_ITERATION_COUNT; iteration++)
+            {
+                Vec3 nextAxis{};
+                for (auto row = 0u; row < 3u; row++)
+                    nextAxis[row] = covariance[row][0] * axis[0] + covariance[row][1] * axis[1] + covariance[row][2] * axis[2];
+
+                const auto length = std::sqrt(nextAxis[0] * nextAxis[0] + nextAxis[1] * nextAxis[1] + nextAxis[2] * nextAxis[2]);
+                if (length < std::numeric_limits<float>::epsilon())
+                {
+                    // All colors are the same
+                    endpoint0 = mean;
+                    endpoint1 = mean;
+                    return;
+                }
+
+                for (auto channel = 0u; channel < 3u; channel++)
+                    axis[channel] = nextAxis[channel] / length;
+            }
+
+            auto minProjection = std::numeric_limits<float>::max();
+            auto maxProjection = std::numeric_limits<float>::lowest();
+            for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            {
+                if (m_transparent[i])
+                    continue;
+
+                const auto projection = (m_colors[i][0] - mean[0]) * axis[0] + (m_colors[i][1] - mean[1]) * axis[1] + (m_colors[i][2] - mean[2]) * axis[2];
+                minProjection = std::min(minProjection, projection);
+                maxProjection = std::max(maxProjection, projection);
+            }
+
+            for (auto channel = 0u; channel < 3u; channel++)
+            {
+                endpoint0[channel] = std::clamp(mean[channel] + axis[channel] * maxProjection, 0.0f, 255.0f);
+                endpoint1[channel] = std::clamp(mean[channel] + axis[channel] * minProjection, 0.0f, 255.0f);
+            }
+        }
+
+        /**
+         * \brief Fits the block to the specified endpoints and assigns the closest palette index to each pixel.
+         * \return The squared error of the block.
+         */
+        float Fit(const Vec3& endpoint0,
+                  const Vec3& endpoint1,
+                  const bool isBc1,
+                  std::uint16_t& color0,
+                  std::uint16_t& color1,
+                  std::uint8_t (&indices)[PIXELS_PER_BLOCK]) const
+        {
+            color0 = PackColor565(endpoint0);
+            color1 = PackColor565(endpoint1);
+
+            // BC1 decides on the palette mode by the order of the endpoints.
+            // Transparency requires the three color mode while opaque blocks prefer the four color mode.
+            if (isBc1)
+            {
+                if (m_has_transparency == (color0 > color1))
+                    std::swap(color0, color1);
+            }
+            else if (color0 < color1)
+                std::swap(color0, color1);
+
+            const auto fourColorMode = !isBc1 || color0 > color1;
+            const auto usableColorCount = fourColorMode ? 4u : 3u;
+
+            std::uint8_t palette[4][CHANNEL_COUNT];
+            ComputeColorPalette(color0, color1, fourColorMode, palette);
+
+            auto error = 0.0f;
+            for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            {
+                if (m_transparent[i])
+                {
+                    indices[i] = 3u;
+                    continue;
+                }
+
+                auto bestIndex = 0u;
+                auto bestError = std::numeric_limits<float>::max();
+                for (auto paletteIndex = 0u; paletteIndex < usableColorCount; paletteIndex++)
+                {
+                    const auto dr = m_colors[i][0] - static_cast<float>(palette[paletteIndex][0]);
+                    const auto dg = m_colors[i][1] - static_cast<float>(palette[paletteIndex][1]);
+                    const auto db = m_colors[i][2] - static_cast<float>(palette[paletteIndex][2]);
+                    const auto paletteError = dr * dr + dg * dg + db * db;
+
+                    if (paletteError < bestError)
+                    {
+                        bestError = paletteError;
+                        bestIndex = paletteIndex;
+                    }
+                }
+
+                indices[i] = static_cast<std::uint8_t>(bestIndex);
+                error += bestError;
+            }
+
+            return error;
+        }
+
+        /**
+         * \brief Computes the endpoints that minimize the squared error for the current index assignment.
+         * \return \c true if the endpoints could be computed, otherwise \c false.
+         */
+        bool RefineEndpoints(const std::uint16_t color0,
+                             const std::uint16_t color1,
+                             const bool isBc1,
+                             const std::uint8_t (&indices)[PIXELS_PER_BLOCK],
+                             Vec3& endpoint0,
+                             Vec3& endpoint1) const
+        {
+            static constexpr float FOUR_COLOR_WEIGHTS[]{1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+            static constexpr float THREE_COLOR_WEIGHTS[]{1.0f, 0.0f, 0.5f, 0.0f};
+            const auto* weights = !isBc1 || color0 > color1 ? FOUR_COLOR_WEIGHTS : THREE_COLOR_WEIGHTS;
+
+            auto aa = 0.0f;
+            auto bb = 0.0f;
+            auto ab = 0.0f;
+            Vec3 ax{};
+            Vec3 bx{};
+
+            for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            {
+                if (m_transparent[i])
+                    continue;
+
+                const auto a = weights[indices[i]];
+                const auto b = 1.0f - a;
+
+                aa += a * a;
+                bb += b * b;
+                ab += a * b;
+
+                for (auto channel = 0u; channel < 3u; channel++)
+                {
+                    ax[channel] += a * m_colors[i][channel];
+                    bx[channel] += b * m_colors[i][channel];
+                }
+            }
+
+            const auto determinant = aa * bb - ab * ab;
+            if (std::abs(determinant) < std::numeric_limits<float>::epsilon())
+                return false;
+
+            for (auto channel = 0u; channel < 3u; channel++)
+            {
+                endpoint0[channel] = std::clamp((ax[channel] * bb - bx[channel] * ab) / determinant, 0.0f, 255.0f);
+                endpoint1[channel] = std::clamp((bx[channel] * aa - ax[channel] * ab) / determinant, 0.0f, 255.0f);
+            }
+
+            return true;
+        }
+
+        void Encode(std::uint8_t* block, const CompressionQuality quality, const bool isBc1) const
+        {
+            std::uint16_t color0 = 0u;
+            std::uint16_t color1 = 0u;
+            std::uint8_t indices[PIXELS_PER_BLOCK]{};
+
+            if (m_opaque_count == 0u)
+            {
+                std::ranges::fill(indices, static_cast<std::uint8_t>(3u));
+            }
+            else
+            {
+                Vec3 endpoint0{};
+                Vec3 endpoint1{};
+
+                if (quality == CompressionQuality::FAST)
+                    ComputeBoundingBoxEndpoints(endpoint0, endpoint1);
+                else
+                    ComputePrincipalAxisEndpoints(endpoint0, endpoint1);
+
+                auto error = Fit(endpoint0, endpoint1, isBc1, color0, color1, indices);
+
+                if (quality == CompressionQuality::HIGH)
+                {
+                    for (auto iteration = 0u; iteration < LEAST_SQUARES_ITERATION_COUNT && error > 0.0f; iteration++)
+                    {
+                        if (!RefineEndpoints(color0, color1, isBc1, indices, endpoint0, endpoint1))
+                            break;
+
+                        std::uint16_t refinedColor0;
+                        std::uint16_t refinedColor1;
+                        std::uint8_t refinedIndices[PIXELS_PER_BLOCK];
+                        const auto refinedError = Fit(endpoint0, endpoint1, isBc1, refinedColor0, refinedColor1, refinedIndices);
+                        if (refinedError >= error)
+                            break;
+
+                        error = refinedError;
+                        color0 = refinedColor0;
+                        color1 = refinedColor1;
+                        std::memcpy(indices, refinedIndices, sizeof(indices));
+                    }
+                }
+            }
+
+            std::uint32_t packedIndices = 0u;
+            for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+                packedIndices |= static_cast<std::uint32_t>(indices[i]) << (2u * i);
+
+            block[0] = static_cast<std::uint8_t>(color0);
+            block[1] = static_cast<std::uint8_t>(color0 >> 8);
+            block[2] = static_cast<std::uint8_t>(color1);
+            block[3] = static_cast<std::uint8_t>(color1 >> 8);
+            block[4] = static_cast<std::uint8_t>(packedIndices);
+            block[5] = static_cast<std::uint8_t>(packedIndices >> 8);
+            block[6] = static_cast<std::uint8_t>(packedIndices >> 16);
+            block[7] = static_cast<std::uint8_t>(packedIndices >> 24);
+        }
+
+    private:
+        Vec3 m_colors[PIXELS_PER_BLOCK];
+        bool m_transparent[PIXELS_PER_BLOCK];
+        unsigned m_opaque_count;
+        bool m_has_transparency;
+    };
+
+    // ==============================================
+    // =========== Interpolated channels ============
+    // ==============================================
+
+    void ComputeChannelPalette(const unsigned value0, const unsigned value1, std::uint8_t (&palette)[8])
+    {
+        palette[0] = static_cast<std::uint8_t>(value0);
+        palette[1] = static_cast<std::uint8_t>(value1);
+
+        if (value0 > value1)
+        {
+            for (auto i = 1u; i <= 6u; i++)
+                palette[i + 1u] = static_cast<std::uint8_t>(((7u - i) * value0 + i * value1 + 3u) / 7u);
+        }
+        else
+        {
+            for (auto i = 1u; i <= 4u; i++)
+                palette[i + 1u] = static_cast<std::uint8_t>(((5u - i) * value0 + i * value1 + 2u) / 5u);
+
+            palette[6] = 0u;
+            palette[7] = 0xFF;
+        }
+    }
+
+    void DecodeChannelBlock(const std::uint8_t* block, std::uint8_t* pixels, const unsigned channel)
+    {
+        std::uint8_t palette[8];
+        ComputeChannelPalette(block[0], block[1], palette);
+
+        std::uint64_t indices = 0u;
+        for (auto i = 0u; i < 6u; i++)
+            indices |= static_cast<std::uint64_t>(block[2u + i]) << (8u * i);
+
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            pixels[i * CHANNEL_COUNT + channel] = palette[indices >> (3u * i) & 0x7u];
+    }
+
+    unsigned FitChannel(const std::uint8_t (&values)[PIXELS_PER_BLOCK], const unsigned value0, const unsigned value1, std::uint8_t (&indices)[PIXELS_PER_BLOCK])
+    {
+        std::uint8_t palette[8];
+        ComputeChannelPalette(value0, value1, palette);
+
+        auto error = 0u;
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            auto bestIndex = 0u;
+            auto bestError = std::numeric_limits<unsigned>::max();
+            for (auto paletteIndex = 0u; paletteIndex < 8u; paletteIndex++)
+            {
+                const auto difference = static_cast<int>(values[i]) - static_cast<int>(palette[paletteIndex]);
+                const auto paletteError = static_cast<unsigned>(difference * difference);
+                if (paletteError < bestError)
+                {
+                    bestError = paletteError;
+                    bestIndex = paletteIndex;
+                }
+            }
+
+            indices[i] = static_cast<std::uint8_t>(bestIndex);
+            error += bestError;
+        }
+
+        return error;
+    }
+
+    void EncodeChannelBlock(const std::uint8_t* pixels, std::uint8_t* block, const unsigned channel, const CompressionQuality quality)
+    {
+        std::uint8_t values[PIXELS_PER_BLOCK];
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            values[i] = pixels[i * CHANNEL_COUNT + channel];
+
+        const auto [minIt, maxIt] = std::ranges::minmax_element(values);
+        const auto min = static_cast<unsigned>(*minIt);
+        const auto max = static_cast<unsigned>(*maxIt);
+
+        // Eight value mode spanning the whole range
+        auto bestValue0 = max;
+        auto bestValue1 = min;
+        std::uint8_t bestIndices[PIXELS_PER_BLOCK];
+        auto bestError = FitChannel(values, bestValue0, bestValue1, bestIndices);
+
+        const auto tryEndpoints = [&](const unsigned value0, const unsigned value1)
+        {
+            std::uint8_t indices[PIXELS_PER_BLOCK];
+            const auto error = FitChannel(values, value0, value1, indices);
+            if (error < bestError)
+            {
+                bestError = error;
+                bestValue0 = value0;
+                bestValue1 = value1;
+                std::memcpy(bestIndices, indices, sizeof(indices));
+            }
+        };
+
+        if (quality != CompressionQuality::FAST && bestError > 0u)
+        {
+            // Six value mode has explicit values for 0 and 255 so the endpoints only have to span the remaining values
+            auto innerMin = 0xFFu;
+            auto innerMax = 0u;
+            for (const auto value : values)
+            {
+                if (value == 0u || value == 0xFFu)
+                    continue;
+
+                innerMin = std::min(innerMin, static_cast<unsigned>(value));
+                innerMax = std::max(innerMax, static_cast<unsigned>(value));
+            }
+
+            if (innerMin <= innerMax)
+                tryEndpoints(innerMin, innerMax);
+        }
+
+        if (quality == CompressionQuality::HIGH && bestError > 0u && max > min)
+        {
+            for (auto offset0 = 0; offset0 <= ALPHA_ENDPOINT_SEARCH_RADIUS; offset0++)
+            {
+                for (auto offset1 = 0; offset1 <= ALPHA_ENDPOINT_SEARCH_RADIUS; offset1++)
+                {
+                    const auto value0 = static_cast<int>(max) - offset0;
+                    const auto value1 = static_cast<int>(min) + offset1;
+                    if (value0 > value1)
+                        tryEndpoints(static_cast<unsigned>(value0), static_cast<unsigned>(value1));
+                }
+            }
+        }
+
+        std::uint64_t packedIndices = 0u;
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            packedIndices |= static_cast<std::uint64_t>(bestIndices[i]) << (3u * i);
+
+        block[0] = static_cast<std::uint8_t>(bestValue0);
+        block[1] = static_cast<std::uint8_t>(bestValue1);
+        for (auto i = 0u; i < 6u; i++)
+            block[2u + i] = static_cast<std::uint8_t>(packedIndices >> (8u * i));
+    }
+
+    // ==============================================
+    // =============== Explicit alpha ===============
+    // ==============================================
+
+    void EncodeExplicitAlphaBlock(const std::uint8_t* pixels, std::uint8_t* block)
+    {
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i += 2u)
+        {
+            const auto alpha0 = (static_cast<unsigned>(pixels[i * CHANNEL_COUNT + 3u]) * 15u + 127u) / 255u;
+            const auto alpha1 = (static_cast<unsigned>(pixels[(i + 1u) * CHANNEL_COUNT + 3u]) * 15u + 127u) / 255u;
+            block[i / 2u] = static_cast<std::uint8_t>(alpha0 | alpha1 << 4);
+        }
+    }
+
+    void DecodeExplicitAlphaBlock(const std::uint8_t* block, std::uint8_t* pixels)
+    {
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            const auto alpha = static_cast<unsigned>(block[i / 2u] >> (4u * (i % 2u)) & 0xFu);
+            pixels[i * CHANNEL_COUNT + 3u] = static_cast<std::uint8_t>(alpha * 17u);
+        }
+    }
+
+    // ==============================================
+    // ================== Images ====================
+    // ==============================================
+
+    using EncodeBlockFunc = void (*)(const std::uint8_t* pixels, std::uint8_t* block, CompressionQuality quality);
+    using DecodeBlockFunc = void (*)(const std::uint8_t* block, std::uint8_t* pixels);
+
+    class FormatFunctions
+    {
+    public:
+        EncodeBlockFunc m_encode;
+        DecodeBlockFunc m_decode;
+        unsigned m_block_byte_size;
+    };
+
+    const FormatFunctions* GetFormatFunctions(const ImageFormatId formatId)
+    {
+        static constexpr FormatFunctions BC1_FUNCTIONS{EncodeBlockBC1, DecodeBlockBC1, 8u};
+        static constexpr FormatFunctions BC2_FUNCTIONS{EncodeBlockBC2, DecodeBlockBC2, 16u};
+        static constexpr FormatFunctions BC3_FUNCTIONS{EncodeBlockBC3, DecodeBlockBC3, 16u};
+        static constexpr FormatFunctions BC4_FUNCTIONS{EncodeBlockBC4, DecodeBlockBC4, 8u};
+        static constexpr FormatFunctions BC5_FUNCTIONS{EncodeBlockBC5, DecodeBlockBC5, 16u};
+
+        switch (formatId)
+        {
+        case ImageFormatId::BC1:
+            return &BC1_FUNCTIONS;
+        case ImageFormatId::BC2:
+            return &BC2_FUNCTIONS;
+        case ImageFormatId::BC3:
+            return &BC3_FUNCTIONS;
+        case ImageFormatId::BC4:
+            return &BC4_FUNCTIONS;
+        case ImageFormatId::BC5:
+            return &BC5_FUNCTIONS;
+        default:
+            return nullptr;
+        }
+    }
+
+    void ForEachBlockRowRange(const unsigned blockRowCount, ThreadPool* threadPool, const std::function<void(unsigned rowStart, unsigned rowEnd)>& func)
+    {
+        if (threadPool == nullptr || threadPool->GetThreadCount() <= 1u || blockRowCount <= 1u)
+        {
+            func(0u, blockRowCount);
+            return;
+        }
+
+        const auto chunkCount = std::min(blockRowCount, threadPool->GetThreadCount() * BLOCK_ROW_CHUNKS_PER_THREAD);
+        std::vector<std::future<void>> chunks;
+        chunks.reserve(chunkCount);
+
+        for (auto chunk = 0u; chunk < chunkCount; chunk++)
+        {
+            const auto rowStart = blockRowCount * chunk / chunkCount;
+            const auto rowEnd = blockRowCount * (chunk + 1u) / chunkCount;
+            chunks.emplace_back(threadPool->Submit(
+                [&func, rowStart, rowEnd]
+                {
+                    func(rowStart, rowEnd);
+                }));
+        }
+
+        for (auto& chunk : chunks)
+            chunk.get();
+    }
+} // namespace
+
+namespace bc
+{
+    void EncodeBlockBC1(const std::uint8_t* pixels, std::uint8_t* block, const CompressionQuality quality)
+    {
+        ColorBlock(pixels, true).Encode(block, quality, true);
+    }
+
+    void EncodeBlockBC2(const std::uint8_t* pixels, std::uint8_t* block, const CompressionQuality quality)
+    {
+        EncodeExplicitAlphaBlock(pixels, block);
+        ColorBlock(pixels, false).Encode(&block[8], quality, false);
+    }
+
+    void EncodeBlockBC3(const std::uint8_t* pixels, std::uint8_t* block, const CompressionQuality quality)
+    {
+        EncodeChannelBlock(pixels, block, 3u, quality);
+        ColorBlock(pixels, false).Encode(&block[8], quality, false);
+    }
+
+    void EncodeBlockBC4(const std::uint8_t* pixels, std::uint8_t* block, const CompressionQuality quality)
+    {
+        EncodeChannelBlock(pixels, block, 0u, quality);
+    }
+
+    void EncodeBlockBC5(const std::uint8_t* pixels, std::uint8_t* block, const CompressionQuality quality)
+    {
+        EncodeChannelBlock(pixels, block, 0u, quality);
+        EncodeChannelBlock(pixels, &block[8], 1u, quality);
+    }
+
+    void DecodeBlockBC1(const std::uint8_t* block, std::uint8_t* pixels)
+    {
+        DecodeColorBlock(block, pixels, true);
+    }
+
+    void DecodeBlockBC2(const std::uint8_t* block, std::uint8_t* pixels)
+    {
+        DecodeColorBlock(&block[8], pixels, false);
+        DecodeExplicitAlphaBlock(block, pixels);
+    }
+
+    void DecodeBlockBC3(const std::uint8_t* block, std::uint8_t* pixels)
+    {
+        DecodeColorBlock(&block[8], pixels, false);
+        DecodeChannelBlock(block, pixels, 3u);
+    }
+
+    void DecodeBlockBC4(const std::uint8_t* block, std::uint8_t* pixels)
+    {
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            pixels[i * CHANNEL_COUNT + 1u] = 0u;
+            pixels[i * CHANNEL_COUNT + 2u] = 0u;
+            pixels[i * CHANNEL_COUNT + 3u] = 0xFF;
+        }
+
+        DecodeChannelBlock(block, pixels, 0u);
+    }
+
+    void DecodeBlockBC5(const std::uint8_t* block, std::uint8_t* pixels)
+    {
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            pixels[i * CHANNEL_COUNT + 2u] = 0u;
+            pixels[i * CHANNEL_COUNT + 3u] = 0xFF;
+        }
+
+        DecodeChannelBlock(block, pixels, 0u);
+        DecodeChannelBlock(&block[8], pixels, 1u);
+    }
+
+    bool IsSupportedFormat(const ImageFormatId formatId)
+    {
+        return GetFormatFunctions(formatId) != nullptr;
+    }
+
+    bool Compress(const ImageFormatId formatId,
+                  const std::uint8_t* pixels,
+                  const unsigned width,
+                  const unsigned height,
+                  std::uint8_t* blocks,
+                  const CompressionQuality quality,
+                  ThreadPool* threadPool)
+    {
+        const auto* functions = GetFormatFunctions(formatId);
+        if (functions == nullptr)
+            return false;
+
+        const auto blockColumnCount = (width + BLOCK_SIZE - 1u) / BLOCK_SIZE;
+        const auto blockRowCount = (height + BLOCK_SIZE - 1u) / BLOCK_SIZE;
+
+        ForEachBlockRowRange(blockRowCount,
+                             threadPool,
+                             [&](const unsigned rowStart, const unsigned rowEnd)
+                             {
+                                 std::uint8_t blockPixels[PIXELS_PER_BLOCK * CHANNEL_COUNT];
+
+                                 for (auto blockRow = rowStart; blockRow < rowEnd; blockRow++)
+                                 {
+                                     for (auto blockColumn = 0u; blockColumn < blockColumnCount; blockColumn++)
+                                     {
+                                         // Blocks exceeding the image are padded by repeating the last row and column
+                                         for (auto y = 0u; y < BLOCK_SIZE; y++)
+                                         {
+                                             const auto sourceY = std::min(blockRow * BLOCK_SIZE + y, height - 1u);
+                                             for (auto x = 0u; x < BLOCK_SIZE; x++)
+                                             {
+                                                 const auto sourceX = std::min(blockColumn * BLOCK_SIZE + x, width - 1u);
+                                                 std::memcpy(&blockPixels[(y * BLOCK_SIZE + x) * CHANNEL_COUNT],
+                                                             &pixels[(static_cast<size_t>(sourceY) * width + sourceX) * CHANNEL_COUNT],
+                                                             CHANNEL_COUNT);
+                                             }
+                                         }
+
+                                         auto* block = &blocks[(static_cast<size_t>(blockRow) * blockColumnCount + blockColumn) * functions->m_block_byte_size];
+                                         functions->m_encode(blockPixels, block, quality);
+                                     }
+                                 }
+                             });
+
+        return true;
+    }
+
+    bool Decompress(
+        const ImageFormatId formatId, const std::uint8_t* blocks, const unsigned width, const unsigned height, std::uint8_t* pixels, ThreadPool* threadPool)
+    {
+        const auto* functions = GetFormatFunctions(formatId);
+        if (functions == nullptr)
+            return false;
+
+        const auto blockColumnCount = (width + BLOCK_SIZE - 1u) / BLOCK_SIZE;
+        const auto blockRowCount = (height + BLOCK_SIZE - 1u) / BLOCK_SIZE;
+
+        ForEachBlockRowRange(blockRowCount,
+                             threadPool,
+                             [&](const unsigned rowStart, const unsigned rowEnd)
+                             {
+                                 std::uint8_t blockPixels[PIXELS_PER_BLOCK * CHANNEL_COUNT];
+
+                                 for (auto blockRow = rowStart; blockRow < rowEnd; blockRow++)
+                                 {
+                                     for (auto blockColumn = 0u; blockColumn < blockColumnCount; blockColumn++)
+                                     {
+                                         const auto* block =
+                                             &blocks[(static_cast<size_t>(blockRow) * blockColumnCount + blockColumn) * functions->m_block_byte_size];
+                                         functions->m_decode(block, blockPixels);
+
+                                         const auto columnCount = std::min(BLOCK_SIZE, width - blockColumn * BLOCK_SIZE);
+                                         const auto rowCount = std::min(BLOCK_SIZE, height - blockRow * BLOCK_SIZE);
+                                         for (auto y = 0u; y < rowCount; y++)
+                                         {
+                                             const auto targetY = blockRow * BLOCK_SIZE + y;
+                                             std::memcpy(&pixels[(static_cast<size_t>(targetY) * width + blockColumn * BLOCK_SIZE) * CHANNEL_COUNT],
+                                                         &blockPixels[y * BLOCK_SIZE * CHANNEL_COUNT],
+                                                         columnCount * CHANNEL_COUNT);
+                                         }
+                                     }
+                                 }
+                             });
+
+        return true;
+    }
+} // namespace bc
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Image/ImageFormat.h"
+#include "Utils/ThreadPool.h"
+
+#include <cstdint>
+
+namespace bc
+{
+    enum class CompressionQuality : std::uint8_t
+    {
+        // Block endpoints are taken from the bounding box of the block colors
+        FAST,
+        // Block endpoints are taken along the principal axis of the block colors
+        NORMAL,
+        // Principal axis endpoints are refined by least squares fitting and exhaustive alpha endpoint search
+        HIGH
+    };
+
+    constexpr auto BLOCK_SIZE = 4u;
+    constexpr auto PIXELS_PER_BLOCK = BLOCK_SIZE * BLOCK_SIZE;
+
+    // All block functions take and return 16 pixels of R8G8B8A8 in row major order.
+    // BC4 and BC5 use the red respectively red and green channel and decode the remaining channels as 0 with full alpha.
+    void EncodeBlockBC1(const std::uint8_t* pixels, std::uint8_t* block, CompressionQuality quality);
+    void EncodeBlockBC2(const std::uint8_t* pixels, std::uint8_t* block, CompressionQuality quality);
+    void EncodeBlockBC3(const std::uint8_t* pixels, std::uint8_t* block, CompressionQuality quality);
+    void EncodeBlockBC4(const std::uint8_t* pixels, std::uint8_t* block, CompressionQuality quality);
+    void EncodeBlockBC5(const std::uint8_t* pixels, std::uint8_t* block, CompressionQuality quality);
+
+    void DecodeBlockBC1(const std::uint8_t* block, std::uint8_t* pixels);
+    void DecodeBlockBC2(const std::uint8_t* block, std::uint8_t* pixels);
+    void DecodeBlockBC3(const std::uint8_t* block, std::uint8_t* pixels);
+    void DecodeBlockBC4(const std::uint8_t* block, std::uint8_t* pixels);
+    void DecodeBlockBC5(const std::uint8_t* block, std::uint8_t* pixels);
+
+    [[nodiscard]] bool IsSupportedFormat(ImageFormatId formatId);
+
+    /**
+     * \brief Compresses an image of R8G8B8A8 pixels into blocks of the specified format.
+     * \param formatId The block compressed format to compress to.
+     * \param pixels The R8G8B8A8 pixels of the image.
+     * \param width The width of the image in pixels.
+     * \param height The height of the image in pixels.
+     * \param blocks The buffer to write the compressed blocks to. Must be large enough for all blocks of the image.
+     * \param quality The quality to compress the blocks with.
+     * \param threadPool An optional thread pool to compress rows of blocks on concurrently.
+     * \return \c true if the format is supported and the image was compressed, otherwise \c false.
+     */
+    bool Compress(ImageFormatId formatId,
+                  const std::uint8_t* pixels,
+                  unsigned width,
+                  unsigned height,
+                  std::uint8_t* blocks,
+                  CompressionQuality quality,
+                  ThreadPool* threadPool = nullptr);
+
+    /**
+     * \brief Decompresses blocks of the specified format into an image of R8G8B8A8 pixels.
+     * \param formatId The block compressed format to decompress from.
+     * \param blocks The compressed blocks of the image.
+     * \param width The width of the image in pixels.
+     * \param height The height of the image in pixels.
+     * \param pixels The buffer to write the R8G8B8A8 pixels to.
+     * \param threadPool An optional thread pool to decompress rows of blocks on concurrently.
+     * \return \c true if the format is supported and the image was decompressed, otherwise \c false.
+     */
+    bool Decompress(ImageFormatId formatId,
+                    const std::uint8_t* blocks,
+                    unsigned width,
+                    unsigned height,
+                    std::uint8_t* pixels,
+                    ThreadPool* threadPool = nullptr);
+} // namespace bc
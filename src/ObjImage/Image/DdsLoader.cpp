@@ -15,8 +15,9 @@ namespace dds
         static constexpr auto DDS_MAGIC = FileUtils::MakeMagic32('D', 'D', 'S', ' ');
 
     public:
-        explicit DdsLoaderInternal(std::istream& stream)
+        DdsLoaderInternal(std::istream& stream, std::ostream& errorStream)
             : m_stream(stream),
+              m_error_stream(errorStream),
               m_texture_type(TextureType::T_2D),
               m_has_mip_maps(false),
               m_width(0u),
@@ -41,13 +42,13 @@ namespace dds
             m_stream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
             if (m_stream.gcount() != sizeof(magic))
             {
-                std::cerr << "Failed to read dds data\n";
+                m_error_stream << "Failed to read dds data\n";
                 return false;
             }
 
             if (magic != DDS_MAGIC)
             {
-                std::cerr << "Invalid magic for dds\n";
+                m_error_stream << "Invalid magic for dds\n";
                 return false;
             }
 
@@ -60,7 +61,7 @@ namespace dds
             m_stream.read(reinterpret_cast<char*>(&headerDx10), sizeof(headerDx10));
             if (m_stream.gcount() != sizeof(headerDx10))
             {
-                std::cerr << "Failed to read dds data\n";
+                m_error_stream << "Failed to read dds data\n";
                 return false;
             }
 
@@ -81,7 +82,7 @@ namespace dds
             }
             else
             {
-                std::cerr << std::format("Unsupported dds resourceDimension {}\n", static_cast<unsigned>(headerDx10.resourceDimension));
+                m_error_stream << std::format("Unsupported dds resourceDimension {}\n", static_cast<unsigned>(headerDx10.resourceDimension));
                 return false;
             }
 
@@ -94,7 +95,7 @@ namespace dds
                 }
             }
 
-            std::cerr << std::format("Unsupported dds dxgi format {}\n", static_cast<unsigned>(headerDx10.dxgiFormat));
+            m_error_stream << std::format("Unsupported dds dxgi format {}\n", static_cast<unsigned>(headerDx10.dxgiFormat));
             return false;
         }
 
@@ -118,7 +119,7 @@ namespace dds
                 return ReadDxt10Header();
 
             default:
-                std::cerr << std::format("Unknown dds FourCC {}\n", pf.dwFourCC);
+                m_error_stream << std::format("Unknown dds FourCC {}\n", pf.dwFourCC);
                 return false;
             }
         }
@@ -169,7 +170,7 @@ namespace dds
                 }
             }
 
-            std::cerr << std::format(
+            m_error_stream << std::format(
                 "Failed to find dds pixel format: R={:#x} G={:#x} B={:#x} A={:#x}\n", pf.dwRBitMask, pf.dwGBitMask, pf.dwBBitMask, pf.dwABitMask);
 
             return false;
@@ -189,7 +190,7 @@ namespace dds
             m_stream.read(reinterpret_cast<char*>(&header), sizeof(header));
             if (m_stream.gcount() != sizeof(header))
             {
-                std::cerr << "Failed to read dds data\n";
+                m_error_stream << "Failed to read dds data\n";
                 return false;
             }
 
@@ -249,7 +250,7 @@ namespace dds
 
                     if (m_stream.gcount() != mipSize)
                     {
-                        std::cerr << "Failed to read texture data from dds\n";
+                        m_error_stream << "Failed to read texture data from dds\n";
                         return nullptr;
                     }
                 }
@@ -259,6 +260,7 @@ namespace dds
         }
 
         std::istream& m_stream;
+        std::ostream& m_error_stream;
 
         TextureType m_texture_type;
         bool m_has_mip_maps;
@@ -270,7 +272,12 @@ namespace dds
 
     std::unique_ptr<Texture> LoadDds(std::istream& stream)
     {
-        DdsLoaderInternal internal(stream);
+        return LoadDds(stream, std::cerr);
+    }
+
+    std::unique_ptr<Texture> LoadDds(std::istream& stream, std::ostream& errorStream)
+    {
+        DdsLoaderInternal internal(stream, errorStream);
         return internal.LoadDds();
     }
 } // namespace dds
@@ -4,8 +4,14 @@
 
 #include <istream>
 #include <memory>
+#include <ostream>
 
 namespace dds
 {
     std::unique_ptr<Texture> LoadDds(std::istream& stream);
+
+    /**
+     * \brief Loads a dds and prints any errors to the specified stream instead of \c std::cerr.
+     */
+    std::unique_ptr<Texture> LoadDds(std::istream& stream, std::ostream& errorStream);
 }
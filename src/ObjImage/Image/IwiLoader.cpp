@@ -9,7 +9,7 @@
 
 namespace iwi
 {
-    const ImageFormat* GetFormat6(int8_t format)
+    const ImageFormat* GetFormat6(int8_t format, std::ostream& errorStream)
     {
         switch (static_cast<iwi6::IwiFormat>(format))
         {
@@ -36,17 +36,17 @@ namespace iwi
         case iwi6::IwiFormat::IMG_FORMAT_WAVELET_LUMINANCE_ALPHA:
         case iwi6::IwiFormat::IMG_FORMAT_WAVELET_LUMINANCE:
         case iwi6::IwiFormat::IMG_FORMAT_WAVELET_ALPHA:
-            std::cerr << std::format("Unsupported IWI format: {}\n", format);
+            errorStream << std::format("Unsupported IWI format: {}\n", format);
             break;
         default:
-            std::cerr << std::format("Unknown IWI format: {}\n", format);
+            errorStream << std::format("Unknown IWI format: {}\n", format);
             break;
         }
 
         return nullptr;
     }
 
-    std::unique_ptr<Texture> LoadIwi6(std::istream& stream)
+    std::unique_ptr<Texture> LoadIwi6(std::istream& stream, std::ostream& errorStream)
     {
         iwi6::IwiHeader header{};
 
@@ -54,7 +54,7 @@ namespace iwi
         if (stream.gcount() != sizeof(header))
             return nullptr;
 
-        const auto* format = GetFormat6(header.format);
+        const auto* format = GetFormat6(header.format, errorStream);
         if (format == nullptr)
             return nullptr;
 
@@ -84,14 +84,14 @@ namespace iwi
             if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi6::IwiHeader::fileSizeForPicmip)>)
                 && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
             {
-                std::cerr << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
+                errorStream << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
                 return nullptr;
             }
 
             stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
             if (stream.gcount() != sizeOfMipLevel)
             {
-                std::cerr << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
+                errorStream << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
                 return nullptr;
             }
         }
@@ -99,7 +99,7 @@ namespace iwi
         return texture;
     }
 
-    const ImageFormat* GetFormat8(int8_t format)
+    const ImageFormat* GetFormat8(int8_t format, std::ostream& errorStream)
     {
         switch (static_cast<iwi8::IwiFormat>(format))
         {
@@ -134,17 +134,17 @@ namespace iwi
         case iwi8::IwiFormat::IMG_FORMAT_DXN_AS_LUMINANCE_ALPHA:
         case iwi8::IwiFormat::IMG_FORMAT_DXT1_AS_LUMINANCE:
         case iwi8::IwiFormat::IMG_FORMAT_DXT1_AS_ALPHA:
-            std::cerr << std::format("Unsupported IWI format: {}\n", format);
+            errorStream << std::format("Unsupported IWI format: {}\n", format);
             break;
         default:
-            std::cerr << std::format("Unknown IWI format: {}\n", format);
+            errorStream << std::format("Unknown IWI format: {}\n", format);
             break;
         }
 
         return nullptr;
     }
 
-    std::unique_ptr<Texture> LoadIwi8(std::istream& stream)
+    std::unique_ptr<Texture> LoadIwi8(std::istream& stream, std::ostream& errorStream)
     {
         iwi8::IwiHeader header{};
 
@@ -152,7 +152,7 @@ namespace iwi
         if (stream.gcount() != sizeof(header))
             return nullptr;
 
-        const auto* format = GetFormat8(header.format);
+        const auto* format = GetFormat8(header.format, errorStream);
         if (format == nullptr)
             return nullptr;
 
@@ -176,12 +176,12 @@ namespace iwi
         }
         else if ((header.flags & iwi8::IwiFlags::IMG_FLAG_MAPTYPE_MASK) == iwi8::IwiFlags::IMG_FLAG_MAPTYPE_1D)
         {
-            std::cerr << "Iwi has unsupported map type 1D\n";
+            errorStream << "Iwi has unsupported map type 1D\n";
             return nullptr;
         }
         else
         {
-            std::cerr << "Iwi has unsupported map type\n";
+            errorStream << "Iwi has unsupported map type\n";
             return nullptr;
         }
 
@@ -198,14 +198,14 @@ namespace iwi
             if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi8::IwiHeader::fileSizeForPicmip)>)
                 && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
             {
-                std::cerr << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
+                errorStream << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
                 return nullptr;
             }
 
             stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
             if (stream.gcount() != sizeOfMipLevel)
             {
-                std::cerr << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
+                errorStream << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
                 return nullptr;
             }
         }
@@ -213,7 +213,7 @@ namespace iwi
         return texture;
     }
 
-    const ImageFormat* GetFormat13(int8_t format)
+    const ImageFormat* GetFormat13(int8_t format, std::ostream& errorStream)
     {
         switch (static_cast<iwi13::IwiFormat>(format))
         {
@@ -245,17 +245,17 @@ namespace iwi
         case iwi13::IwiFormat::IMG_FORMAT_BITMAP_C8:
         case iwi13::IwiFormat::IMG_FORMAT_BITMAP_RGBA8:
         case iwi13::IwiFormat::IMG_FORMAT_A16B16G16R16F:
-            std::cerr << std::format("Unsupported IWI format: {}\n", format);
+            errorStream << std::format("Unsupported IWI format: {}\n", format);
             break;
         default:
-            std::cerr << std::format("Unknown IWI format: {}\n", format);
+            errorStream << std::format("Unknown IWI format: {}\n", format);
             break;
         }
 
         return nullptr;
     }
 
-    std::unique_ptr<Texture> LoadIwi13(std::istream& stream)
+    std::unique_ptr<Texture> LoadIwi13(std::istream& stream, std::ostream& errorStream)
     {
         iwi13::IwiHeader header{};
 
@@ -263,7 +263,7 @@ namespace iwi
         if (stream.gcount() != sizeof(header))
             return nullptr;
 
-        const auto* format = GetFormat6(header.format);
+        const auto* format = GetFormat6(header.format, errorStream);
         if (format == nullptr)
             return nullptr;
 
@@ -293,14 +293,14 @@ namespace iwi
             if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi13::IwiHeader::fileSizeForPicmip)>)
                 && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
             {
-                std::cerr << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
+                errorStream << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
                 return nullptr;
             }
 
             stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
             if (stream.gcount() != sizeOfMipLevel)
             {
-                std::cerr << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
+                errorStream << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
                 return nullptr;
             }
         }
@@ -308,7 +308,7 @@ namespace iwi
         return texture;
     }
 
-    const ImageFormat* GetFormat27(int8_t format)
+    const ImageFormat* GetFormat27(int8_t format, std::ostream& errorStream)
     {
         switch (static_cast<iwi27::IwiFormat>(format))
         {
@@ -342,17 +342,17 @@ namespace iwi
         case iwi27::IwiFormat::IMG_FORMAT_BITMAP_RGB5A3:
         case iwi27::IwiFormat::IMG_FORMAT_BITMAP_C8:
         case iwi27::IwiFormat::IMG_FORMAT_BITMAP_RGBA8:
-            std::cerr << std::format("Unsupported IWI format: {}\n", format);
+            errorStream << std::format("Unsupported IWI format: {}\n", format);
             break;
         default:
-            std::cerr << std::format("Unknown IWI format: {}\n", format);
+            errorStream << std::format("Unknown IWI format: {}\n", format);
             break;
         }
 
         return nullptr;
     }
 
-    std::unique_ptr<Texture> LoadIwi27(std::istream& stream)
+    std::unique_ptr<Texture> LoadIwi27(std::istream& stream, std::ostream& errorStream)
     {
         iwi27::IwiHeader header{};
 
@@ -360,7 +360,7 @@ namespace iwi
         if (stream.gcount() != sizeof(header))
             return nullptr;
 
-        const auto* format = GetFormat27(header.format);
+        const auto* format = GetFormat27(header.format, errorStream);
         if (format == nullptr)
             return nullptr;
 
@@ -390,14 +390,14 @@ namespace iwi
             if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi27::IwiHeader::fileSizeForPicmip)>)
                 && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
             {
-                std::cerr << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
+                errorStream << std::format("Iwi has invalid file size for picmip {}\n", currentMipLevel);
                 return nullptr;
             }
 
             stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
             if (stream.gcount() != sizeOfMipLevel)
             {
-                std::cerr << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
+                errorStream << std::format("Unexpected eof of iwi in mip level {}\n", currentMipLevel);
                 return nullptr;
             }
         }
@@ -406,6 +406,11 @@ namespace iwi
     }
 
     std::unique_ptr<Texture> LoadIwi(std::istream& stream)
+    {
+        return LoadIwi(stream, std::cerr);
+    }
+
+    std::unique_ptr<Texture> LoadIwi(std::istream& stream, std::ostream& errorStream)
     {
         IwiVersion iwiVersion{};
 
@@ -415,29 +420,29 @@ namespace iwi
 
         if (iwiVersion.tag[0] != 'I' || iwiVersion.tag[1] != 'W' || iwiVersion.tag[2] != 'i')
         {
-            std::cerr << "Invalid IWI magic\n";
+            errorStream << "Invalid IWI magic\n";
             return nullptr;
         }
 
         switch (iwiVersion.version)
         {
         case 6:
-            return LoadIwi6(stream);
+            return LoadIwi6(stream, errorStream);
 
         case 8:
-            return LoadIwi8(stream);
+            return LoadIwi8(stream, errorStream);
 
         case 13:
-            return LoadIwi13(stream);
+            return LoadIwi13(stream, errorStream);
 
         case 27:
-            return LoadIwi27(stream);
+            return LoadIwi27(stream, errorStream);
 
         default:
             break;
         }
 
-        std::cerr << std::format("Unknown IWI version {}\n", iwiVersion.version);
+        errorStream << std::format("Unknown IWI version {}\n", iwiVersion.version);
         return nullptr;
     }
 } // namespace iwi
@@ -4,8 +4,14 @@
 
 #include <istream>
 #include <memory>
+#include <ostream>
 
 namespace iwi
 {
     std::unique_ptr<Texture> LoadIwi(std::istream& stream);
+
+    /**
+     * \brief Loads an iwi and prints any errors to the specified stream instead of \c std::cerr.
+     */
+    std::unique_ptr<Texture> LoadIwi(std::istream& stream, std::ostream& errorStream);
 }; // namespace iwi
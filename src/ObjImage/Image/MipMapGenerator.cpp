@@ -0,0 +1,285 @@
+#include "MipMapGenerator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace mip;
+
+namespace
+{
+    constexpr auto KAISER_ALPHA = 4.0f;
+    constexpr auto KAISER_WIDTH = 3.0f;
+
+    class FilterTap
+    {
+    public:
+        unsigned m_source_index;
+        float m_weight;
+    };
+
+    class AxisFilter
+    {
+    public:
+        // Taps of all target texels, the taps of target texel i are located at [m_tap_offsets[i], m_tap_offsets[i + 1])
+        std::vector<unsigned> m_tap_offsets;
+        std::vector<FilterTap> m_taps;
+    };
+
+    float BesselI0(const float x)
+    {
+        const auto halfX = x / 2.0f;
+        auto sum = 1.0f;
+        auto term = 1.0f;
+
+        for (auto k = 1u; term > sum * 1e-7f; k++)
+        {
+            const auto factor = halfX / static_cast<float>(k);
+            term *= factor * factor;
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    float Sinc(const float x)
+    {
+        if (std::abs(x) < 1e-5f)
+            return 1.0f;
+
+        return std::sin(std::numbers::pi_v<float> * x) / (std::numbers::pi_v<float> * x);
+    }
+
+    float Kaiser(const float x)
+    {
+        const auto t = x / KAISER_WIDTH;
+        if (t <= -1.0f || t >= 1.0f)
+            return 0.0f;
+
+        return BesselI0(KAISER_ALPHA * std::sqrt(1.0f - t * t)) / BesselI0(KAISER_ALPHA);
+    }
+
+    void AddTap(std::vector<FilterTap>& taps, const unsigned sourceIndex, const float weight)
+    {
+        // Taps exceeding the source are clamped to the edge and merged with existing taps of the same texel
+        for (auto& tap : taps)
+        {
+            if (tap.m_source_index == sourceIndex)
+            {
+                tap.m_weight += weight;
+                return;
+            }
+        }
+
+        taps.emplace_back(sourceIndex, weight);
+    }
+
+    AxisFilter CreateAxisFilter(const unsigned sourceSize, const unsigned targetSize, const MipFilter filter)
+    {
+        AxisFilter axisFilter;
+        axisFilter.m_tap_offsets.reserve(targetSize + 1u);
+
+        const auto scale = static_cast<float>(sourceSize) / static_cast<float>(targetSize);
+        const auto radius = filter == MipFilter::BOX ? scale / 2.0f : KAISER_WIDTH * scale;
+
+        std::vector<FilterTap> taps;
+        for (auto targetIndex = 0u; targetIndex < targetSize; targetIndex++)
+        {
+            taps.clear();
+
+            const auto center = (static_cast<float>(targetIndex) + 0.5f) * scale;
+            const auto first = static_cast<int>(std::floor(center - radius));
+            const auto last = static_cast<int>(std::ceil(center + radius));
+
+            auto weightSum = 0.0f;
+            for (auto sourceIndex = first; sourceIndex < last; sourceIndex++)
+            {
+                float weight;
+                if (filter == MipFilter::BOX)
+                {
+                    const auto coverageStart = std::max(static_cast<float>(sourceIndex), center - radius);
+                    const auto coverageEnd = std::min(static_cast<float>(sourceIndex + 1), center + radius);
+                    weight = std::max(coverageEnd - coverageStart, 0.0f);
+                }
+                else
+                {
+                    const auto x = (static_cast<float>(sourceIndex) + 0.5f - center) / scale;
+                    weight = Sinc(x) * Kaiser(x);
+                }
+
+                if (weight == 0.0f)
+                    continue;
+
+                AddTap(taps, static_cast<unsigned>(std::clamp(sourceIndex, 0, static_cast<int>(sourceSize) - 1)), weight);
+                weightSum += weight;
+            }
+
+            axisFilter.m_tap_offsets.emplace_back(static_cast<unsigned>(axisFilter.m_taps.size()));
+            for (const auto& tap : taps)
+                axisFilter.m_taps.emplace_back(tap.m_source_index, tap.m_weight / weightSum);
+        }
+
+        axisFilter.m_tap_offsets.emplace_back(static_cast<unsigned>(axisFilter.m_taps.size()));
+
+        return axisFilter;
+    }
+
+    class Extent
+    {
+    public:
+        unsigned m_size[3];
+
+        [[nodiscard]] size_t Count() const
+        {
+            return static_cast<size_t>(m_size[0]) * m_size[1] * m_size[2];
+        }
+    };
+
+    /**
+     * \brief Resamples a texel buffer along one axis.
+     * \return The extent of the resampled buffer.
+     */
+    Extent ResampleAxis(const std::vector<float>& source,
+                        const Extent& sourceExtent,
+                        std::vector<float>& target,
+                        const unsigned axis,
+                        const unsigned targetSize,
+                        const unsigned channelCount,
+                        const MipFilter filter)
+    {
+        auto targetExtent = sourceExtent;
+        targetExtent.m_size[axis] = targetSize;
+        target.assign(targetExtent.Count() * channelCount, 0.0f);
+
+        const auto axisFilter = CreateAxisFilter(sourceExtent.m_size[axis], targetSize, filter);
+
+        const size_t sourceStrides[]{channelCount,
+                                     static_cast<size_t>(sourceExtent.m_size[0]) * channelCount,
+                                     static_cast<size_t>(sourceExtent.m_size[0]) * sourceExtent.m_size[1] * channelCount};
+        const size_t targetStrides[]{channelCount,
+                                     static_cast<size_t>(targetExtent.m_size[0]) * channelCount,
+                                     static_cast<size_t>(targetExtent.m_size[0]) * targetExtent.m_size[1] * channelCount};
+
+        for (auto z = 0u; z < targetExtent.m_size[2]; z++)
+        {
+            for (auto y = 0u; y < targetExtent.m_size[1]; y++)
+            {
+                for (auto x = 0u; x < targetExtent.m_size[0]; x++)
+                {
+                    const unsigned coordinates[]{x, y, z};
+                    const auto targetOffset = x * targetStrides[0] + y * targetStrides[1] + z * targetStrides[2];
+                    size_t sourceBaseOffset = 0u;
+                    for (auto otherAxis = 0u; otherAxis < 3u; otherAxis++)
+                    {
+                        if (otherAxis != axis)
+                            sourceBaseOffset += coordinates[otherAxis] * sourceStrides[otherAxis];
+                    }
+
+                    const auto targetIndex = coordinates[axis];
+                    for (auto tapIndex = axisFilter.m_tap_offsets[targetIndex]; tapIndex < axisFilter.m_tap_offsets[targetIndex + 1u]; tapIndex++)
+                    {
+                        const auto& tap = axisFilter.m_taps[tapIndex];
+                        const auto sourceOffset = sourceBaseOffset + tap.m_source_index * sourceStrides[axis];
+
+                        for (auto channel = 0u; channel < channelCount; channel++)
+                            target[targetOffset + channel] += source[sourceOffset + channel] * tap.m_weight;
+                    }
+                }
+            }
+        }
+
+        return targetExtent;
+    }
+
+    void GenerateMipLevel(const std::uint8_t* source,
+                          const Extent& sourceExtent,
+                          std::uint8_t* target,
+                          const Extent& targetExtent,
+                          const unsigned channelCount,
+                          const MipFilter filter)
+    {
+        std::vector<float> buffer(source, source + sourceExtent.Count() * channelCount);
+        std::vector<float> resampledBuffer;
+
+        auto extent = sourceExtent;
+        for (auto axis = 0u; axis < 3u; axis++)
+        {
+            if (extent.m_size[axis] == targetExtent.m_size[axis])
+                continue;
+
+            extent = ResampleAxis(buffer, extent, resampledBuffer, axis, targetExtent.m_size[axis], channelCount, filter);
+            std::swap(buffer, resampledBuffer);
+        }
+
+        assert(buffer.size() == targetExtent.Count() * channelCount);
+        std::ranges::transform(buffer,
+                               target,
+                               [](const float value)
+                               {
+                                   return static_cast<std::uint8_t>(std::clamp(std::lround(value), 0l, 255l));
+                               });
+    }
+
+    Extent GetMipExtent(const Texture& texture, const int mipLevel)
+    {
+        // Cube faces are generated separately so only 3D textures have depth
+        const auto depth = texture.GetTextureType() == TextureType::T_3D ? texture.GetDepth() : 1u;
+
+        return Extent{
+            {std::max(texture.GetWidth() >> mipLevel, 1u), std::max(texture.GetHeight() >> mipLevel, 1u), std::max(depth >> mipLevel, 1u)}
+        };
+    }
+} // namespace
+
+namespace mip
+{
+    bool SupportsImageFormat(const ImageFormat* format)
+    {
+        // The float format is declared as unsigned but cannot be filtered byte wise
+        if (format->GetType() != ImageFormatType::UNSIGNED || format->GetId() == ImageFormatId::R16_G16_B16_A16_FLOAT)
+            return false;
+
+        const auto* unsignedFormat = dynamic_cast<const ImageFormatUnsigned*>(format);
+        if (unsignedFormat->m_bits_per_pixel % 8u != 0u)
+            return false;
+
+        const auto isByteChannel = [](const unsigned offset, const unsigned size)
+        {
+            return size == 0u || (size == 8u && offset % 8u == 0u);
+        };
+
+        return isByteChannel(unsignedFormat->m_r_offset, unsignedFormat->m_r_size) && isByteChannel(unsignedFormat->m_g_offset, unsignedFormat->m_g_size)
+               && isByteChannel(unsignedFormat->m_b_offset, unsignedFormat->m_b_size) && isByteChannel(unsignedFormat->m_a_offset, unsignedFormat->m_a_size);
+    }
+
+    bool GenerateMipMaps(Texture& texture, const MipFilter filter)
+    {
+        if (!texture.HasMipMaps() || texture.Empty() || !SupportsImageFormat(texture.GetFormat()))
+            return false;
+
+        // Every byte is its own channel so padding bytes are filtered as well which does not hurt
+        const auto channelCount = dynamic_cast<const ImageFormatUnsigned*>(texture.GetFormat())->m_bits_per_pixel / 8u;
+        const auto mipCount = texture.GetMipMapCount();
+        const auto faceCount = texture.GetFaceCount();
+
+        for (auto mipLevel = 1; mipLevel < mipCount; mipLevel++)
+        {
+            const auto sourceExtent = GetMipExtent(texture, mipLevel - 1);
+            const auto targetExtent = GetMipExtent(texture, mipLevel);
+
+            for (auto face = 0; face < faceCount; face++)
+            {
+                GenerateMipLevel(texture.GetBufferForMipLevel(mipLevel - 1, face),
+                                 sourceExtent,
+                                 texture.GetBufferForMipLevel(mipLevel, face),
+                                 targetExtent,
+                                 channelCount,
+                                 filter);
+            }
+        }
+
+        return true;
+    }
+} // namespace mip
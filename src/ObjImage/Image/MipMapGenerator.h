@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Image/Texture.h"
+
+#include <cstdint>
+
+namespace mip
+{
+    enum class MipFilter : std::uint8_t
+    {
+        // Averages all texels covered by the target texel
+        BOX,
+        // Kaiser windowed sinc, keeps more detail in lower mip levels at the cost of slight ringing
+        KAISER
+    };
+
+    /**
+     * \brief Checks whether mip maps can be generated for textures of the specified format.
+     * Only unsigned formats with byte sized channels are supported.
+     */
+    [[nodiscard]] bool SupportsImageFormat(const ImageFormat* format);
+
+    /**
+     * \brief Generates all mip levels of a texture from its first mip level.
+     * \param texture The texture to generate mip levels for. Must be allocated and have mip maps.
+     * \param filter The filter to downsample each mip level with.
+     * \return \c true if the mip levels have been generated, otherwise \c false.
+     */
+    bool GenerateMipMaps(Texture& texture, MipFilter filter);
+} // namespace mip
@@ -1,6 +1,8 @@
 #include "TextureConverter.h"
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 constexpr uint64_t TextureConverter::Mask1(const unsigned length)
 {
@@ -105,36 +107,47 @@ void TextureConverter::SetPixelFunctions(const unsigned inBitCount, const unsign
 }
 
 TextureConverter::TextureConverter(const Texture* inputTexture, const ImageFormat* targetFormat)
+    : TextureConverter(inputTexture, targetFormat, bc::CompressionQuality::NORMAL)
+{
+}
+
+TextureConverter::TextureConverter(const Texture* inputTexture, const ImageFormat* targetFormat, const bc::CompressionQuality quality, ThreadPool* threadPool)
     : m_input_texture(inputTexture),
       m_output_texture(nullptr),
       m_input_format(inputTexture->GetFormat()),
-      m_output_format(targetFormat)
+      m_output_format(targetFormat),
+      m_quality(quality),
+      m_thread_pool(threadPool)
 {
 }
 
-void TextureConverter::CreateOutputTexture()
+void TextureConverter::GenerateMipMaps(const mip::MipFilter filter)
+{
+    m_mip_filter = filter;
+}
+
+std::unique_ptr<Texture> TextureConverter::CreateTexture(const ImageFormat* format, const bool mipMaps) const
 {
     switch (m_input_texture->GetTextureType())
     {
     case TextureType::T_2D:
-        m_output_texture =
-            std::make_unique<Texture2D>(m_output_format, m_input_texture->GetWidth(), m_input_texture->GetHeight(), m_input_texture->HasMipMaps());
-        break;
+        return std::make_unique<Texture2D>(format, m_input_texture->GetWidth(), m_input_texture->GetHeight(), mipMaps);
 
     case TextureType::T_CUBE:
-        m_output_texture =
-            std::make_unique<TextureCube>(m_output_format, m_input_texture->GetWidth(), m_input_texture->GetHeight(), m_input_texture->HasMipMaps());
-        break;
+        return std::make_unique<TextureCube>(format, m_input_texture->GetWidth(), m_input_texture->GetHeight(), mipMaps);
 
     case TextureType::T_3D:
-        m_output_texture = std::make_unique<Texture3D>(
-            m_output_format, m_input_texture->GetWidth(), m_input_texture->GetHeight(), m_input_texture->GetDepth(), m_input_texture->HasMipMaps());
-        break;
+        return std::make_unique<Texture3D>(format, m_input_texture->GetWidth(), m_input_texture->GetHeight(), m_input_texture->GetDepth(), mipMaps);
+
     default:
         assert(false);
-        break;
+        return nullptr;
     }
+}
 
+void TextureConverter::CreateOutputTexture()
+{
+    m_output_texture = CreateTexture(m_output_format, m_input_texture->HasMipMaps() || m_mip_filter.has_value());
     m_output_texture->Allocate();
 }
 
@@ -204,14 +217,199 @@ void TextureConverter::ConvertUnsignedToUnsigned()
     }
 }
 
+void TextureConverter::ReadRgba8(const uint8_t* input, uint8_t* output, const unsigned width, const unsigned height)
+{
+    if (m_input_format->GetType() == ImageFormatType::BLOCK_COMPRESSED)
+    {
+        bc::Decompress(m_input_format->GetId(), input, width, height, output, m_thread_pool);
+        return;
+    }
+
+    const auto* inputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_input_format);
+    const unsigned offsets[]{inputFormat->m_r_offset, inputFormat->m_g_offset, inputFormat->m_b_offset, inputFormat->m_a_offset};
+    const unsigned sizes[]{inputFormat->m_r_size, inputFormat->m_g_size, inputFormat->m_b_size, inputFormat->m_a_size};
+    const auto inputBytePerPixel = inputFormat->m_bits_per_pixel / 8;
+    const auto pixelCount = static_cast<size_t>(width) * height;
+
+    for (auto pixelIndex = 0u; pixelIndex < pixelCount; pixelIndex++)
+    {
+        const auto inPixel = m_read_pixel_func(&input[pixelIndex * inputBytePerPixel], inputFormat->m_bits_per_pixel);
+
+        for (auto channel = 0u; channel < 4u; channel++)
+        {
+            // Missing color channels are black, missing alpha is opaque
+            if (sizes[channel] == 0)
+            {
+                output[pixelIndex * 4u + channel] = channel == 3u ? 0xFF : 0u;
+                continue;
+            }
+
+            const auto maxValue = Mask1(sizes[channel]);
+            const auto value = inPixel >> offsets[channel] & maxValue;
+            output[pixelIndex * 4u + channel] = static_cast<uint8_t>((value * 0xFF + maxValue / 2) / maxValue);
+        }
+    }
+}
+
+void TextureConverter::WriteRgba8(const uint8_t* input, uint8_t* output, const unsigned width, const unsigned height)
+{
+    if (m_output_format->GetType() == ImageFormatType::BLOCK_COMPRESSED)
+    {
+        bc::Compress(m_output_format->GetId(), input, width, height, output, m_quality, m_thread_pool);
+        return;
+    }
+
+    const auto* outputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_output_format);
+    const unsigned offsets[]{outputFormat->m_r_offset, outputFormat->m_g_offset, outputFormat->m_b_offset, outputFormat->m_a_offset};
+    const unsigned sizes[]{outputFormat->m_r_size, outputFormat->m_g_size, outputFormat->m_b_size, outputFormat->m_a_size};
+    const auto outputBytePerPixel = outputFormat->m_bits_per_pixel / 8;
+    const auto pixelCount = static_cast<size_t>(width) * height;
+
+    for (auto pixelIndex = 0u; pixelIndex < pixelCount; pixelIndex++)
+    {
+        uint64_t outPixel = 0;
+
+        for (auto channel = 0u; channel < 4u; channel++)
+        {
+            if (sizes[channel] == 0)
+                continue;
+
+            const auto maxValue = Mask1(sizes[channel]);
+            const auto value = (static_cast<uint64_t>(input[pixelIndex * 4u + channel]) * maxValue + 0x7F) / 0xFF;
+            outPixel |= value << offsets[channel];
+        }
+
+        m_write_pixel_func(&output[pixelIndex * outputBytePerPixel], outPixel, outputFormat->m_bits_per_pixel);
+    }
+}
+
+void TextureConverter::ConvertThroughRgba8()
+{
+    const auto* inputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_input_format);
+    const auto* outputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_output_format);
+
+    assert(!inputFormat || inputFormat->m_bits_per_pixel <= 64);
+    assert(!outputFormat || outputFormat->m_bits_per_pixel <= 64);
+
+    SetPixelFunctions(inputFormat ? inputFormat->m_bits_per_pixel : 32, outputFormat ? outputFormat->m_bits_per_pixel : 32);
+
+    const auto mipCount = m_input_texture->HasMipMaps() ? m_input_texture->GetMipMapCount() : 1;
+    const auto faceCount = m_input_texture->GetFaceCount();
+    const auto width = m_input_texture->GetWidth();
+    const auto height = m_input_texture->GetHeight();
+    const auto depth = m_input_texture->GetTextureType() == TextureType::T_3D ? m_input_texture->GetDepth() : 1u;
+
+    std::vector<uint8_t> rgbaBuffer;
+    for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+    {
+        const auto mipWidth = std::max(width >> mipLevel, 1u);
+        const auto mipHeight = std::max(height >> mipLevel, 1u);
+        const auto mipDepth = std::max(depth >> mipLevel, 1u);
+        const auto inputSliceSize = m_input_format->GetSizeOfMipLevel(mipLevel, width, height, 1);
+        const auto outputSliceSize = m_output_format->GetSizeOfMipLevel(mipLevel, width, height, 1);
+
+        rgbaBuffer.resize(static_cast<size_t>(mipWidth) * mipHeight * 4u);
+
+        for (auto face = 0; face < faceCount; face++)
+        {
+            const auto* inputBuffer = m_input_texture->GetBufferForMipLevel(mipLevel, face);
+            auto* outputBuffer = m_output_texture->GetBufferForMipLevel(mipLevel, face);
+
+            for (auto slice = 0u; slice < mipDepth; slice++)
+            {
+                ReadRgba8(&inputBuffer[slice * inputSliceSize], rgbaBuffer.data(), mipWidth, mipHeight);
+                WriteRgba8(rgbaBuffer.data(), &outputBuffer[slice * outputSliceSize], mipWidth, mipHeight);
+            }
+        }
+    }
+}
+
+void TextureConverter::ConvertWithGeneratedMipMaps()
+{
+    const auto* inputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_input_format);
+    const auto* outputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_output_format);
+
+    assert(!inputFormat || inputFormat->m_bits_per_pixel <= 64);
+    assert(!outputFormat || outputFormat->m_bits_per_pixel <= 64);
+
+    SetPixelFunctions(inputFormat ? inputFormat->m_bits_per_pixel : 32, outputFormat ? outputFormat->m_bits_per_pixel : 32);
+
+    // The mip levels are generated in R8G8B8A8 from the first mip level and then converted to the output format
+    const auto rgbaTexture = CreateTexture(&ImageFormat::FORMAT_R8_G8_B8_A8, true);
+    rgbaTexture->Allocate();
+
+    const auto faceCount = m_input_texture->GetFaceCount();
+    const auto width = m_input_texture->GetWidth();
+    const auto height = m_input_texture->GetHeight();
+    const auto depth = m_input_texture->GetTextureType() == TextureType::T_3D ? m_input_texture->GetDepth() : 1u;
+
+    const auto inputSliceSize = m_input_format->GetSizeOfMipLevel(0, width, height, 1);
+    const auto rgbaSliceSize = ImageFormat::FORMAT_R8_G8_B8_A8.GetSizeOfMipLevel(0, width, height, 1);
+    for (auto face = 0; face < faceCount; face++)
+    {
+        const auto* inputBuffer = m_input_texture->GetBufferForMipLevel(0, face);
+        auto* rgbaBuffer = rgbaTexture->GetBufferForMipLevel(0, face);
+
+        for (auto slice = 0u; slice < depth; slice++)
+            ReadRgba8(&inputBuffer[slice * inputSliceSize], &rgbaBuffer[slice * rgbaSliceSize], width, height);
+    }
+
+    mip::GenerateMipMaps(*rgbaTexture, *m_mip_filter);
+
+    const auto mipCount = m_output_texture->GetMipMapCount();
+    for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+    {
+        const auto mipWidth = std::max(width >> mipLevel, 1u);
+        const auto mipHeight = std::max(height >> mipLevel, 1u);
+        const auto mipDepth = std::max(depth >> mipLevel, 1u);
+        const auto mipRgbaSliceSize = ImageFormat::FORMAT_R8_G8_B8_A8.GetSizeOfMipLevel(mipLevel, width, height, 1);
+        const auto outputSliceSize = m_output_format->GetSizeOfMipLevel(mipLevel, width, height, 1);
+
+        for (auto face = 0; face < faceCount; face++)
+        {
+            const auto* rgbaBuffer = rgbaTexture->GetBufferForMipLevel(mipLevel, face);
+            auto* outputBuffer = m_output_texture->GetBufferForMipLevel(mipLevel, face);
+
+            for (auto slice = 0u; slice < mipDepth; slice++)
+                WriteRgba8(&rgbaBuffer[slice * mipRgbaSliceSize], &outputBuffer[slice * outputSliceSize], mipWidth, mipHeight);
+        }
+    }
+}
+
+bool TextureConverter::SupportsRgba8Conversion(const ImageFormat* format)
+{
+    if (format->GetType() == ImageFormatType::BLOCK_COMPRESSED)
+        return bc::IsSupportedFormat(format->GetId());
+
+    // The float format is declared as unsigned but its channels cannot be read as unsigned integers
+    return format->GetType() == ImageFormatType::UNSIGNED && format->GetId() != ImageFormatId::R16_G16_B16_A16_FLOAT;
+}
+
 std::unique_ptr<Texture> TextureConverter::Convert()
 {
+    const auto canConvertThroughRgba8 = SupportsRgba8Conversion(m_input_format) && SupportsRgba8Conversion(m_output_format);
+
+    // Generating mip maps and block compression always go through R8G8B8A8
+    if (!canConvertThroughRgba8 && (m_mip_filter || m_input_format->GetType() == ImageFormatType::BLOCK_COMPRESSED
+                                    || m_output_format->GetType() == ImageFormatType::BLOCK_COMPRESSED))
+    {
+        return nullptr;
+    }
+
     CreateOutputTexture();
 
-    if (m_input_format->GetType() == ImageFormatType::UNSIGNED && m_output_format->GetType() == ImageFormatType::UNSIGNED)
+    if (m_mip_filter)
+    {
+        ConvertWithGeneratedMipMaps();
+    }
+    else if (m_input_format->GetType() == ImageFormatType::UNSIGNED && m_output_format->GetType() == ImageFormatType::UNSIGNED)
     {
         ConvertUnsignedToUnsigned();
     }
+    else if (canConvertThroughRgba8)
+    {
+        ConvertThroughRgba8();
+    }
     else
     {
         // Unsupported as of now
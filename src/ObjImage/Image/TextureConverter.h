@@ -1,26 +1,52 @@
 #pragma once
 
+#include "BlockCompression.h"
+#include "MipMapGenerator.h"
 #include "Texture.h"
+#include "Utils/ThreadPool.h"
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 class TextureConverter
 {
 public:
     TextureConverter(const Texture* inputTexture, const ImageFormat* targetFormat);
-
+    TextureConverter(const Texture* inputTexture, const ImageFormat* targetFormat, bc::CompressionQuality quality, ThreadPool* threadPool = nullptr);
+
+    /**
+     * \brief Makes the converter generate all mip levels of the output texture from the first mip level of the input texture
+     * instead of converting the mip levels the input texture already has.
+     * \param filter The filter to downsample each mip level with.
+     */
+    void GenerateMipMaps(mip::MipFilter filter);
+
+    /**
+     * \brief Checks whether textures of a format can be block compressed, decompressed or have their mip maps generated.
+     */
+    [[nodiscard]] static bool SupportsRgba8Conversion(const ImageFormat* format);
+
+    /**
+     * \return The converted texture or \c nullptr if the formats of the conversion do not support it.
+     */
     std::unique_ptr<Texture> Convert();
 
 private:
     static constexpr uint64_t Mask1(unsigned length);
     void SetPixelFunctions(unsigned inBitCount, unsigned outBitCount);
 
+    [[nodiscard]] std::unique_ptr<Texture> CreateTexture(const ImageFormat* format, bool mipMaps) const;
     void CreateOutputTexture();
 
     void ReorderUnsignedToUnsigned() const;
     void ConvertUnsignedToUnsigned();
 
+    void ReadRgba8(const uint8_t* input, uint8_t* output, unsigned width, unsigned height);
+    void WriteRgba8(const uint8_t* input, uint8_t* output, unsigned width, unsigned height);
+    void ConvertThroughRgba8();
+    void ConvertWithGeneratedMipMaps();
+
     std::function<uint64_t(const void* offset, unsigned bitCount)> m_read_pixel_func;
     std::function<void(void* offset, uint64_t pixel, unsigned bitCount)> m_write_pixel_func;
 
@@ -28,4 +54,7 @@ private:
     std::unique_ptr<Texture> m_output_texture;
     const ImageFormat* m_input_format;
     const ImageFormat* m_output_format;
+    bc::CompressionQuality m_quality;
+    ThreadPool* m_thread_pool;
+    std::optional<mip::MipFilter> m_mip_filter;
 };
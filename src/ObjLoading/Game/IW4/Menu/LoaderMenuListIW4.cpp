@@ -4,11 +4,13 @@
 #include "Game/IW4/Menu/MenuConversionZoneStateIW4.h"
 #include "Game/IW4/Menu/MenuConverterIW4.h"
 #include "ObjLoading.h"
+#include "Parsing/Menu/MenuFileBatchReader.h"
 #include "Parsing/Menu/MenuFileReader.h"
 
 #include <cstring>
 #include <format>
 #include <iostream>
+#include <unordered_set>
 
 using namespace IW4;
 
@@ -54,11 +56,16 @@ namespace
                     return AssetCreationResult::Failure();
             }
 
+            // Parse all menu files of the list concurrently, the results are still converted in the order of the list
+            menu::MenuFileBatchReader batchReader(
+                menu::FeatureLevel::IW4, ObjLoading::Configuration.MenuPermissiveParsing, m_search_path, ObjLoading::Configuration.LoadingThreadCount);
+            batchReader.ReadMenuFiles(GetMenuFilesToRead(menuLoadQueue, conversionState), zoneState);
+
             while (!menuLoadQueue.empty())
             {
                 const auto& menuFileToLoad = menuLoadQueue.front();
 
-                LoadMenuFileFromQueue(menuFileToLoad, context, zoneState, conversionState, menus, registration);
+                LoadMenuFileFromQueue(menuFileToLoad, batchReader, context, zoneState, conversionState, menus, registration);
 
                 menuLoadQueue.pop_front();
             }
@@ -78,7 +85,25 @@ namespace
         }
 
     private:
+        static std::vector<std::string> GetMenuFilesToRead(const std::deque<std::string>& menuLoadQueue, const MenuConversionZoneState& conversionState)
+        {
+            std::vector<std::string> menuFilesToRead;
+            std::unordered_set<std::string> queuedMenuFiles;
+
+            for (const auto& menuFilePath : menuLoadQueue)
+            {
+                if (conversionState.m_menus_by_filename.contains(menuFilePath))
+                    continue;
+
+                if (queuedMenuFiles.emplace(menuFilePath).second)
+                    menuFilesToRead.emplace_back(menuFilePath);
+            }
+
+            return menuFilesToRead;
+        }
+
         bool LoadMenuFileFromQueue(const std::string& menuFilePath,
+                                   menu::MenuFileBatchReader& batchReader,
                                    AssetCreationContext& context,
                                    menu::MenuAssetZoneState& zoneState,
                                    MenuConversionZoneState& conversionState,
@@ -97,14 +122,14 @@ namespace
                 return true;
             }
 
-            const auto file = m_search_path.Open(menuFilePath);
-            if (!file.IsOpen())
+            const auto fileResult = batchReader.TakeResult(menuFilePath, zoneState);
+            if (!fileResult.m_opened)
             {
                 std::cerr << std::format("Could not open menu file \"{}\"\n", menuFilePath);
                 return false;
             }
 
-            const auto menuFileResult = ParseMenuFile(*file.m_stream, menuFilePath, zoneState);
+            const auto& menuFileResult = fileResult.m_parsing_result;
             if (menuFileResult)
             {
                 ProcessParsedResults(menuFilePath, context, *menuFileResult, zoneState, conversionState, menus, registration);
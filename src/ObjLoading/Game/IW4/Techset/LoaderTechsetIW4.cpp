@@ -5,11 +5,9 @@
 #include "Game/IW4/Shader/LoaderVertexShaderIW4.h"
 #include "Game/IW4/TechsetConstantsIW4.h"
 #include "Shader/D3D9ShaderAnalyser.h"
-#include "StateMap/StateMapReader.h"
 #include "Techset/TechniqueFileReader.h"
 #include "Techset/TechniqueStateMapCache.h"
 #include "Techset/TechsetDefinitionCache.h"
-#include "Techset/TechsetFileReader.h"
 #include "Utils/Alignment.h"
 
 #include <algorithm>
@@ -90,7 +88,7 @@ namespace
         {
             const auto cachedShaderInfo = m_cached_shader_info.find(fileName);
             if (cachedShaderInfo != m_cached_shader_info.end())
-                return cachedShaderInfo->second.get();
+                return cachedShaderInfo->second;
 
             const auto file = searchPath.Open(fileName);
             if (!file.IsOpen())
@@ -107,17 +105,17 @@ namespace
             const auto shaderData = std::make_unique<char[]>(shaderSize);
             file.m_stream->read(shaderData.get(), static_cast<std::streamsize>(shaderSize));
 
-            auto shaderInfo = d3d9::ShaderAnalyser::GetShaderInfo(shaderData.get(), shaderSize);
+            // The analysis itself is cached process wide by shader content, so other zones that load the same shader do not analyse it again
+            const auto* shaderInfo = d3d9::ShaderAnalyser::GetCachedShaderInfo(shaderData.get(), shaderSize);
             if (!shaderInfo)
                 return nullptr;
 
-            const auto* result = shaderInfo.get();
-            m_cached_shader_info.emplace(std::make_pair(fileName, std::move(shaderInfo)));
-            return result;
+            m_cached_shader_info.emplace(std::make_pair(fileName, shaderInfo));
+            return shaderInfo;
         }
 
     private:
-        std::unordered_map<std::string, std::unique_ptr<d3d9::ShaderInfo>> m_cached_shader_info;
+        std::unordered_map<std::string, const d3d9::ShaderInfo*> m_cached_shader_info;
     };
 
     class TechniqueCreator final : public techset::ITechniqueDefinitionAcceptor
@@ -181,13 +179,11 @@ namespace
 
             XAssetInfo<MaterialVertexShader>* m_vertex_shader;
             const d3d9::ShaderInfo* m_vertex_shader_info;
-            std::unique_ptr<d3d9::ShaderInfo> m_vertex_shader_info_unq;
             std::vector<size_t> m_vertex_shader_argument_handled_offset;
             std::vector<bool> m_handled_vertex_shader_arguments;
 
             XAssetInfo<MaterialPixelShader>* m_pixel_shader;
             const d3d9::ShaderInfo* m_pixel_shader_info;
-            std::unique_ptr<d3d9::ShaderInfo> m_pixel_shader_info_unq;
             std::vector<size_t> m_pixel_shader_argument_handled_offset;
             std::vector<bool> m_handled_pixel_shader_arguments;
 
@@ -465,8 +461,7 @@ namespace
             else
             {
                 const auto& shaderLoadDef = pass.m_vertex_shader->Asset()->prog.loadDef;
-                pass.m_vertex_shader_info_unq = d3d9::ShaderAnalyser::GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
-                pass.m_vertex_shader_info = pass.m_vertex_shader_info_unq.get();
+                pass.m_vertex_shader_info = d3d9::ShaderAnalyser::GetCachedShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
             }
 
             if (!pass.m_vertex_shader_info)
@@ -500,8 +495,7 @@ namespace
             else
             {
                 const auto& shaderLoadDef = pass.m_pixel_shader->Asset()->prog.loadDef;
-                pass.m_pixel_shader_info_unq = d3d9::ShaderAnalyser::GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
-                pass.m_pixel_shader_info = pass.m_pixel_shader_info_unq.get();
+                pass.m_pixel_shader_info = d3d9::ShaderAnalyser::GetCachedShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
             }
 
             if (!pass.m_pixel_shader_info)
@@ -1309,11 +1303,11 @@ namespace
             return AssetCreationResult::Success(context.AddAsset(std::move(registration)));
         }
 
-        techset::TechsetDefinition* LoadTechsetDefinition(const std::string& assetName, AssetCreationContext& context, bool& failure) override
+        const techset::TechsetDefinition* LoadTechsetDefinition(const std::string& assetName, AssetCreationContext& context, bool& failure) override
         {
             failure = false;
             auto& definitionCache = context.GetZoneAssetCreationState<techset::TechsetDefinitionCache>();
-            auto* cachedTechsetDefinition = definitionCache.GetCachedTechsetDefinition(assetName);
+            const auto* cachedTechsetDefinition = definitionCache.GetCachedTechsetDefinition(assetName);
             if (cachedTechsetDefinition)
                 return cachedTechsetDefinition;
 
@@ -1322,25 +1316,23 @@ namespace
             if (!file.IsOpen())
                 return nullptr;
 
-            const techset::TechsetFileReader reader(*file.m_stream, techsetFileName, techniqueTypeNames, std::extent_v<decltype(techniqueTypeNames)>);
-            auto techsetDefinition = reader.ReadTechsetDefinition();
+            const auto* techsetDefinition = techset::TechsetDefinitionCache::ReadTechsetDefinition(
+                *file.m_stream, techsetFileName, techniqueTypeNames, std::extent_v<decltype(techniqueTypeNames)>);
             if (!techsetDefinition)
             {
                 failure = true;
                 return nullptr;
             }
 
-            auto* techsetDefinitionPtr = techsetDefinition.get();
+            definitionCache.AddTechsetDefinitionToCache(assetName, techsetDefinition);
 
-            definitionCache.AddTechsetDefinitionToCache(assetName, std::move(techsetDefinition));
-
-            return techsetDefinitionPtr;
+            return techsetDefinition;
         }
 
         const state_map::StateMapDefinition* LoadStateMapDefinition(const std::string& stateMapName, AssetCreationContext& context) override
         {
             auto& stateMapCache = context.GetZoneAssetCreationState<techset::TechniqueStateMapCache>();
-            auto* cachedStateMap = stateMapCache.GetCachedStateMap(stateMapName);
+            const auto* cachedStateMap = stateMapCache.GetCachedStateMap(stateMapName);
             if (cachedStateMap)
                 return cachedStateMap;
 
@@ -1349,16 +1341,14 @@ namespace
             if (!file.IsOpen())
                 return nullptr;
 
-            const state_map::StateMapReader reader(*file.m_stream, stateMapFileName, stateMapName, stateMapLayout);
-            auto stateMapDefinition = reader.ReadStateMapDefinition();
+            const auto* stateMapDefinition =
+                techset::TechniqueStateMapCache::ReadStateMapDefinition(*file.m_stream, stateMapFileName, stateMapName, stateMapLayout);
             if (!stateMapDefinition)
                 return nullptr;
 
-            const auto* stateMapDefinitionPtr = stateMapDefinition.get();
-
-            stateMapCache.AddStateMapToCache(std::move(stateMapDefinition));
+            stateMapCache.AddStateMapToCache(stateMapDefinition);
 
-            return stateMapDefinitionPtr;
+            return stateMapDefinition;
         }
 
     private:
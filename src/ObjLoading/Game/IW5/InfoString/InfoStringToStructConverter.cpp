@@ -1,5 +1,7 @@
 #include "InfoStringToStructConverter.h"
 
+#include "InfoString/InfoStringFieldLookup.h"
+
 #include <cassert>
 #include <format>
 #include <iostream>
@@ -141,15 +143,14 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
 
     case CSPFT_MPH_TO_INCHES_PER_SEC:
     {
-        char* endPtr;
-        *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = strtof(value.c_str(), &endPtr) * 17.6f;
-
-        if (endPtr != &value[value.size()])
+        float mphValue;
+        if (!ParseFloat(value, mphValue))
         {
             std::cout << "Failed to parse value \"" << value << "\" as mph\n";
             return false;
         }
 
+        *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = mphValue * 17.6f;
         return true;
     }
 
@@ -204,24 +205,25 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
 
 bool InfoStringToStructConverter::Convert()
 {
+    const auto fieldValues = InfoStringFieldLookup::ForFields(m_fields, m_field_count).GetFieldValues(m_info_string);
+
     for (auto fieldIndex = 0u; fieldIndex < m_field_count; fieldIndex++)
     {
         const auto& field = m_fields[fieldIndex];
         assert(field.iFieldType >= 0);
 
-        auto foundValue = false;
-        const auto& value = m_info_string.GetValueForKey(std::string(field.szName), &foundValue);
+        const auto* value = fieldValues[fieldIndex];
 
-        if (foundValue)
+        if (value)
         {
             if (field.iFieldType < CSPFT_NUM_BASE_FIELD_TYPES)
             {
-                if (!ConvertBaseField(field, value))
+                if (!ConvertBaseField(field, *value))
                     return false;
             }
             else
             {
-                if (!ConvertExtensionField(field, value))
+                if (!ConvertExtensionField(field, *value))
                     return false;
             }
         }
@@ -1,6 +1,7 @@
 #include "InfoStringToStructConverter.h"
 
 #include "Game/T6/CommonT6.h"
+#include "InfoString/InfoStringFieldLookup.h"
 
 #include <cassert>
 #include <iostream>
@@ -207,24 +208,25 @@ bool InfoStringToStructConverter::ConvertBaseField(const cspField_t& field, cons
 
 bool InfoStringToStructConverter::Convert()
 {
+    const auto fieldValues = InfoStringFieldLookup::ForFields(m_fields, m_field_count).GetFieldValues(m_info_string);
+
     for (auto fieldIndex = 0u; fieldIndex < m_field_count; fieldIndex++)
     {
         const auto& field = m_fields[fieldIndex];
         assert(field.iFieldType >= 0);
 
-        auto foundValue = false;
-        const auto& value = m_info_string.GetValueForKey(std::string(field.szName), &foundValue);
+        const auto* value = fieldValues[fieldIndex];
 
-        if (foundValue)
+        if (value)
         {
             if (field.iFieldType < CSPFT_NUM_BASE_FIELD_TYPES)
             {
-                if (!ConvertBaseField(field, value))
+                if (!ConvertBaseField(field, *value))
                     return false;
             }
             else
             {
-                if (!ConvertExtensionField(field, value))
+                if (!ConvertExtensionField(field, *value))
                     return false;
             }
         }
@@ -32,29 +32,27 @@ namespace
 
             case VFT_MPH_TO_INCHES_PER_SECOND:
             {
-                char* endPtr;
-                *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = strtof(value.c_str(), &endPtr) * 17.6f;
-
-                if (endPtr != &value[value.size()])
+                float mphValue;
+                if (!ParseFloat(value, mphValue))
                 {
                     std::cerr << std::format("Failed to parse value \"{}\" as mph\n", value);
                     return false;
                 }
 
+                *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = mphValue * 17.6f;
                 return true;
             }
 
             case VFT_POUNDS_TO_GAME_MASS:
             {
-                char* endPtr;
-                *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = strtof(value.c_str(), &endPtr) * 0.001f;
-
-                if (endPtr != &value[value.size()])
+                float poundsValue;
+                if (!ParseFloat(value, poundsValue))
                 {
                     std::cerr << std::format("Failed to parse value \"{}\" as pounds\n", value);
                     return false;
                 }
 
+                *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + field.iOffset) = poundsValue * 0.001f;
                 return true;
             }
 
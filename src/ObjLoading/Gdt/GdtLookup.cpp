@@ -1,8 +1,11 @@
 #include "GdtLookup.h"
 
+#include <utility>
+
 void GdtLookup::Initialize(const std::vector<const Gdt*>& gdtFiles)
 {
     m_entries_by_gdf_and_by_name.clear();
+    m_gdt_files_provider = nullptr;
 
     for (const auto* gdt : gdtFiles)
     {
@@ -28,8 +31,21 @@ void GdtLookup::Initialize(const std::vector<const Gdt*>& gdtFiles)
     }
 }
 
+void GdtLookup::InitializeOnFirstQuery(std::function<std::vector<const Gdt*>()> gdtFilesProvider)
+{
+    m_entries_by_gdf_and_by_name.clear();
+    m_gdt_files_provider = std::move(gdtFilesProvider);
+}
+
 GdtEntry* GdtLookup::GetGdtEntryByGdfAndName(const std::string& gdfName, const std::string& entryName)
 {
+    if (m_gdt_files_provider)
+    {
+        const auto gdtFilesProvider = std::move(m_gdt_files_provider);
+        m_gdt_files_provider = nullptr;
+        Initialize(gdtFilesProvider());
+    }
+
     const auto foundGdtMap = m_entries_by_gdf_and_by_name.find(gdfName);
 
     if (foundGdtMap == m_entries_by_gdf_and_by_name.end())
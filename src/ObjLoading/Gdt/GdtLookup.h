@@ -3,6 +3,7 @@
 #include "IGdtQueryable.h"
 #include "Obj/Gdt/Gdt.h"
 
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -11,8 +12,17 @@ class GdtLookup : public IGdtQueryable
 {
 public:
     void Initialize(const std::vector<const Gdt*>& gdtFiles);
+
+    /**
+     * \brief Initializes the lookup with the gdt files of the provider as soon as the first entry is queried.
+     * This allows the gdt files to still be loading while assets that do not need them are already being created.
+     * \param gdtFilesProvider Returns the gdt files in the order they override each other. Is called at most once.
+     */
+    void InitializeOnFirstQuery(std::function<std::vector<const Gdt*>()> gdtFilesProvider);
+
     GdtEntry* GetGdtEntryByGdfAndName(const std::string& gdfName, const std::string& entryName) override;
 
 private:
+    std::function<std::vector<const Gdt*>()> m_gdt_files_provider;
     std::unordered_map<std::string, std::unordered_map<std::string, GdtEntry*>> m_entries_by_gdf_and_by_name;
 };
@@ -0,0 +1,183 @@
+#include "InfoStringFieldLookup.h"
+
+#include "Utils/HashUtils.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+    constexpr auto EMPTY_SLOT = UINT32_MAX;
+    constexpr auto MAX_DISPLACEMENT = 1u << 16u;
+    constexpr auto NAMES_PER_BUCKET = 4u;
+
+    uint64_t HashKey(const std::string_view key, const uint64_t seed)
+    {
+        return utils::Fnv1a64(key, utils::FNV1A_64_OFFSET_BASIS ^ (seed * 0x9E3779B97F4A7C15ull));
+    }
+
+    uint64_t Displace(uint64_t keyHash, const uint32_t displacement)
+    {
+        // SplitMix64 finalizer to spread the displaced hash over all bits
+        keyHash ^= static_cast<uint64_t>(displacement) * 0xBF58476D1CE4E5B9ull;
+        keyHash = (keyHash ^ (keyHash >> 30u)) * 0xBF58476D1CE4E5B9ull;
+        keyHash = (keyHash ^ (keyHash >> 27u)) * 0x94D049BB133111EBull;
+        return keyHash ^ (keyHash >> 31u);
+    }
+
+    size_t GetBucket(const uint64_t keyHash, const size_t bucketCount)
+    {
+        return static_cast<size_t>(keyHash >> 32u) % bucketCount;
+    }
+} // namespace
+
+InfoStringFieldLookup::InfoStringFieldLookup(const std::vector<std::string_view>& fieldNames)
+    : m_seed(0u)
+{
+    // Fields may share a name, in which case all of them receive the same value
+    std::unordered_map<std::string_view, size_t> nameIndices;
+    m_field_name_indices.reserve(fieldNames.size());
+    for (const auto& fieldName : fieldNames)
+    {
+        const auto [existingName, isNewName] = nameIndices.try_emplace(fieldName, m_names.size());
+        if (isNewName)
+            m_names.emplace_back(fieldName);
+
+        m_field_name_indices.emplace_back(existingName->second);
+    }
+
+    if (m_names.empty())
+        return;
+
+    const auto bucketCount = std::max<size_t>(1u, m_names.size() / NAMES_PER_BUCKET);
+    size_t slotCount = 1u;
+    while (slotCount < m_names.size() * 2u)
+        slotCount <<= 1u;
+
+    std::vector<uint64_t> nameHashes(m_names.size());
+    std::vector<std::vector<uint32_t>> buckets(bucketCount);
+    std::vector<size_t> bucketOrder(bucketCount);
+    std::vector<size_t> bucketSlots;
+
+    // Hash and displace: Buckets are placed largest first, each searching for a displacement that moves all of its names into free slots
+    for (;; m_seed++)
+    {
+        for (auto& bucket : buckets)
+            bucket.clear();
+
+        for (auto nameIndex = 0u; nameIndex < m_names.size(); nameIndex++)
+        {
+            nameHashes[nameIndex] = HashKey(m_names[nameIndex], m_seed);
+            buckets[GetBucket(nameHashes[nameIndex], bucketCount)].emplace_back(nameIndex);
+        }
+
+        for (auto bucketIndex = 0u; bucketIndex < bucketCount; bucketIndex++)
+            bucketOrder[bucketIndex] = bucketIndex;
+        std::stable_sort(bucketOrder.begin(),
+                         bucketOrder.end(),
+                         [&buckets](const size_t a, const size_t b)
+                         {
+                             return buckets[a].size() > buckets[b].size();
+                         });
+
+        m_bucket_displacements.assign(bucketCount, 0u);
+        m_slots.assign(slotCount, EMPTY_SLOT);
+
+        auto placedAllBuckets = true;
+        for (const auto bucketIndex : bucketOrder)
+        {
+            const auto& bucket = buckets[bucketIndex];
+            if (bucket.empty())
+                break;
+
+            auto placedBucket = false;
+            for (auto displacement = 0u; displacement < MAX_DISPLACEMENT && !placedBucket; displacement++)
+            {
+                bucketSlots.clear();
+                placedBucket = true;
+                for (const auto nameIndex : bucket)
+                {
+                    const auto slot = static_cast<size_t>(Displace(nameHashes[nameIndex], displacement)) & (slotCount - 1u);
+                    if (m_slots[slot] != EMPTY_SLOT || std::ranges::find(bucketSlots, slot) != bucketSlots.end())
+                    {
+                        placedBucket = false;
+                        break;
+                    }
+
+                    bucketSlots.emplace_back(slot);
+                }
+
+                if (placedBucket)
+                {
+                    m_bucket_displacements[bucketIndex] = displacement;
+                    for (auto i = 0u; i < bucket.size(); i++)
+                        m_slots[bucketSlots[i]] = bucket[i];
+                }
+            }
+
+            if (!placedBucket)
+            {
+                placedAllBuckets = false;
+                break;
+            }
+        }
+
+        if (placedAllBuckets)
+            break;
+    }
+}
+
+const InfoStringFieldLookup&
+    InfoStringFieldLookup::GetOrCreate(const void* fields, const size_t fieldCount, const std::function<std::vector<std::string_view>()>& getFieldNames)
+{
+    static std::mutex lookupsMutex;
+    static std::map<std::pair<const void*, size_t>, std::unique_ptr<InfoStringFieldLookup>> lookups;
+
+    std::lock_guard lock(lookupsMutex);
+
+    auto& lookup = lookups[std::make_pair(fields, fieldCount)];
+    if (!lookup)
+        lookup = std::make_unique<InfoStringFieldLookup>(getFieldNames());
+
+    return *lookup;
+}
+
+size_t InfoStringFieldLookup::GetSlot(const uint64_t keyHash) const
+{
+    const auto displacement = m_bucket_displacements[GetBucket(keyHash, m_bucket_displacements.size())];
+    return static_cast<size_t>(Displace(keyHash, displacement)) & (m_slots.size() - 1u);
+}
+
+std::optional<size_t> InfoStringFieldLookup::GetFieldNameIndex(const std::string_view key) const
+{
+    if (m_names.empty())
+        return std::nullopt;
+
+    const auto nameIndex = m_slots[GetSlot(HashKey(key, m_seed))];
+    if (nameIndex == EMPTY_SLOT || m_names[nameIndex] != key)
+        return std::nullopt;
+
+    return nameIndex;
+}
+
+std::vector<const std::string*> InfoStringFieldLookup::GetFieldValues(const InfoString& infoString) const
+{
+    std::vector<const std::string*> valuesByName(m_names.size(), nullptr);
+    for (const auto& [key, value] : infoString.GetEntries())
+    {
+        const auto nameIndex = GetFieldNameIndex(key);
+        if (nameIndex)
+            valuesByName[*nameIndex] = &value;
+    }
+
+    std::vector<const std::string*> fieldValues;
+    fieldValues.reserve(m_field_name_indices.size());
+    for (const auto nameIndex : m_field_name_indices)
+        fieldValues.emplace_back(valuesByName[nameIndex]);
+
+    return fieldValues;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "InfoString/InfoString.h"
+#include "Utils/ClassUtils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * \brief Resolves info string keys to the fields of a struct through a perfect hash table.
+ * The table is built once per field array and can be shared by all conversions of the same struct type.
+ */
+class InfoStringFieldLookup
+{
+public:
+    explicit InfoStringFieldLookup(const std::vector<std::string_view>& fieldNames);
+
+    /**
+     * \brief Returns the lookup of the specified field array. It is created on first use and cached for all further conversions.
+     */
+    template<typename FieldType> static const InfoStringFieldLookup& ForFields(const FieldType* fields, const size_t fieldCount)
+    {
+        return GetOrCreate(fields,
+                           fieldCount,
+                           [fields, fieldCount]
+                           {
+                               std::vector<std::string_view> fieldNames;
+                               fieldNames.reserve(fieldCount);
+                               for (auto fieldIndex = 0u; fieldIndex < fieldCount; fieldIndex++)
+                                   fieldNames.emplace_back(fields[fieldIndex].szName);
+
+                               return fieldNames;
+                           });
+    }
+
+    _NODISCARD std::optional<size_t> GetFieldNameIndex(std::string_view key) const;
+
+    /**
+     * \brief Returns the value of each field of the info string in field order or nullptr for fields that have no value.
+     */
+    _NODISCARD std::vector<const std::string*> GetFieldValues(const InfoString& infoString) const;
+
+private:
+    static const InfoStringFieldLookup& GetOrCreate(const void* fields, size_t fieldCount, const std::function<std::vector<std::string_view>()>& getFieldNames);
+
+    _NODISCARD size_t GetSlot(uint64_t keyHash) const;
+
+    uint64_t m_seed;
+    std::vector<std::string_view> m_names;
+    std::vector<size_t> m_field_name_indices;
+    std::vector<uint32_t> m_bucket_displacements;
+    std::vector<uint32_t> m_slots;
+};
@@ -1,10 +1,70 @@
 #include "InfoStringToStructConverterBase.h"
 
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <format>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
+namespace
+{
+    // Accepts the same notation as strtol with base 0: Leading whitespace, a sign and hexadecimal or octal prefixes.
+    // Like strtol values that are out of range saturate instead of failing.
+    bool ParseInteger(const std::string& value, int64_t& out)
+    {
+        // An empty value leaves the field at zero
+        if (value.empty())
+        {
+            out = 0;
+            return true;
+        }
+
+        const auto* ptr = value.data();
+        const auto* end = value.data() + value.size();
+
+        while (ptr != end && isspace(static_cast<unsigned char>(*ptr)))
+            ptr++;
+
+        auto negative = false;
+        if (ptr != end && (*ptr == '-' || *ptr == '+'))
+            negative = *ptr++ == '-';
+
+        auto base = 10;
+        if (end - ptr > 2 && ptr[0] == '0' && (ptr[1] == 'x' || ptr[1] == 'X') && isxdigit(static_cast<unsigned char>(ptr[2])))
+        {
+            base = 16;
+            ptr += 2;
+        }
+        else if (end - ptr > 1 && ptr[0] == '0')
+        {
+            base = 8;
+        }
+
+        uint64_t magnitude;
+        const auto [parseEnd, ec] = std::from_chars(ptr, end, magnitude, base);
+        if (parseEnd != end)
+            return false;
+
+        if (ec == std::errc::result_out_of_range)
+            magnitude = std::numeric_limits<uint64_t>::max();
+        else if (ec != std::errc())
+            return false;
+
+        constexpr auto maxMagnitude = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+        if (negative)
+            out = magnitude > maxMagnitude ? std::numeric_limits<int64_t>::min() : -static_cast<int64_t>(magnitude);
+        else
+            out = static_cast<int64_t>(std::min(magnitude, maxMagnitude));
+
+        return true;
+    }
+} // namespace
+
 InfoStringToStructConverterBase::InfoStringToStructConverterBase(const InfoString& infoString,
                                                                  void* structure,
                                                                  ZoneScriptStrings& zoneScriptStrings,
@@ -47,6 +107,56 @@ bool InfoStringToStructConverterBase::ParseAsArray(const std::string& value, std
     return true;
 }
 
+bool InfoStringToStructConverterBase::ParseFloat(const std::string& value, float& out)
+{
+    if (value.empty())
+    {
+        out = 0.0f;
+        return true;
+    }
+
+    const auto* ptr = value.data();
+    const auto* end = value.data() + value.size();
+
+    while (ptr != end && isspace(static_cast<unsigned char>(*ptr)))
+        ptr++;
+
+    auto negative = false;
+    if (ptr != end && (*ptr == '-' || *ptr == '+'))
+        negative = *ptr++ == '-';
+
+    // Like strtof, hexadecimal floats are accepted with a 0x prefix which from_chars does not expect
+    auto format = std::chars_format::general;
+    if (end - ptr > 2 && ptr[0] == '0' && (ptr[1] == 'x' || ptr[1] == 'X'))
+    {
+        format = std::chars_format::hex;
+        ptr += 2;
+    }
+
+    // from_chars accepts a minus sign itself, which must not follow the sign or prefix that was already consumed
+    if (ptr != end && *ptr == '-')
+        return false;
+
+    const auto [parseEnd, ec] = std::from_chars(ptr, end, out, format);
+    if (parseEnd != end)
+        return false;
+
+    if (ec == std::errc::result_out_of_range)
+    {
+        // strtof does not fail for values that exceed the range of a float but returns infinity or zero
+        out = std::strtof(value.c_str(), nullptr);
+        return true;
+    }
+
+    if (ec != std::errc())
+        return false;
+
+    if (negative)
+        out = -out;
+
+    return true;
+}
+
 bool InfoStringToStructConverterBase::ConvertString(const std::string& value, const size_t offset)
 {
     *reinterpret_cast<const char**>(reinterpret_cast<uintptr_t>(m_structure) + offset) = m_memory.Dup(value.c_str());
@@ -61,87 +171,81 @@ bool InfoStringToStructConverterBase::ConvertStringBuffer(const std::string& val
 
 bool InfoStringToStructConverterBase::ConvertInt(const std::string& value, const size_t offset)
 {
-    char* endPtr;
-    *reinterpret_cast<int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = strtol(value.c_str(), &endPtr, 0);
-
-    if (endPtr != &value[value.size()])
+    int64_t intValue;
+    if (!ParseInteger(value, intValue))
     {
         std::cerr << std::format("Failed to parse value \"{}\" as int\n", value);
         return false;
     }
 
+    // Saturates at the range of int like strtol does where long has the same size as int
+    *reinterpret_cast<int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) =
+        static_cast<int>(std::clamp<int64_t>(intValue, std::numeric_limits<int>::min(), std::numeric_limits<int>::max()));
     return true;
 }
 
 bool InfoStringToStructConverterBase::ConvertUint(const std::string& value, const size_t offset)
 {
-    char* endPtr;
-    *reinterpret_cast<unsigned int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = strtoul(value.c_str(), &endPtr, 0);
-
-    if (endPtr != &value[value.size()])
+    int64_t intValue;
+    if (!ParseInteger(value, intValue))
     {
         std::cerr << std::format("Failed to parse value \"{}\" as uint\n", value);
         return false;
     }
 
+    *reinterpret_cast<unsigned int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = static_cast<unsigned int>(intValue);
     return true;
 }
 
 bool InfoStringToStructConverterBase::ConvertBool(const std::string& value, const size_t offset)
 {
-    char* endPtr;
-    const auto intValue = strtol(value.c_str(), &endPtr, 0);
-
-    *reinterpret_cast<bool*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = intValue != 0;
-    if (endPtr != &value[value.size()])
+    int64_t intValue;
+    if (!ParseInteger(value, intValue))
     {
         std::cerr << std::format("Failed to parse value \"{}\" as bool\n", value);
         return false;
     }
 
+    *reinterpret_cast<bool*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = intValue != 0;
     return true;
 }
 
 bool InfoStringToStructConverterBase::ConvertQBoolean(const std::string& value, const size_t offset)
 {
-    char* endPtr;
-    const auto intValue = strtol(value.c_str(), &endPtr, 0);
-
-    *reinterpret_cast<int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = intValue != 0 ? 1 : 0;
-    if (endPtr != &value[value.size()])
+    int64_t intValue;
+    if (!ParseInteger(value, intValue))
     {
         std::cerr << std::format("Failed to parse value \"{}\" as qboolean\n", value);
         return false;
     }
 
+    *reinterpret_cast<int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = intValue != 0 ? 1 : 0;
     return true;
 }
 
 bool InfoStringToStructConverterBase::ConvertFloat(const std::string& value, const size_t offset)
 {
-    char* endPtr;
-    *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = strtof(value.c_str(), &endPtr);
-
-    if (endPtr != &value[value.size()])
+    float floatValue;
+    if (!ParseFloat(value, floatValue))
     {
         std::cerr << std::format("Failed to parse value \"{}\" as float\n", value);
         return false;
     }
 
+    *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = floatValue;
     return true;
 }
 
 bool InfoStringToStructConverterBase::ConvertMilliseconds(const std::string& value, const size_t offset)
 {
-    char* endPtr;
-    *reinterpret_cast<unsigned int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = static_cast<unsigned int>(strtof(value.c_str(), &endPtr) * 1000.0f);
-
-    if (endPtr != &value[value.size()])
+    float floatValue;
+    if (!ParseFloat(value, floatValue))
     {
         std::cerr << std::format("Failed to parse value \"{}\" as milliseconds\n", value);
         return false;
     }
 
+    *reinterpret_cast<unsigned int*>(reinterpret_cast<uintptr_t>(m_structure) + offset) = static_cast<unsigned int>(floatValue * 1000.0f);
     return true;
 }
 
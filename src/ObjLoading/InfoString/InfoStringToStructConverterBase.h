@@ -33,6 +33,11 @@ public:
     virtual bool Convert() = 0;
 
 protected:
+    /**
+     * \brief Parses a float value the same way the base float fields do. Empty values are parsed as zero.
+     */
+    static bool ParseFloat(const std::string& value, float& out);
+
     static bool ParseAsArray(const std::string& value, std::vector<std::string>& valueArray);
 
     template<size_t ARRAY_SIZE> static bool ParseAsArray(const std::string& value, std::vector<std::array<std::string, ARRAY_SIZE>>& valueArray)
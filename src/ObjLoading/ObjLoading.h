@@ -9,5 +9,7 @@ public:
         bool Verbose = false;
         bool MenuPermissiveParsing = false;
         bool MenuNoOptimization = false;
+        unsigned LoadingThreadCount = 0u;
+        bool XModelOptimizeVertexCache = false;
     } Configuration;
 };
@@ -50,37 +50,38 @@ std::unique_ptr<SimpleExpressionMatchers::matcher_t> MenuExpressionMatchers::Par
 
 const std::map<std::string, size_t>& MenuExpressionMatchers::GetBaseFunctionMapForFeatureLevel(const FeatureLevel featureLevel)
 {
+    // The function maps are static locals so they are initialized only once in a thread safe manner since menu files can be parsed concurrently
     if (featureLevel == FeatureLevel::IW4)
     {
-        static std::map<std::string, size_t> iw4FunctionMap;
-        static bool iw4FunctionMapInitialized = false;
-
-        if (!iw4FunctionMapInitialized)
+        static const auto iw4FunctionMap = []
         {
+            std::map<std::string, size_t> functionMap;
             for (size_t i = IW4::expressionFunction_e::EXP_FUNC_DYN_START; i < std::extent_v<decltype(IW4::g_expFunctionNames)>; i++)
             {
                 std::string functionName(IW4::g_expFunctionNames[i]);
                 utils::MakeStringLowerCase(functionName);
-                iw4FunctionMap.emplace(std::make_pair(functionName, i));
+                functionMap.emplace(std::move(functionName), i);
             }
-        }
+
+            return functionMap;
+        }();
 
         return iw4FunctionMap;
     }
     if (featureLevel == FeatureLevel::IW5)
     {
-        static std::map<std::string, size_t> iw5FunctionMap;
-        static bool iw5FunctionMapInitialized = false;
-
-        if (!iw5FunctionMapInitialized)
+        static const auto iw5FunctionMap = []
         {
+            std::map<std::string, size_t> functionMap;
             for (size_t i = IW5::expressionFunction_e::EXP_FUNC_DYN_START; i < std::extent_v<decltype(IW5::g_expFunctionNames)>; i++)
             {
                 std::string functionName(IW5::g_expFunctionNames[i]);
                 utils::MakeStringLowerCase(functionName);
-                iw5FunctionMap.emplace(std::make_pair(std::move(functionName), i));
+                functionMap.emplace(std::move(functionName), i);
             }
-        }
+
+            return functionMap;
+        }();
 
         return iw5FunctionMap;
     }
@@ -3,6 +3,7 @@
 #include "Asset/IZoneAssetCreationState.h"
 #include "Domain/CommonFunctionDef.h"
 #include "Domain/CommonMenuDef.h"
+#include "Parsing/Impl/PreprocessedIncludeCache.h"
 
 #include <string>
 
@@ -18,6 +19,9 @@ namespace menu
 
         std::map<std::string, std::vector<std::string>> m_menus_to_load_by_menu;
 
+        // Shared by all menu files of the zone. It is synchronized and does not change parsing results so it may be filled through a const zone state.
+        mutable PreprocessedIncludeCache m_include_cache;
+
         MenuAssetZoneState() = default;
 
         void AddFunction(std::unique_ptr<CommonFunctionDef> function);
@@ -0,0 +1,129 @@
+#include "MenuFileBatchReader.h"
+
+#include "MenuFileReader.h"
+#include "SearchPath/SearchPathSynchronized.h"
+#include "Utils/StringUtils.h"
+#include "Utils/ThreadPool.h"
+
+#include <algorithm>
+#include <future>
+#include <iostream>
+#include <sstream>
+
+using namespace menu;
+
+MenuFileBatchReader::MenuFileBatchReader(const FeatureLevel featureLevel, const bool permissiveMode, ISearchPath& searchPath, const unsigned threadCount)
+    : m_feature_level(featureLevel),
+      m_permissive_mode(permissiveMode),
+      m_search_path(searchPath),
+      m_thread_count(threadCount == 0u ? ThreadPool::GetHardwareThreadCount() : threadCount),
+      m_read_function_count(0u),
+      m_read_menu_count(0u)
+{
+}
+
+void MenuFileBatchReader::ReadMenuFiles(const std::vector<std::string>& fileNames, const MenuAssetZoneState& zoneState)
+{
+    m_read_function_count = zoneState.m_functions.size();
+    m_read_menu_count = zoneState.m_menus.size();
+    m_results.clear();
+
+    if (fileNames.empty() || m_thread_count <= 1u)
+        return;
+
+    SearchPathSynchronized searchPath(m_search_path);
+    ThreadPool threadPool(std::min(m_thread_count, static_cast<unsigned>(fileNames.size())));
+    std::vector<std::pair<std::string, std::future<FileResult>>> inFlightFiles;
+    inFlightFiles.reserve(fileNames.size());
+
+    for (const auto& fileName : fileNames)
+    {
+        inFlightFiles.emplace_back(fileName,
+                                   threadPool.Submit(
+                                       [this, &fileName, &zoneState, &searchPath]
+                                       {
+                                           return ReadMenuFile(fileName, zoneState, searchPath);
+                                       }));
+    }
+
+    // The zone state must not be modified before all files are read
+    for (auto& [fileName, result] : inFlightFiles)
+        m_results.try_emplace(fileName, result.get());
+}
+
+MenuFileBatchReader::FileResult MenuFileBatchReader::TakeResult(const std::string& fileName, const MenuAssetZoneState& zoneState)
+{
+    FileResult result;
+    auto hasUpToDateResult = false;
+
+    const auto existingResult = m_results.find(fileName);
+    if (existingResult != m_results.end())
+    {
+        result = std::move(existingResult->second);
+        m_results.erase(existingResult);
+        hasUpToDateResult = IsResultUpToDate(result, zoneState);
+    }
+
+    // Errors of a result that is discarded are not printed since reading the file sequentially would not have caused them
+    if (!hasUpToDateResult)
+        result = ReadMenuFile(fileName, zoneState, m_search_path);
+
+    std::cerr << result.m_errors;
+
+    return result;
+}
+
+MenuFileBatchReader::FileResult
+    MenuFileBatchReader::ReadMenuFile(const std::string& fileName, const MenuAssetZoneState& zoneState, ISearchPath& searchPath) const
+{
+    FileResult result;
+
+    const auto file = searchPath.Open(fileName);
+    if (!file.IsOpen())
+        return result;
+
+    result.m_opened = true;
+
+    std::ostringstream errors;
+    MenuFileReader reader(*file.m_stream, fileName, m_feature_level, searchPath);
+    reader.IncludeZoneState(zoneState);
+    reader.SetPermissiveMode(m_permissive_mode);
+    reader.SetErrorStream(errors);
+
+    result.m_parsing_result = reader.ReadMenuFile();
+    result.m_errors = std::move(errors).str();
+
+    return result;
+}
+
+bool MenuFileBatchReader::IsResultUpToDate(const FileResult& result, const MenuAssetZoneState& zoneState) const
+{
+    if (!result.m_opened)
+        return true;
+
+    // The file may have failed because it calls a function of a file that was read before it
+    if (!result.m_parsing_result)
+        return zoneState.m_functions.size() == m_read_function_count;
+
+    // Defining a function or menu that a file read before it defined already would have either failed or been treated as a redefinition
+    for (const auto& function : result.m_parsing_result->m_functions)
+    {
+        std::string lowerCaseFunctionName(function->m_name);
+        utils::MakeStringLowerCase(lowerCaseFunctionName);
+
+        if (zoneState.m_functions_by_name.contains(lowerCaseFunctionName))
+            return false;
+    }
+
+    for (auto menuIndex = m_read_menu_count; menuIndex < zoneState.m_menus.size(); menuIndex++)
+    {
+        const auto& addedMenuName = zoneState.m_menus[menuIndex]->m_name;
+        for (const auto& menu : result.m_parsing_result->m_menus)
+        {
+            if (menu->m_name == addedMenuName)
+                return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Domain/MenuFeatureLevel.h"
+#include "Domain/MenuParsingResult.h"
+#include "MenuAssetZoneState.h"
+#include "SearchPath/ISearchPath.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace menu
+{
+    /**
+     * \brief Reads the menu files of a menu list concurrently.
+     * All files are read against the zone state at the time of reading. Results must be taken in the order the files would be read in sequentially
+     * while adding their functions and menus to the zone state. Files whose result could have been different when read sequentially are read again when
+     * taking their result. Parsing errors are only printed for the result that is taken.
+     */
+    class MenuFileBatchReader
+    {
+    public:
+        class FileResult
+        {
+        public:
+            bool m_opened = false;
+            std::unique_ptr<ParsingResult> m_parsing_result;
+            std::string m_errors;
+        };
+
+        /**
+         * \param threadCount The maximum amount of files to read concurrently. When \c 0 the amount of hardware threads is used.
+         * When \c 1 the files are only read when taking their result.
+         */
+        MenuFileBatchReader(FeatureLevel featureLevel, bool permissiveMode, ISearchPath& searchPath, unsigned threadCount);
+
+        void ReadMenuFiles(const std::vector<std::string>& fileNames, const MenuAssetZoneState& zoneState);
+        FileResult TakeResult(const std::string& fileName, const MenuAssetZoneState& zoneState);
+
+    private:
+        FileResult ReadMenuFile(const std::string& fileName, const MenuAssetZoneState& zoneState, ISearchPath& searchPath) const;
+        [[nodiscard]] bool IsResultUpToDate(const FileResult& result, const MenuAssetZoneState& zoneState) const;
+
+        const FeatureLevel m_feature_level;
+        const bool m_permissive_mode;
+        ISearchPath& m_search_path;
+        const unsigned m_thread_count;
+
+        size_t m_read_function_count;
+        size_t m_read_menu_count;
+        std::unordered_map<std::string, FileResult> m_results;
+    };
+} // namespace menu
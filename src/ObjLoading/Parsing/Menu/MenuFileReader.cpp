@@ -16,8 +16,11 @@ MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const
       m_feature_level(featureLevel),
       m_file_name(std::move(fileName)),
       m_stream(nullptr),
+      m_including_proxy(nullptr),
+      m_defines_proxy(nullptr),
       m_zone_state(nullptr),
-      m_permissive_mode(false)
+      m_permissive_mode(false),
+      m_error_stream(&std::cerr)
 {
     OpenBaseStream(stream);
     SetupStreamProxies();
@@ -34,6 +37,7 @@ bool MenuFileReader::OpenBaseStream(std::istream& stream)
 void MenuFileReader::SetupDefinesProxy()
 {
     auto defines = std::make_unique<DefinesStreamProxy>(m_open_streams.back().get());
+    m_defines_proxy = defines.get();
 
     defines->AddDefine(DefinesStreamProxy::Define("PC", "1"));
     switch (m_feature_level)
@@ -55,8 +59,11 @@ void MenuFileReader::SetupDefinesProxy()
 void MenuFileReader::SetupStreamProxies()
 {
     m_open_streams.emplace_back(std::make_unique<CommentRemovingStreamProxy>(m_open_streams.back().get()));
-    m_open_streams.emplace_back(std::make_unique<IncludingStreamProxy>(m_open_streams.back().get()));
+    auto includes = std::make_unique<IncludingStreamProxy>(m_open_streams.back().get());
+    m_including_proxy = includes.get();
+    m_open_streams.emplace_back(std::move(includes));
     SetupDefinesProxy();
+    m_including_proxy->SetIncludeCacheHandler(m_defines_proxy);
 
     m_stream = m_open_streams.back().get();
 }
@@ -65,25 +72,25 @@ bool MenuFileReader::IsValidEndState(const MenuFileParserState* state) const
 {
     if (state->m_current_item)
     {
-        std::cerr << "In \"" << m_file_name << "\": Unclosed item at end of file!\n";
+        *m_error_stream << "In \"" << m_file_name << "\": Unclosed item at end of file!\n";
         return false;
     }
 
     if (state->m_current_menu)
     {
-        std::cerr << "In \"" << m_file_name << "\": Unclosed menu at end of file!\n";
+        *m_error_stream << "In \"" << m_file_name << "\": Unclosed menu at end of file!\n";
         return false;
     }
 
     if (state->m_current_function)
     {
-        std::cerr << "In \"" << m_file_name << "\": Unclosed function at end of file!\n";
+        *m_error_stream << "In \"" << m_file_name << "\": Unclosed function at end of file!\n";
         return false;
     }
 
     if (state->m_in_global_scope)
     {
-        std::cerr << "In \"" << m_file_name << "\": Did not close global scope!\n";
+        *m_error_stream << "In \"" << m_file_name << "\": Did not close global scope!\n";
         return false;
     }
 
@@ -103,6 +110,7 @@ std::unique_ptr<ParsingResult> MenuFileReader::CreateParsingResult(MenuFileParse
 void MenuFileReader::IncludeZoneState(const MenuAssetZoneState& zoneState)
 {
     m_zone_state = &zoneState;
+    m_defines_proxy->SetIncludeCache(&zoneState.m_include_cache);
 }
 
 void MenuFileReader::SetPermissiveMode(const bool usePermissiveMode)
@@ -110,6 +118,11 @@ void MenuFileReader::SetPermissiveMode(const bool usePermissiveMode)
     m_permissive_mode = usePermissiveMode;
 }
 
+void MenuFileReader::SetErrorStream(std::ostream& errorStream)
+{
+    m_error_stream = &errorStream;
+}
+
 std::unique_ptr<ParsingResult> MenuFileReader::ReadMenuFile()
 {
     SimpleLexer::Config lexerConfig;
@@ -118,18 +131,20 @@ std::unique_ptr<ParsingResult> MenuFileReader::ReadMenuFile()
     lexerConfig.m_string_escape_sequences = true;
     lexerConfig.m_read_integer_numbers = true;
     lexerConfig.m_read_floating_point_numbers = true;
+    lexerConfig.m_use_token_arena = true;
     MenuExpressionMatchers().ApplyTokensToLexerConfig(lexerConfig);
 
     const auto lexer = std::make_unique<SimpleLexer>(m_stream, std::move(lexerConfig));
     const auto parser = std::make_unique<MenuFileParser>(lexer.get(), m_feature_level, m_permissive_mode, m_zone_state);
+    parser->SetErrorStream(*m_error_stream);
 
     if (!parser->Parse())
     {
-        std::cerr << "Parsing menu file failed!\n";
+        *m_error_stream << "Parsing menu file failed!\n";
 
         const auto* parserEndState = parser->GetState();
         if (parserEndState->m_current_event_handler_set && !parserEndState->m_permissive_mode)
-            std::cerr << "You can use the --menu-permissive option to try to compile the event handler script anyway.\n";
+            *m_error_stream << "You can use the --menu-permissive option to try to compile the event handler script anyway.\n";
         return nullptr;
     }
 
@@ -5,10 +5,13 @@
 #include "MenuAssetZoneState.h"
 #include "MenuFileParserState.h"
 #include "Parsing/IParserLineStream.h"
+#include "Parsing/Impl/DefinesStreamProxy.h"
+#include "Parsing/Impl/IncludingStreamProxy.h"
 #include "SearchPath/ISearchPath.h"
 #include "SearchPath/SearchPathMultiInputStream.h"
 
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -21,6 +24,7 @@ namespace menu
 
         void IncludeZoneState(const MenuAssetZoneState& zoneState);
         void SetPermissiveMode(bool usePermissiveMode);
+        void SetErrorStream(std::ostream& errorStream);
 
         std::unique_ptr<ParsingResult> ReadMenuFile();
 
@@ -37,8 +41,11 @@ namespace menu
 
         IParserLineStream* m_stream;
         std::vector<std::unique_ptr<IParserLineStream>> m_open_streams;
+        IncludingStreamProxy* m_including_proxy;
+        DefinesStreamProxy* m_defines_proxy;
 
         const MenuAssetZoneState* m_zone_state;
         bool m_permissive_mode;
+        std::ostream* m_error_stream;
     };
 } // namespace menu
@@ -3,8 +3,12 @@
 #include "Csv/CsvStream.h"
 
 #include <algorithm>
+#include <cstring>
 #include <istream>
+#include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace string_table
@@ -19,47 +23,94 @@ namespace string_table
         AbstractStringTableLoader& operator=(const AbstractStringTableLoader& other) = default;
         AbstractStringTableLoader& operator=(AbstractStringTableLoader&& other) noexcept = default;
 
-        virtual void SetCellContent(CellType& cell, const char* content) = 0;
+        virtual int HashCellContent(const char* content)
+        {
+            return 0;
+        }
+
+        virtual void SetCellContent(CellType& cell, const char* content, int contentHash) = 0;
 
         virtual void PostProcessStringTable(StringTableType* stringTable, const unsigned cellCount, MemoryManager& memory) {}
 
     public:
         StringTableType* LoadFromStream(const std::string& assetName, MemoryManager& memory, std::istream& stream)
         {
+            static constexpr auto EMPTY_VALUE_INDEX = 0u;
+
             auto* stringTable = memory.Alloc<StringTableType>();
             stringTable->name = memory.Dup(assetName.c_str());
 
-            std::vector<std::vector<std::string>> csvLines;
-            std::vector<std::string> currentLine;
+            // Cells only remember the index of their value so every distinct value is stored and hashed once
+            std::unordered_map<std::string, unsigned> valueIndices;
+            std::vector<const std::string*> values;
+            std::vector<unsigned> cellValueIndices;
+            std::vector<size_t> rowEnds;
+            size_t valuesSize = 0u;
             auto maxCols = 0u;
-            const CsvInputStream csv(stream);
 
+            values.emplace_back(nullptr);
+
+            std::vector<std::string> currentLine;
+            const CsvInputStream csv(stream);
             while (csv.NextRow(currentLine))
             {
                 maxCols = std::max(static_cast<unsigned>(currentLine.size()), maxCols);
-                csvLines.emplace_back(std::move(currentLine));
-                currentLine = std::vector<std::string>();
+
+                for (auto& value : currentLine)
+                {
+                    if (value.empty())
+                    {
+                        cellValueIndices.emplace_back(EMPTY_VALUE_INDEX);
+                        continue;
+                    }
+
+                    const auto valueSize = value.size() + 1u;
+                    const auto [existingValue, isNewValue] = valueIndices.try_emplace(std::move(value), static_cast<unsigned>(values.size()));
+                    if (isNewValue)
+                    {
+                        values.emplace_back(&existingValue->first);
+                        valuesSize += valueSize;
+                    }
+
+                    cellValueIndices.emplace_back(existingValue->second);
+                }
+
+                rowEnds.emplace_back(cellValueIndices.size());
             }
 
             stringTable->columnCount = static_cast<int>(maxCols);
-            stringTable->rowCount = static_cast<int>(csvLines.size());
+            stringTable->rowCount = static_cast<int>(rowEnds.size());
             const auto cellCount = static_cast<unsigned>(stringTable->rowCount) * static_cast<unsigned>(stringTable->columnCount);
 
             if (cellCount)
             {
+                // All distinct values share a single allocation
+                auto* valueBuffer = valuesSize > 0u ? memory.Alloc<char>(valuesSize) : nullptr;
+                std::vector<std::pair<const char*, int>> valueContents;
+                valueContents.reserve(values.size());
+                valueContents.emplace_back("", HashCellContent(""));
+                for (auto valueIndex = 1u; valueIndex < values.size(); valueIndex++)
+                {
+                    const auto& value = *values[valueIndex];
+                    std::memcpy(valueBuffer, value.c_str(), value.size() + 1u);
+                    valueContents.emplace_back(valueBuffer, HashCellContent(valueBuffer));
+                    valueBuffer += value.size() + 1u;
+                }
+
                 stringTable->values = memory.Alloc<CellType>(cellCount);
 
-                for (auto row = 0u; row < csvLines.size(); row++)
+                size_t rowStart = 0u;
+                for (auto row = 0u; row < rowEnds.size(); row++)
                 {
-                    const auto& rowValues = csvLines[row];
+                    const auto rowSize = rowEnds[row] - rowStart;
                     for (auto col = 0u; col < maxCols; col++)
                     {
-                        auto& cell = stringTable->values[row * maxCols + col];
-                        if (col >= rowValues.size() || rowValues[col].empty())
-                            SetCellContent(cell, "");
-                        else
-                            SetCellContent(cell, memory.Dup(rowValues[col].c_str()));
+                        const auto valueIndex = col < rowSize ? cellValueIndices[rowStart + col] : EMPTY_VALUE_INDEX;
+                        const auto& [content, contentHash] = valueContents[valueIndex];
+                        SetCellContent(stringTable->values[row * maxCols + col], content, contentHash);
                     }
+
+                    rowStart = rowEnds[row];
                 }
             }
             else
@@ -80,7 +131,7 @@ namespace string_table
     template<typename StringTableType> class StringTableLoaderV1 final : public AbstractStringTableLoader<StringTableType, const char*>
     {
     protected:
-        void SetCellContent(const char*& cell, const char* content) override
+        void SetCellContent(const char*& cell, const char* content, int contentHash) override
         {
             cell = content;
         }
@@ -96,10 +147,15 @@ namespace string_table
         using CellType_t = decltype(*StringTableType::values);
 
     protected:
-        void SetCellContent(CellType_t& cell, const char* content) override
+        int HashCellContent(const char* content) override
+        {
+            return HashFunc(content);
+        }
+
+        void SetCellContent(CellType_t& cell, const char* content, const int contentHash) override
         {
             cell.string = content;
-            cell.hash = HashFunc(content);
+            cell.hash = contentHash;
         }
     };
 
@@ -115,10 +171,15 @@ namespace string_table
         using CellIndexType_t = std::remove_pointer_t<decltype(StringTableType::cellIndex)>;
 
     protected:
-        void SetCellContent(CellType_t& cell, const char* content) override
+        int HashCellContent(const char* content) override
+        {
+            return HashFunc(content);
+        }
+
+        void SetCellContent(CellType_t& cell, const char* content, const int contentHash) override
         {
             cell.string = content;
-            cell.hash = HashFunc(content);
+            cell.hash = contentHash;
         }
 
         void PostProcessStringTable(StringTableType* stringTable, const unsigned cellCount, MemoryManager& memory) override
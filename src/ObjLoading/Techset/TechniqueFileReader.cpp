@@ -25,6 +25,7 @@ bool TechniqueFileReader::ReadTechniqueDefinition() const
     lexerConfig.m_string_escape_sequences = false;
     lexerConfig.m_read_integer_numbers = true;
     lexerConfig.m_read_floating_point_numbers = true;
+    lexerConfig.m_use_token_arena = true;
     const auto lexer = std::make_unique<SimpleLexer>(m_comment_proxy.get(), std::move(lexerConfig));
 
     const auto parser = std::make_unique<TechniqueParser>(lexer.get(), m_acceptor);
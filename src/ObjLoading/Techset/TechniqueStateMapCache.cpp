@@ -1,5 +1,12 @@
 #include "TechniqueStateMapCache.h"
 
+#include "StateMap/StateMapReader.h"
+#include "Utils/ConcurrentCache.h"
+
+#include <iterator>
+#include <sstream>
+#include <tuple>
+
 using namespace techset;
 
 const state_map::StateMapDefinition* TechniqueStateMapCache::GetCachedStateMap(const std::string& name) const
@@ -7,14 +14,14 @@ const state_map::StateMapDefinition* TechniqueStateMapCache::GetCachedStateMap(c
     const auto foundStateMap = m_state_map_cache.find(name);
 
     if (foundStateMap != m_state_map_cache.end())
-        return foundStateMap->second.get();
+        return foundStateMap->second;
 
     return nullptr;
 }
 
-void TechniqueStateMapCache::AddStateMapToCache(std::unique_ptr<state_map::StateMapDefinition> stateMap)
+void TechniqueStateMapCache::AddStateMapToCache(const state_map::StateMapDefinition* stateMap)
 {
-    m_state_map_cache.emplace(std::make_pair(stateMap->m_name, std::move(stateMap)));
+    m_state_map_cache.emplace(std::make_pair(stateMap->m_name, stateMap));
 }
 
 const state_map::StateMapDefinition* TechniqueStateMapCache::GetStateMapForTechnique(const std::string& techniqueName) const
@@ -31,3 +38,22 @@ void TechniqueStateMapCache::SetTechniqueUsesStateMap(std::string techniqueName,
 {
     m_state_map_per_technique.emplace(std::make_pair(std::move(techniqueName), stateMap));
 }
+
+const state_map::StateMapDefinition* TechniqueStateMapCache::ReadStateMapDefinition(std::istream& stream,
+                                                                                    const std::string& fileName,
+                                                                                    const std::string& stateMapName,
+                                                                                    const state_map::StateMapLayout& layout)
+{
+    static ConcurrentCache<std::tuple<const state_map::StateMapLayout*, std::string, std::string>, state_map::StateMapDefinition> cachedDefinitions(false);
+
+    const std::string content{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    auto key = std::make_tuple(&layout, stateMapName, content);
+
+    return cachedDefinitions.GetOrCreate(std::move(key),
+                                         [&content, &fileName, &stateMapName, &layout]
+                                         {
+                                             std::istringstream contentStream(content);
+                                             const state_map::StateMapReader reader(contentStream, fileName, stateMapName, layout);
+                                             return reader.ReadStateMapDefinition();
+                                         });
+}
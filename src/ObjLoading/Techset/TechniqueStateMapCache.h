@@ -2,9 +2,10 @@
 
 #include "Asset/IZoneAssetCreationState.h"
 #include "StateMap/StateMapDefinition.h"
+#include "StateMap/StateMapLayout.h"
 #include "Utils/ClassUtils.h"
 
-#include <memory>
+#include <istream>
 #include <string>
 #include <unordered_map>
 
@@ -14,13 +15,21 @@ namespace techset
     {
     public:
         _NODISCARD const state_map::StateMapDefinition* GetCachedStateMap(const std::string& name) const;
-        void AddStateMapToCache(std::unique_ptr<state_map::StateMapDefinition> stateMap);
+        void AddStateMapToCache(const state_map::StateMapDefinition* stateMap);
 
         _NODISCARD const state_map::StateMapDefinition* GetStateMapForTechnique(const std::string& techniqueName) const;
         void SetTechniqueUsesStateMap(std::string techniqueName, const state_map::StateMapDefinition* stateMap);
 
+        /**
+         * \brief Reads a state map definition from a state map file.
+         * Definitions are kept for the lifetime of the process and shared between all state map files with the same name and content.
+         * \return The state map definition or \c nullptr if the state map file could not be parsed.
+         */
+        static const state_map::StateMapDefinition*
+            ReadStateMapDefinition(std::istream& stream, const std::string& fileName, const std::string& stateMapName, const state_map::StateMapLayout& layout);
+
     private:
         std::unordered_map<std::string, const state_map::StateMapDefinition*> m_state_map_per_technique;
-        std::unordered_map<std::string, std::unique_ptr<state_map::StateMapDefinition>> m_state_map_cache;
+        std::unordered_map<std::string, const state_map::StateMapDefinition*> m_state_map_cache;
     };
 } // namespace techset
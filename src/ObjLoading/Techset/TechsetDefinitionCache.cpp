@@ -1,18 +1,44 @@
 #include "TechsetDefinitionCache.h"
 
+#include "TechsetFileReader.h"
+#include "Utils/ConcurrentCache.h"
+
+#include <iterator>
+#include <sstream>
+#include <utility>
+
 using namespace techset;
 
-TechsetDefinition* TechsetDefinitionCache::GetCachedTechsetDefinition(const std::string& techsetName) const
+const TechsetDefinition* TechsetDefinitionCache::GetCachedTechsetDefinition(const std::string& techsetName) const
 {
     const auto foundTechset = m_cache.find(techsetName);
 
     if (foundTechset != m_cache.end())
-        return foundTechset->second.get();
+        return foundTechset->second;
 
     return nullptr;
 }
 
-void TechsetDefinitionCache::AddTechsetDefinitionToCache(std::string name, std::unique_ptr<TechsetDefinition> definition)
+void TechsetDefinitionCache::AddTechsetDefinitionToCache(std::string name, const TechsetDefinition* definition)
 {
-    m_cache.emplace(std::make_pair(std::move(name), std::move(definition)));
+    m_cache.emplace(std::make_pair(std::move(name), definition));
+}
+
+const TechsetDefinition* TechsetDefinitionCache::ReadTechsetDefinition(std::istream& stream,
+                                                                       const std::string& fileName,
+                                                                       const char** validTechniqueTypeNames,
+                                                                       const size_t validTechniqueTypeNameCount)
+{
+    static ConcurrentCache<std::pair<const char**, std::string>, TechsetDefinition> cachedDefinitions(false);
+
+    const std::string content{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    auto key = std::make_pair(validTechniqueTypeNames, content);
+
+    return cachedDefinitions.GetOrCreate(std::move(key),
+                                         [&content, &fileName, validTechniqueTypeNames, validTechniqueTypeNameCount]
+                                         {
+                                             std::istringstream contentStream(content);
+                                             const TechsetFileReader reader(contentStream, fileName, validTechniqueTypeNames, validTechniqueTypeNameCount);
+                                             return reader.ReadTechsetDefinition();
+                                         });
 }
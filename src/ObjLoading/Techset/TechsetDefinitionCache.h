@@ -4,7 +4,7 @@
 #include "TechsetDefinition.h"
 #include "Utils/ClassUtils.h"
 
-#include <memory>
+#include <istream>
 #include <string>
 #include <unordered_map>
 
@@ -13,10 +13,19 @@ namespace techset
     class TechsetDefinitionCache final : public IZoneAssetCreationState
     {
     public:
-        _NODISCARD TechsetDefinition* GetCachedTechsetDefinition(const std::string& techsetName) const;
-        void AddTechsetDefinitionToCache(std::string name, std::unique_ptr<TechsetDefinition> definition);
+        _NODISCARD const TechsetDefinition* GetCachedTechsetDefinition(const std::string& techsetName) const;
+        void AddTechsetDefinitionToCache(std::string name, const TechsetDefinition* definition);
+
+        /**
+         * \brief Reads a techset definition from a techset file.
+         * Definitions are kept for the lifetime of the process and shared between all techset files with the same content,
+         * so zones that use the same techsets only parse them once.
+         * \return The techset definition or \c nullptr if the techset file could not be parsed.
+         */
+        static const TechsetDefinition*
+            ReadTechsetDefinition(std::istream& stream, const std::string& fileName, const char** validTechniqueTypeNames, size_t validTechniqueTypeNameCount);
 
     private:
-        std::unordered_map<std::string, std::unique_ptr<TechsetDefinition>> m_cache;
+        std::unordered_map<std::string, const TechsetDefinition*> m_cache;
     };
 } // namespace techset
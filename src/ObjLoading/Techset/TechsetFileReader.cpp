@@ -26,6 +26,7 @@ std::unique_ptr<techset::TechsetDefinition> TechsetFileReader::ReadTechsetDefini
     lexerConfig.m_string_escape_sequences = false;
     lexerConfig.m_read_integer_numbers = false;
     lexerConfig.m_read_floating_point_numbers = false;
+    lexerConfig.m_use_token_arena = true;
     const auto lexer = std::make_unique<SimpleLexer>(m_comment_proxy.get(), std::move(lexerConfig));
 
     const auto parser = std::make_unique<techset::TechsetParser>(lexer.get(), m_valid_technique_type_names, m_valid_technique_type_name_count);
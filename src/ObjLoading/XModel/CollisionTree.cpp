@@ -0,0 +1,405 @@
+#include "CollisionTree.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace collision_tree
+{
+    namespace
+    {
+        typedef float tvec3[3];
+
+        const tvec3& GetVec3(const void* data, const size_t index, const size_t stride)
+        {
+            return *reinterpret_cast<const tvec3*>(static_cast<const char*>(data) + stride * index);
+        }
+
+        struct FloatBounds
+        {
+            float mins[3];
+            float maxs[3];
+
+            void Reset()
+            {
+                for (auto axis = 0u; axis < 3u; axis++)
+                {
+                    mins[axis] = std::numeric_limits<float>::max();
+                    maxs[axis] = std::numeric_limits<float>::lowest();
+                }
+            }
+
+            void Add(const tvec3& point)
+            {
+                for (auto axis = 0u; axis < 3u; axis++)
+                {
+                    mins[axis] = std::min(mins[axis], point[axis]);
+                    maxs[axis] = std::max(maxs[axis], point[axis]);
+                }
+            }
+
+            void Add(const FloatBounds& other)
+            {
+                for (auto axis = 0u; axis < 3u; axis++)
+                {
+                    mins[axis] = std::min(mins[axis], other.mins[axis]);
+                    maxs[axis] = std::max(maxs[axis], other.maxs[axis]);
+                }
+            }
+        };
+
+        struct TriangleInfo
+        {
+            FloatBounds bounds;
+            float center[3];
+            uint16_t index;
+        };
+
+        constexpr size_t SAH_BIN_COUNT = 16u;
+        constexpr size_t MIN_CHILD_TRIANGLES = 2u;
+
+        struct TriangleRange
+        {
+            size_t begin;
+            size_t end;
+            FloatBounds bounds;
+            FloatBounds centerBounds;
+        };
+
+        struct BuildTask
+        {
+            size_t nodeIndex;
+            TriangleRange range;
+        };
+
+        class CollisionTreeBuilder
+        {
+        public:
+            CollisionTreeBuilder(const VertexData& vertexData, const size_t triCount, const size_t vertexCount)
+                : m_vertex_data(vertexData),
+                  m_tri_count(triCount),
+                  m_vertex_count(vertexCount)
+            {
+            }
+
+            CollisionTree Build()
+            {
+                assert(m_tri_count <= MAX_TRIANGLE_COUNT);
+
+                CollisionTree tree{};
+                for (auto axis = 0u; axis < 3u; axis++)
+                {
+                    tree.trans[axis] = 0.0f;
+                    tree.scale[axis] = 1.0f;
+                }
+
+                if (m_tri_count == 0)
+                    return tree;
+
+                m_tree = &tree;
+                const auto rootRange = InitTriangles();
+                InitQuantization(rootRange.bounds);
+
+                tree.nodes.reserve(m_tri_count);
+                tree.leafs.reserve(m_tri_count);
+                tree.nodes.emplace_back();
+
+                std::vector<BuildTask> tasks;
+                tasks.emplace_back(BuildTask{.nodeIndex = 0u, .range = rootRange});
+                while (!tasks.empty())
+                {
+                    const auto task = tasks.back();
+                    tasks.pop_back();
+                    BuildNode(task, tasks);
+                }
+
+                m_tree = nullptr;
+                return tree;
+            }
+
+        private:
+            // Triangle data is partitioned along with the triangles so that every node only reads memory sequentially
+            TriangleRange InitTriangles()
+            {
+                TriangleRange range{};
+                InitRange(range, 0u);
+                range.end = m_tri_count;
+
+                m_triangles.resize(m_tri_count);
+                for (auto triIndex = 0u; triIndex < m_tri_count; triIndex++)
+                {
+                    auto& triangle = m_triangles[triIndex];
+                    triangle.bounds.Reset();
+
+                    for (auto triVertex = 0u; triVertex < 3u; triVertex++)
+                    {
+                        const auto vertexIndex = m_vertex_data.triData[triIndex * 3u + triVertex];
+                        assert(vertexIndex < m_vertex_count);
+                        triangle.bounds.Add(GetVec3(m_vertex_data.positionData, vertexIndex, m_vertex_data.positionDataStride));
+                    }
+
+                    for (auto axis = 0u; axis < 3u; axis++)
+                        triangle.center[axis] = (triangle.bounds.mins[axis] + triangle.bounds.maxs[axis]) * 0.5f;
+
+                    triangle.index = static_cast<uint16_t>(triIndex);
+
+                    range.bounds.Add(triangle.bounds);
+                    range.centerBounds.Add(triangle.center);
+                }
+
+                return range;
+            }
+
+            void InitQuantization(const FloatBounds& totalBounds) const
+            {
+                for (auto axis = 0u; axis < 3u; axis++)
+                {
+                    const auto extent = totalBounds.maxs[axis] - totalBounds.mins[axis];
+                    m_tree->trans[axis] = -totalBounds.mins[axis];
+                    m_tree->scale[axis] = extent > 0.0f ? static_cast<float>(std::numeric_limits<uint16_t>::max()) / extent : 1.0f;
+                }
+            }
+
+            [[nodiscard]] Aabb QuantizeBounds(const FloatBounds& bounds) const
+            {
+                Aabb aabb{};
+                for (auto axis = 0u; axis < 3u; axis++)
+                {
+                    aabb.mins[axis] = QuantizeMin(bounds.mins[axis], m_tree->trans[axis], m_tree->scale[axis]);
+                    aabb.maxs[axis] = QuantizeMax(bounds.maxs[axis], m_tree->trans[axis], m_tree->scale[axis]);
+                }
+
+                return aabb;
+            }
+
+            void BuildNode(const BuildTask& task, std::vector<BuildTask>& tasks)
+            {
+                auto& node = m_tree->nodes[task.nodeIndex];
+                node.aabb = QuantizeBounds(task.range.bounds);
+
+                const auto triCount = task.range.end - task.range.begin;
+                if (triCount <= MAX_LEAF_TRIANGLES)
+                {
+                    node.childBeginIndex = static_cast<uint16_t>(m_tree->leafs.size());
+                    node.childCount = static_cast<uint16_t>(triCount | LEAF_CHILDREN_FLAG);
+
+                    // Order triangles of the leafs by index so the result does not depend on the partitioning algorithm
+                    const auto leafBegin = m_tree->leafs.size();
+                    for (auto triIndex = task.range.begin; triIndex < task.range.end; triIndex++)
+                        m_tree->leafs.emplace_back(m_triangles[triIndex].index);
+                    std::sort(m_tree->leafs.begin() + static_cast<std::ptrdiff_t>(leafBegin), m_tree->leafs.end());
+                    return;
+                }
+
+                TriangleRange left{};
+                TriangleRange right{};
+                if (!SplitBySurfaceArea(task.range, left, right))
+                    SplitByMedian(task.range, left, right);
+
+                const auto childBeginIndex = m_tree->nodes.size();
+                node.childBeginIndex = static_cast<uint16_t>(childBeginIndex);
+                node.childCount = 2u;
+                m_tree->nodes.emplace_back();
+                m_tree->nodes.emplace_back();
+
+                tasks.emplace_back(BuildTask{.nodeIndex = childBeginIndex + 1u, .range = right});
+                tasks.emplace_back(BuildTask{.nodeIndex = childBeginIndex, .range = left});
+            }
+
+            static size_t GetBinIndex(const float center, const float binOffset, const float binScale)
+            {
+                const auto bin = static_cast<size_t>((center - binOffset) * binScale);
+                return std::min(bin, SAH_BIN_COUNT - 1u);
+            }
+
+            static float GetHalfSurfaceArea(const FloatBounds& bounds)
+            {
+                const auto x = bounds.maxs[0] - bounds.mins[0];
+                const auto y = bounds.maxs[1] - bounds.mins[1];
+                const auto z = bounds.maxs[2] - bounds.mins[2];
+
+                return x * y + y * z + z * x;
+            }
+
+            /**
+             * \brief Partitions the triangles along the longest axis of their centers at the bin boundary with the lowest surface area cost.
+             * Both sides keep at least two triangles which limits the node count to the triangle count.
+             * The bounds of both sides are collected from the bins so they do not need to be calculated again.
+             * \return \c true if a split was found.
+             */
+            bool SplitBySurfaceArea(const TriangleRange& range, TriangleRange& left, TriangleRange& right)
+            {
+                struct Bin
+                {
+                    size_t count;
+                    FloatBounds bounds;
+                    FloatBounds centerBounds;
+                };
+
+                const auto axis = GetLongestAxis(range.centerBounds);
+                const auto binOffset = range.centerBounds.mins[axis];
+                const auto extent = range.centerBounds.maxs[axis] - binOffset;
+                if (!(extent > 0.0f))
+                    return false;
+
+                const auto binScale = static_cast<float>(SAH_BIN_COUNT) / extent;
+
+                Bin bins[SAH_BIN_COUNT];
+                for (auto& bin : bins)
+                {
+                    bin.count = 0u;
+                    bin.bounds.Reset();
+                    bin.centerBounds.Reset();
+                }
+
+                for (auto triIndex = range.begin; triIndex < range.end; triIndex++)
+                {
+                    const auto& triangle = m_triangles[triIndex];
+                    auto& bin = bins[GetBinIndex(triangle.center[axis], binOffset, binScale)];
+                    bin.count++;
+                    bin.bounds.Add(triangle.bounds);
+                    bin.centerBounds.Add(triangle.center);
+                }
+
+                // Sweep from the right to know the cost of the right side of each split
+                float rightCosts[SAH_BIN_COUNT];
+                FloatBounds rightBounds{};
+                rightBounds.Reset();
+                size_t rightCount = 0u;
+                for (auto binIndex = SAH_BIN_COUNT - 1u; binIndex > 0u; binIndex--)
+                {
+                    rightCount += bins[binIndex].count;
+                    rightBounds.Add(bins[binIndex].bounds);
+                    rightCosts[binIndex] = rightCount > 0u ? static_cast<float>(rightCount) * GetHalfSurfaceArea(rightBounds) : 0.0f;
+                }
+
+                const auto triCount = range.end - range.begin;
+                auto bestCost = std::numeric_limits<float>::max();
+                auto bestSplit = 0uz;
+                auto bestLeftCount = 0uz;
+                FloatBounds leftBounds{};
+                leftBounds.Reset();
+                size_t leftCount = 0u;
+                for (auto split = 1uz; split < SAH_BIN_COUNT; split++)
+                {
+                    leftCount += bins[split - 1u].count;
+                    leftBounds.Add(bins[split - 1u].bounds);
+
+                    if (leftCount < MIN_CHILD_TRIANGLES || triCount - leftCount < MIN_CHILD_TRIANGLES)
+                        continue;
+
+                    const auto cost = static_cast<float>(leftCount) * GetHalfSurfaceArea(leftBounds) + rightCosts[split];
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestSplit = split;
+                        bestLeftCount = leftCount;
+                    }
+                }
+
+                if (bestSplit == 0u)
+                    return false;
+
+                InitRange(left, range.begin);
+                InitRange(right, range.begin + bestLeftCount);
+                left.end = right.begin;
+                right.end = range.end;
+                for (auto binIndex = 0uz; binIndex < SAH_BIN_COUNT; binIndex++)
+                {
+                    auto& child = binIndex < bestSplit ? left : right;
+                    child.bounds.Add(bins[binIndex].bounds);
+                    child.centerBounds.Add(bins[binIndex].centerBounds);
+                }
+
+                std::partition(m_triangles.begin() + static_cast<std::ptrdiff_t>(range.begin),
+                               m_triangles.begin() + static_cast<std::ptrdiff_t>(range.end),
+                               [axis, bestSplit, binOffset, binScale](const TriangleInfo& triangle)
+                               {
+                                   return GetBinIndex(triangle.center[axis], binOffset, binScale) < bestSplit;
+                               });
+
+                return true;
+            }
+
+            void SplitByMedian(const TriangleRange& range, TriangleRange& left, TriangleRange& right)
+            {
+                const auto axis = GetLongestAxis(range.centerBounds);
+                const auto begin = m_triangles.begin() + static_cast<std::ptrdiff_t>(range.begin);
+                const auto end = m_triangles.begin() + static_cast<std::ptrdiff_t>(range.end);
+                const auto middleIndex = range.begin + (range.end - range.begin) / 2u;
+
+                // Break ties by triangle index to have a strict order which makes the split deterministic
+                std::nth_element(begin,
+                                 m_triangles.begin() + static_cast<std::ptrdiff_t>(middleIndex),
+                                 end,
+                                 [axis](const TriangleInfo& tri0, const TriangleInfo& tri1)
+                                 {
+                                     if (tri0.center[axis] != tri1.center[axis])
+                                         return tri0.center[axis] < tri1.center[axis];
+
+                                     return tri0.index < tri1.index;
+                                 });
+
+                InitRange(left, range.begin);
+                InitRange(right, middleIndex);
+                left.end = right.begin;
+                right.end = range.end;
+
+                for (auto* child : {&left, &right})
+                {
+                    for (auto triIndex = child->begin; triIndex < child->end; triIndex++)
+                    {
+                        child->bounds.Add(m_triangles[triIndex].bounds);
+                        child->centerBounds.Add(m_triangles[triIndex].center);
+                    }
+                }
+            }
+
+            static void InitRange(TriangleRange& range, const size_t begin)
+            {
+                range.begin = begin;
+                range.end = begin;
+                range.bounds.Reset();
+                range.centerBounds.Reset();
+            }
+
+            static unsigned GetLongestAxis(const FloatBounds& bounds)
+            {
+                auto longestAxis = 0u;
+                for (auto axis = 1u; axis < 3u; axis++)
+                {
+                    if (bounds.maxs[axis] - bounds.mins[axis] > bounds.maxs[longestAxis] - bounds.mins[longestAxis])
+                        longestAxis = axis;
+                }
+
+                return longestAxis;
+            }
+
+            const VertexData& m_vertex_data;
+            size_t m_tri_count;
+            size_t m_vertex_count;
+
+            CollisionTree* m_tree = nullptr;
+            std::vector<TriangleInfo> m_triangles;
+        };
+    } // namespace
+
+    uint16_t QuantizeMin(const float value, const float trans, const float scale)
+    {
+        const auto quantized = std::floor((value + trans) * scale);
+        return static_cast<uint16_t>(std::clamp(quantized, 0.0f, static_cast<float>(std::numeric_limits<uint16_t>::max())));
+    }
+
+    uint16_t QuantizeMax(const float value, const float trans, const float scale)
+    {
+        const auto quantized = std::ceil((value + trans) * scale);
+        return static_cast<uint16_t>(std::clamp(quantized, 0.0f, static_cast<float>(std::numeric_limits<uint16_t>::max())));
+    }
+
+    CollisionTree BuildCollisionTree(const VertexData& vertexData, const size_t triCount, const size_t vertexCount)
+    {
+        CollisionTreeBuilder builder(vertexData, triCount, vertexCount);
+        return builder.Build();
+    }
+} // namespace collision_tree
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace collision_tree
+{
+    // Nodes with this bit set in their child count reference leafs instead of other nodes
+    constexpr uint16_t LEAF_CHILDREN_FLAG = 0x8000u;
+    constexpr size_t MAX_LEAF_TRIANGLES = 4u;
+    constexpr size_t MAX_TRIANGLE_COUNT = UINT16_MAX;
+
+    struct VertexData
+    {
+        const void* positionData;
+        size_t positionDataStride;
+        const uint16_t* triData;
+    };
+
+    struct Aabb
+    {
+        uint16_t mins[3];
+        uint16_t maxs[3];
+    };
+
+    struct Node
+    {
+        Aabb aabb;
+        uint16_t childBeginIndex;
+        uint16_t childCount;
+    };
+
+    /**
+     * \brief An aabb tree over the triangles of a rigid vertex list.
+     * Positions are quantised as (position + trans) * scale into the full range of uint16_t.
+     * The root is the first node and the children of a node are stored next to each other.
+     * Each leaf is a single triangle index relative to the first triangle of the vertex list.
+     */
+    struct CollisionTree
+    {
+        float trans[3];
+        float scale[3];
+        std::vector<Node> nodes;
+        std::vector<uint16_t> leafs;
+    };
+
+    uint16_t QuantizeMin(float value, float trans, float scale);
+    uint16_t QuantizeMax(float value, float trans, float scale);
+
+    /**
+     * \brief Builds a collision tree by recursively splitting triangles with a binned surface area heuristic.
+     * Triangles that cannot be separated by their centers are split at their median center instead.
+     * The result only depends on the input data.
+     */
+    CollisionTree BuildCollisionTree(const VertexData& vertexData, size_t triCount, size_t vertexCount);
+} // namespace collision_tree
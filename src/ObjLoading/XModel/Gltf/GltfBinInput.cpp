@@ -2,6 +2,8 @@
 
 #include "XModel/Gltf/GltfConstants.h"
 
+#include <algorithm>
+#include <cstring>
 #include <exception>
 #include <format>
 #include <iostream>
@@ -10,7 +12,8 @@
 using namespace gltf;
 
 BinInput::BinInput()
-    : m_buffer_size(0u)
+    : m_buffer(nullptr),
+      m_buffer_size(0u)
 {
 }
 
@@ -19,7 +22,7 @@ bool BinInput::GetEmbeddedBuffer(const void*& buffer, size_t& bufferSize) const
     if (!m_buffer || !m_buffer_size)
         return false;
 
-    buffer = m_buffer.get();
+    buffer = m_buffer;
     bufferSize = m_buffer_size;
 
     return true;
@@ -39,21 +42,12 @@ bool BinInput::ReadGltfData(std::istream& stream)
     if (!Read(stream, &magic, sizeof(magic), "magic"))
         return false;
 
-    if (magic != GLTF_MAGIC)
-    {
-        std::cerr << "Invalid magic when trying to read GLB\n";
-        return false;
-    }
-
     uint32_t version;
     if (!Read(stream, &version, sizeof(version), "version"))
         return false;
 
-    if (version != GLTF_VERSION)
-    {
-        std::cerr << std::format("Unsupported version {} when trying to read GLB: Expected version {}\n", version, GLTF_VERSION);
+    if (!VerifyHeader(magic, version))
         return false;
-    }
 
     uint32_t fileLength;
     if (!Read(stream, &fileLength, sizeof(fileLength), "file length"))
@@ -71,27 +65,20 @@ bool BinInput::ReadGltfData(std::istream& stream)
 
         if (chunkMagic == CHUNK_MAGIC_JSON)
         {
-            const auto jsonBuffer = std::make_unique<uint8_t[]>(chunkLength + 1);
+            const auto jsonBuffer = std::make_unique<uint8_t[]>(chunkLength);
             if (!Read(stream, jsonBuffer.get(), chunkLength, "json"))
                 return false;
-            jsonBuffer[chunkLength] = 0u;
-
-            try
-            {
-                m_json = std::make_unique<nlohmann::json>(nlohmann::json::parse(jsonBuffer.get(), &jsonBuffer[chunkLength]));
-            }
-            catch (const nlohmann::json::exception& e)
-            {
-                std::cerr << std::format("Failed trying to parse JSON of GLB: {}\n", e.what());
+
+            if (!ParseJson(jsonBuffer.get(), chunkLength))
                 return false;
-            }
         }
         else if (chunkMagic == CHUNK_MAGIC_BIN)
         {
-            m_buffer = std::make_unique<uint8_t[]>(chunkLength);
+            m_buffer_storage = std::make_unique<uint8_t[]>(chunkLength);
+            m_buffer = m_buffer_storage.get();
             m_buffer_size = chunkLength;
 
-            if (!Read(stream, m_buffer.get(), m_buffer_size, "bin buffer"))
+            if (!Read(stream, m_buffer_storage.get(), m_buffer_size, "bin buffer"))
                 return false;
         }
         else
@@ -110,6 +97,109 @@ bool BinInput::ReadGltfData(std::istream& stream)
     return true;
 }
 
+bool BinInput::ReadGltfData(const void* data, const size_t dataSize)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+
+    constexpr auto headerSize = sizeof(uint32_t) * 3u;
+    if (dataSize < headerSize)
+    {
+        std::cerr << "Unexpected EOF while reading GLB header\n";
+        return false;
+    }
+
+    uint32_t magic;
+    uint32_t version;
+    std::memcpy(&magic, &bytes[0], sizeof(magic));
+    std::memcpy(&version, &bytes[sizeof(magic)], sizeof(version));
+    if (!VerifyHeader(magic, version))
+        return false;
+
+    constexpr auto chunkHeaderSize = sizeof(uint32_t) * 2u;
+    auto offset = headerSize;
+    while (dataSize - offset >= chunkHeaderSize)
+    {
+        uint32_t chunkLength;
+        uint32_t chunkMagic;
+        std::memcpy(&chunkLength, &bytes[offset], sizeof(chunkLength));
+        std::memcpy(&chunkMagic, &bytes[offset + sizeof(chunkLength)], sizeof(chunkMagic));
+        offset += chunkHeaderSize;
+
+        if (chunkLength > dataSize - offset)
+        {
+            std::cerr << "Unexpected EOF while reading GLB chunk\n";
+            return false;
+        }
+
+        if (chunkMagic == CHUNK_MAGIC_JSON)
+        {
+            if (!ParseJson(&bytes[offset], chunkLength))
+                return false;
+        }
+        else if (chunkMagic == CHUNK_MAGIC_BIN)
+        {
+            m_buffer_storage.reset();
+            m_buffer = &bytes[offset];
+            m_buffer_size = chunkLength;
+        }
+
+        offset += chunkLength;
+        if (chunkLength % 4u > 0)
+            offset += std::min<size_t>(4u - (chunkLength % 4u), dataSize - offset);
+    }
+
+    if (!m_json)
+    {
+        std::cerr << "Failed to load GLB due to missing JSON\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool BinInput::ReadGltfFile(const std::filesystem::path& filePath)
+{
+    if (!m_mapped_file.Open(filePath))
+    {
+        std::cerr << std::format("Failed to map GLB file \"{}\" into memory\n", filePath.string());
+        return false;
+    }
+
+    return ReadGltfData(m_mapped_file.GetData(), m_mapped_file.GetSize());
+}
+
+bool BinInput::VerifyHeader(const uint32_t magic, const uint32_t version)
+{
+    if (magic != GLTF_MAGIC)
+    {
+        std::cerr << "Invalid magic when trying to read GLB\n";
+        return false;
+    }
+
+    if (version != GLTF_VERSION)
+    {
+        std::cerr << std::format("Unsupported version {} when trying to read GLB: Expected version {}\n", version, GLTF_VERSION);
+        return false;
+    }
+
+    return true;
+}
+
+bool BinInput::ParseJson(const uint8_t* data, const size_t dataSize)
+{
+    try
+    {
+        m_json = std::make_unique<nlohmann::json>(nlohmann::json::parse(data, &data[dataSize]));
+    }
+    catch (const nlohmann::json::exception& e)
+    {
+        std::cerr << std::format("Failed trying to parse JSON of GLB: {}\n", e.what());
+        return false;
+    }
+
+    return true;
+}
+
 bool BinInput::Read(std::istream& stream, void* dest, const size_t dataSize, const char* readTypeName, const bool errorWhenFailed)
 {
     stream.read(static_cast<char*>(dest), dataSize);
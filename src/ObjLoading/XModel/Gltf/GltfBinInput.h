@@ -1,7 +1,9 @@
 #pragma once
 
 #include "GltfInput.h"
+#include "Utils/MemoryMappedFile.h"
 
+#include <filesystem>
 #include <istream>
 
 namespace gltf
@@ -12,15 +14,31 @@ namespace gltf
         BinInput();
 
         bool ReadGltfData(std::istream& stream) override;
+
+        /**
+         * \brief Reads glb data that is already in memory without copying it.
+         * The data must stay valid for as long as the input is used.
+         */
+        bool ReadGltfData(const void* data, size_t dataSize);
+
+        /**
+         * \brief Maps the glb file into memory and uses its binary chunk in place.
+         */
+        bool ReadGltfFile(const std::filesystem::path& filePath);
+
         bool GetEmbeddedBuffer(const void*& buffer, size_t& bufferSize) const override;
         [[nodiscard]] const nlohmann::json& GetJson() const override;
 
     private:
         static bool Read(std::istream& stream, void* dest, size_t dataSize, const char* readTypeName, bool errorWhenFailed = true);
         static void Skip(std::istream& stream, size_t skipLength);
+        static bool VerifyHeader(uint32_t magic, uint32_t version);
+        bool ParseJson(const uint8_t* data, size_t dataSize);
 
         std::unique_ptr<nlohmann::json> m_json;
-        std::unique_ptr<uint8_t[]> m_buffer;
+        std::unique_ptr<uint8_t[]> m_buffer_storage;
+        const void* m_buffer;
         size_t m_buffer_size;
+        MemoryMappedFile m_mapped_file;
     };
 } // namespace gltf
@@ -8,12 +8,14 @@
 #include <Eigen>
 #pragma warning(pop)
 
+#include <algorithm>
 #include <deque>
 #include <exception>
 #include <format>
 #include <iostream>
 #include <limits>
 #include <nlohmann/json.hpp>
+#include <span>
 #include <string>
 
 using namespace gltf;
@@ -261,42 +263,56 @@ namespace
             const auto vertexOffset = static_cast<unsigned>(common.m_vertices.size());
             common.m_vertices.reserve(vertexOffset + vertexCount);
             common.m_vertex_bone_weights.reserve(vertexOffset + vertexCount);
-            for (auto vertexIndex = 0u; vertexIndex < vertexCount; vertexIndex++)
-            {
-                XModelVertex vertex;
 
-                unsigned joints[4];
-                float weights[4];
+            // Read vertex data in chunks to have one call per accessor without buffering all vertices at once
+            constexpr auto verticesPerChunk = 1024uz;
+            std::vector<float> coordinates(verticesPerChunk * 3u);
+            std::vector<float> normals(verticesPerChunk * 3u);
+            std::vector<float> colors(verticesPerChunk * 4u);
+            std::vector<float> uvs(verticesPerChunk * 2u);
+            std::vector<unsigned> joints(verticesPerChunk * 4u);
+            std::vector<float> weights(verticesPerChunk * 4u);
 
-                float coordinates[3];
-                float normal[3];
-                if (!positionAccessor->GetFloatVec3(vertexIndex, coordinates) || !normalAccessor->GetFloatVec3(vertexIndex, normal)
-                    || !colorAccessor->GetFloatVec4(vertexIndex, vertex.color) || !uvAccessor->GetFloatVec2(vertexIndex, vertex.uv)
-                    || !jointsAccessor->GetUnsignedVec4(vertexIndex, joints) || !weightsAccessor->GetFloatVec4(vertexIndex, weights))
+            for (auto chunkOffset = 0uz; chunkOffset < vertexCount; chunkOffset += verticesPerChunk)
+            {
+                const auto chunkVertexCount = std::min(verticesPerChunk, vertexCount - chunkOffset);
+                if (!positionAccessor->GetFloatVecs(chunkOffset, 3u, std::span(coordinates).first(chunkVertexCount * 3u))
+                    || !normalAccessor->GetFloatVecs(chunkOffset, 3u, std::span(normals).first(chunkVertexCount * 3u))
+                    || !colorAccessor->GetFloatVecs(chunkOffset, 4u, std::span(colors).first(chunkVertexCount * 4u))
+                    || !uvAccessor->GetFloatVecs(chunkOffset, 2u, std::span(uvs).first(chunkVertexCount * 2u))
+                    || !jointsAccessor->GetUnsignedVecs(chunkOffset, 4u, std::span(joints).first(chunkVertexCount * 4u))
+                    || !weightsAccessor->GetFloatVecs(chunkOffset, 4u, std::span(weights).first(chunkVertexCount * 4u)))
                 {
                     return false;
                 }
 
-                vertex.coordinates[0] = coordinates[0];
-                vertex.coordinates[1] = -coordinates[2];
-                vertex.coordinates[2] = coordinates[1];
-                vertex.normal[0] = normal[0];
-                vertex.normal[1] = -normal[2];
-                vertex.normal[2] = normal[1];
+                for (auto vertexIndex = 0uz; vertexIndex < chunkVertexCount; vertexIndex++)
+                {
+                    XModelVertex vertex;
 
-                common.m_vertices.emplace_back(vertex);
+                    vertex.coordinates[0] = coordinates[vertexIndex * 3u + 0u];
+                    vertex.coordinates[1] = -coordinates[vertexIndex * 3u + 2u];
+                    vertex.coordinates[2] = coordinates[vertexIndex * 3u + 1u];
+                    vertex.normal[0] = normals[vertexIndex * 3u + 0u];
+                    vertex.normal[1] = -normals[vertexIndex * 3u + 2u];
+                    vertex.normal[2] = normals[vertexIndex * 3u + 1u];
+                    std::copy_n(&colors[vertexIndex * 4u], std::extent_v<decltype(vertex.color)>, vertex.color);
+                    std::copy_n(&uvs[vertexIndex * 2u], std::extent_v<decltype(vertex.uv)>, vertex.uv);
 
-                XModelVertexBoneWeights vertexWeights{.weightOffset = static_cast<unsigned>(common.m_bone_weight_data.weights.size()), .weightCount = 0u};
-                for (auto i = 0u; i < std::extent_v<decltype(joints)>; i++)
-                {
-                    if (std::abs(weights[i]) < std::numeric_limits<float>::epsilon())
-                        continue;
+                    common.m_vertices.emplace_back(vertex);
 
-                    common.m_bone_weight_data.weights.emplace_back(joints[i], weights[i]);
-                    vertexWeights.weightCount++;
-                }
+                    XModelVertexBoneWeights vertexWeights{.weightOffset = static_cast<unsigned>(common.m_bone_weight_data.weights.size()), .weightCount = 0u};
+                    for (auto i = vertexIndex * 4u; i < vertexIndex * 4u + 4u; i++)
+                    {
+                        if (std::abs(weights[i]) < std::numeric_limits<float>::epsilon())
+                            continue;
+
+                        common.m_bone_weight_data.weights.emplace_back(joints[i], weights[i]);
+                        vertexWeights.weightCount++;
+                    }
 
-                common.m_vertex_bone_weights.emplace_back(vertexWeights);
+                    common.m_vertex_bone_weights.emplace_back(vertexWeights);
+                }
             }
 
             m_vertex_offset_for_accessors.emplace(accessorsForVertex, vertexOffset);
@@ -343,19 +359,16 @@ namespace
             const auto faceCount = indexCount / 3u;
             object.m_faces.reserve(faceCount);
 
+            std::vector<unsigned> indices(indexCount);
+            if (!indexAccessor->GetUnsignedVecs(0u, 1u, indices))
+                return false;
+
             for (auto faceIndex = 0u; faceIndex < faceCount; faceIndex++)
             {
-                unsigned indices[3];
-                if (!indexAccessor->GetUnsigned(faceIndex * 3u + 0u, indices[0]) || !indexAccessor->GetUnsigned(faceIndex * 3u + 1u, indices[1])
-                    || !indexAccessor->GetUnsigned(faceIndex * 3u + 2u, indices[2]))
-                {
-                    return false;
-                }
-
                 object.m_faces.emplace_back(XModelFace{
-                    vertexOffset + indices[2],
-                    vertexOffset + indices[1],
-                    vertexOffset + indices[0],
+                    vertexOffset + indices[faceIndex * 3u + 2u],
+                    vertexOffset + indices[faceIndex * 3u + 1u],
+                    vertexOffset + indices[faceIndex * 3u + 0u],
                 });
             }
 
@@ -1,7 +1,125 @@
 #include "GltfAccessor.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
 using namespace gltf;
 
+namespace
+{
+    size_t GetAccessorComponentCount(const JsonAccessorType type)
+    {
+        switch (type)
+        {
+        case JsonAccessorType::SCALAR:
+            return 1u;
+        case JsonAccessorType::VEC2:
+            return 2u;
+        case JsonAccessorType::VEC3:
+            return 3u;
+        case JsonAccessorType::VEC4:
+        case JsonAccessorType::MAT2:
+            return 4u;
+        case JsonAccessorType::MAT3:
+            return 9u;
+        case JsonAccessorType::MAT4:
+            return 16u;
+        }
+
+        assert(false);
+        return 0u;
+    }
+
+    bool IsElementRangeInBounds(const size_t index, const size_t componentCount, const size_t outSize, const size_t accessorCount)
+    {
+        assert(componentCount > 0u);
+        assert(outSize % componentCount == 0u);
+
+        return index <= accessorCount && outSize / componentCount <= accessorCount - index;
+    }
+
+    template<typename TOut, typename TComponent> TOut ConvertComponent(const TComponent value)
+    {
+        if constexpr (std::is_same_v<TOut, TComponent>)
+            return value;
+        else if constexpr (std::is_same_v<TOut, float>)
+        {
+            // Return as normalized value between 0 and 1
+            return static_cast<float>(value) / static_cast<float>(std::numeric_limits<TComponent>::max());
+        }
+        else
+            return static_cast<TOut>(value);
+    }
+
+    template<typename TComponent, typename TOut> void ConvertComponents(const uint8_t* in, TOut* out, const size_t componentCount)
+    {
+        if constexpr (std::is_same_v<TOut, TComponent>)
+        {
+            std::memcpy(out, in, componentCount * sizeof(TComponent));
+        }
+        else
+        {
+            // Copy to an aligned chunk first so the conversion loop can be vectorized
+            constexpr size_t CHUNK_SIZE = 256u;
+            TComponent chunk[CHUNK_SIZE];
+            for (size_t offset = 0u; offset < componentCount; offset += CHUNK_SIZE)
+            {
+                const auto chunkComponentCount = std::min(CHUNK_SIZE, componentCount - offset);
+                std::memcpy(chunk, &in[offset * sizeof(TComponent)], chunkComponentCount * sizeof(TComponent));
+
+                for (size_t i = 0u; i < chunkComponentCount; i++)
+                    out[offset + i] = ConvertComponent<TOut>(chunk[i]);
+            }
+        }
+    }
+
+    template<typename TComponent, typename TOut>
+    bool ReadVecs(const BufferView& bufferView,
+                  const JsonAccessorType type,
+                  const size_t byteOffset,
+                  const size_t accessorCount,
+                  const size_t index,
+                  const size_t componentCount,
+                  const std::span<TOut> out)
+    {
+        if (!IsElementRangeInBounds(index, componentCount, out.size(), accessorCount))
+            return false;
+
+        const auto elementCount = out.size() / componentCount;
+        if (elementCount == 0u)
+            return true;
+
+        const auto accessorComponentCount = GetAccessorComponentCount(type);
+        const auto elementSize = accessorComponentCount * sizeof(TComponent);
+        const auto* data = bufferView.GetElementsData(index, elementCount, elementSize, byteOffset);
+        if (!data)
+            return false;
+
+        // Tightly packed elements that are read completely can be converted as one array
+        const auto stride = bufferView.GetElementStride(elementSize);
+        if (stride == elementSize && componentCount == accessorComponentCount)
+        {
+            ConvertComponents<TComponent>(data, out.data(), out.size());
+            return true;
+        }
+
+        const auto readComponentCount = std::min(componentCount, accessorComponentCount);
+        for (size_t elementIndex = 0u; elementIndex < elementCount; elementIndex++)
+        {
+            auto* outElement = &out[elementIndex * componentCount];
+            ConvertComponents<TComponent>(&data[elementIndex * stride], outElement, readComponentCount);
+
+            for (auto componentIndex = readComponentCount; componentIndex < componentCount; componentIndex++)
+                outElement[componentIndex] = std::is_same_v<TOut, float> && componentIndex == 3u ? static_cast<TOut>(1) : static_cast<TOut>(0);
+        }
+
+        return true;
+    }
+} // namespace
+
 NullAccessor::NullAccessor(const size_t count)
     : m_count(count)
 {
@@ -66,6 +184,26 @@ bool NullAccessor::GetUnsignedVec4(const size_t index, unsigned (&out)[4]) const
     return true;
 }
 
+bool NullAccessor::GetFloatVecs(const size_t index, const size_t componentCount, const std::span<float> out) const
+{
+    if (!IsElementRangeInBounds(index, componentCount, out.size(), m_count))
+        return false;
+
+    std::ranges::fill(out, 0.0f);
+
+    return true;
+}
+
+bool NullAccessor::GetUnsignedVecs(const size_t index, const size_t componentCount, const std::span<unsigned> out) const
+{
+    if (!IsElementRangeInBounds(index, componentCount, out.size(), m_count))
+        return false;
+
+    std::ranges::fill(out, 0u);
+
+    return true;
+}
+
 std::optional<JsonAccessorComponentType> NullAccessor::GetComponentType() const
 {
     return std::nullopt;
@@ -145,6 +283,26 @@ bool OnesAccessor::GetUnsignedVec4(const size_t index, unsigned (&out)[4]) const
     return true;
 }
 
+bool OnesAccessor::GetFloatVecs(const size_t index, const size_t componentCount, const std::span<float> out) const
+{
+    if (!IsElementRangeInBounds(index, componentCount, out.size(), m_count))
+        return false;
+
+    std::ranges::fill(out, 1.0f);
+
+    return true;
+}
+
+bool OnesAccessor::GetUnsignedVecs(const size_t index, const size_t componentCount, const std::span<unsigned> out) const
+{
+    if (!IsElementRangeInBounds(index, componentCount, out.size(), m_count))
+        return false;
+
+    std::ranges::fill(out, 0xFFFFFFFFu);
+
+    return true;
+}
+
 std::optional<JsonAccessorComponentType> OnesAccessor::GetComponentType() const
 {
     return std::nullopt;
@@ -220,6 +378,16 @@ bool FloatAccessor::GetUnsignedVec4(size_t index, unsigned (&out)[4]) const
     return false;
 }
 
+bool FloatAccessor::GetFloatVecs(const size_t index, const size_t componentCount, const std::span<float> out) const
+{
+    return ReadVecs<float>(*m_buffer_view, m_type, m_byte_offset, m_count, index, componentCount, out);
+}
+
+bool FloatAccessor::GetUnsignedVecs(size_t index, size_t componentCount, std::span<unsigned> out) const
+{
+    return false;
+}
+
 UnsignedByteAccessor::UnsignedByteAccessor(const BufferView* bufferView, const JsonAccessorType type, size_t byteOffset, const size_t count)
     : m_buffer_view(bufferView),
       m_type(type),
@@ -328,6 +496,16 @@ bool UnsignedByteAccessor::GetUnsignedVec4(const size_t index, unsigned (&out)[4
     return true;
 }
 
+bool UnsignedByteAccessor::GetFloatVecs(const size_t index, const size_t componentCount, const std::span<float> out) const
+{
+    return ReadVecs<uint8_t>(*m_buffer_view, m_type, m_byte_offset, m_count, index, componentCount, out);
+}
+
+bool UnsignedByteAccessor::GetUnsignedVecs(const size_t index, const size_t componentCount, const std::span<unsigned> out) const
+{
+    return ReadVecs<uint8_t>(*m_buffer_view, m_type, m_byte_offset, m_count, index, componentCount, out);
+}
+
 UnsignedShortAccessor::UnsignedShortAccessor(const BufferView* bufferView, const JsonAccessorType type, size_t byteOffset, const size_t count)
     : m_buffer_view(bufferView),
       m_type(type),
@@ -436,6 +614,16 @@ bool UnsignedShortAccessor::GetUnsignedVec4(const size_t index, unsigned (&out)[
     return true;
 }
 
+bool UnsignedShortAccessor::GetFloatVecs(const size_t index, const size_t componentCount, const std::span<float> out) const
+{
+    return ReadVecs<uint16_t>(*m_buffer_view, m_type, m_byte_offset, m_count, index, componentCount, out);
+}
+
+bool UnsignedShortAccessor::GetUnsignedVecs(const size_t index, const size_t componentCount, const std::span<unsigned> out) const
+{
+    return ReadVecs<uint16_t>(*m_buffer_view, m_type, m_byte_offset, m_count, index, componentCount, out);
+}
+
 UnsignedIntAccessor::UnsignedIntAccessor(const BufferView* bufferView, const JsonAccessorType type, size_t byteOffset, const size_t count)
     : m_buffer_view(bufferView),
       m_type(type),
@@ -543,3 +731,13 @@ bool UnsignedIntAccessor::GetUnsignedVec4(const size_t index, unsigned (&out)[4]
 
     return true;
 }
+
+bool UnsignedIntAccessor::GetFloatVecs(const size_t index, const size_t componentCount, const std::span<float> out) const
+{
+    return ReadVecs<uint32_t>(*m_buffer_view, m_type, m_byte_offset, m_count, index, componentCount, out);
+}
+
+bool UnsignedIntAccessor::GetUnsignedVecs(const size_t index, const size_t componentCount, const std::span<unsigned> out) const
+{
+    return ReadVecs<uint32_t>(*m_buffer_view, m_type, m_byte_offset, m_count, index, componentCount, out);
+}
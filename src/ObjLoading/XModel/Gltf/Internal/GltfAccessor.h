@@ -2,6 +2,8 @@
 #include "GltfBufferView.h"
 #include "XModel/Gltf/JsonGltf.h"
 
+#include <span>
+
 namespace gltf
 {
     class Accessor
@@ -25,6 +27,18 @@ namespace gltf
         [[nodiscard]] virtual bool GetFloatVec4(size_t index, float (&out)[4]) const = 0;
         [[nodiscard]] virtual bool GetUnsigned(size_t index, unsigned& out) const = 0;
         [[nodiscard]] virtual bool GetUnsignedVec4(size_t index, unsigned (&out)[4]) const = 0;
+
+        /**
+         * \brief Reads out.size() / componentCount consecutive elements starting at the specified index into a tightly packed array.
+         * Integer components are normalized. Components the accessor does not have are 0, except for a fourth component which is 1.
+         */
+        [[nodiscard]] virtual bool GetFloatVecs(size_t index, size_t componentCount, std::span<float> out) const = 0;
+
+        /**
+         * \brief Reads out.size() / componentCount consecutive elements starting at the specified index into a tightly packed array.
+         * Components the accessor does not have are 0.
+         */
+        [[nodiscard]] virtual bool GetUnsignedVecs(size_t index, size_t componentCount, std::span<unsigned> out) const = 0;
     };
 
     class NullAccessor final : public Accessor
@@ -41,6 +55,8 @@ namespace gltf
         [[nodiscard]] bool GetFloatVec4(size_t index, float (&out)[4]) const override;
         [[nodiscard]] bool GetUnsigned(size_t index, unsigned& out) const override;
         [[nodiscard]] bool GetUnsignedVec4(size_t index, unsigned (&out)[4]) const override;
+        [[nodiscard]] bool GetFloatVecs(size_t index, size_t componentCount, std::span<float> out) const override;
+        [[nodiscard]] bool GetUnsignedVecs(size_t index, size_t componentCount, std::span<unsigned> out) const override;
 
     private:
         size_t m_count;
@@ -60,6 +76,8 @@ namespace gltf
         [[nodiscard]] bool GetFloatVec4(size_t index, float (&out)[4]) const override;
         [[nodiscard]] bool GetUnsigned(size_t index, unsigned& out) const override;
         [[nodiscard]] bool GetUnsignedVec4(size_t index, unsigned (&out)[4]) const override;
+        [[nodiscard]] bool GetFloatVecs(size_t index, size_t componentCount, std::span<float> out) const override;
+        [[nodiscard]] bool GetUnsignedVecs(size_t index, size_t componentCount, std::span<unsigned> out) const override;
 
     private:
         size_t m_count;
@@ -79,6 +97,8 @@ namespace gltf
         [[nodiscard]] bool GetFloatVec4(size_t index, float (&out)[4]) const override;
         [[nodiscard]] bool GetUnsigned(size_t index, unsigned& out) const override;
         [[nodiscard]] bool GetUnsignedVec4(size_t index, unsigned (&out)[4]) const override;
+        [[nodiscard]] bool GetFloatVecs(size_t index, size_t componentCount, std::span<float> out) const override;
+        [[nodiscard]] bool GetUnsignedVecs(size_t index, size_t componentCount, std::span<unsigned> out) const override;
 
     private:
         const BufferView* m_buffer_view;
@@ -101,6 +121,8 @@ namespace gltf
         [[nodiscard]] bool GetFloatVec4(size_t index, float (&out)[4]) const override;
         [[nodiscard]] bool GetUnsigned(size_t index, unsigned& out) const override;
         [[nodiscard]] bool GetUnsignedVec4(size_t index, unsigned (&out)[4]) const override;
+        [[nodiscard]] bool GetFloatVecs(size_t index, size_t componentCount, std::span<float> out) const override;
+        [[nodiscard]] bool GetUnsignedVecs(size_t index, size_t componentCount, std::span<unsigned> out) const override;
 
     private:
         const BufferView* m_buffer_view;
@@ -123,6 +145,8 @@ namespace gltf
         [[nodiscard]] bool GetFloatVec4(size_t index, float (&out)[4]) const override;
         [[nodiscard]] bool GetUnsigned(size_t index, unsigned& out) const override;
         [[nodiscard]] bool GetUnsignedVec4(size_t index, unsigned (&out)[4]) const override;
+        [[nodiscard]] bool GetFloatVecs(size_t index, size_t componentCount, std::span<float> out) const override;
+        [[nodiscard]] bool GetUnsignedVecs(size_t index, size_t componentCount, std::span<unsigned> out) const override;
 
     private:
         const BufferView* m_buffer_view;
@@ -145,6 +169,8 @@ namespace gltf
         [[nodiscard]] bool GetFloatVec4(size_t index, float (&out)[4]) const override;
         [[nodiscard]] bool GetUnsigned(size_t index, unsigned& out) const override;
         [[nodiscard]] bool GetUnsignedVec4(size_t index, unsigned (&out)[4]) const override;
+        [[nodiscard]] bool GetFloatVecs(size_t index, size_t componentCount, std::span<float> out) const override;
+        [[nodiscard]] bool GetUnsignedVecs(size_t index, size_t componentCount, std::span<unsigned> out) const override;
 
     private:
         const BufferView* m_buffer_view;
@@ -27,6 +27,11 @@ bool EmbeddedBuffer::ReadData(void* dest, const size_t offset, const size_t coun
     return true;
 }
 
+const uint8_t* EmbeddedBuffer::GetData() const
+{
+    return m_data;
+}
+
 size_t EmbeddedBuffer::GetSize() const
 {
     return m_data_size;
@@ -70,6 +75,11 @@ bool DataUriBuffer::ReadData(void* dest, const size_t offset, const size_t count
     return true;
 }
 
+const uint8_t* DataUriBuffer::GetData() const
+{
+    return m_data.get();
+}
+
 size_t DataUriBuffer::GetSize() const
 {
     return m_data_size;
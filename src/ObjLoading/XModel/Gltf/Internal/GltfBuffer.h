@@ -20,6 +20,7 @@ namespace gltf
         Buffer& operator=(Buffer&& other) noexcept = default;
 
         virtual bool ReadData(void* dest, size_t offset, size_t count) const = 0;
+        [[nodiscard]] virtual const uint8_t* GetData() const = 0;
         [[nodiscard]] virtual size_t GetSize() const = 0;
     };
 
@@ -29,6 +30,7 @@ namespace gltf
         EmbeddedBuffer(const void* data, size_t dataSize);
 
         bool ReadData(void* dest, size_t offset, size_t count) const override;
+        [[nodiscard]] const uint8_t* GetData() const override;
         [[nodiscard]] size_t GetSize() const override;
 
     private:
@@ -45,6 +47,7 @@ namespace gltf
         bool ReadDataFromUri(const std::string& uri);
 
         bool ReadData(void* dest, size_t offset, size_t count) const override;
+        [[nodiscard]] const uint8_t* GetData() const override;
         [[nodiscard]] size_t GetSize() const override;
 
     private:
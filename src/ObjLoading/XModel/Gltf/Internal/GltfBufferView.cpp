@@ -1,5 +1,8 @@
 #include "GltfBufferView.h"
 
+#include <algorithm>
+#include <cassert>
+
 using namespace gltf;
 
 BufferView::BufferView(const Buffer* buffer, const size_t offset, const size_t length, const size_t stride)
@@ -12,7 +15,7 @@ BufferView::BufferView(const Buffer* buffer, const size_t offset, const size_t l
 
 bool BufferView::ReadElement(void* dest, const size_t elementIndex, const size_t elementSize, const size_t elementOffset) const
 {
-    const auto stride = std::max(elementSize, m_stride);
+    const auto stride = GetElementStride(elementSize);
     const auto bufferViewOffset = elementOffset + elementIndex * stride;
     if (bufferViewOffset + elementSize > m_length)
         return false;
@@ -21,3 +24,20 @@ bool BufferView::ReadElement(void* dest, const size_t elementIndex, const size_t
 
     return m_buffer->ReadData(dest, bufferOffset, elementSize);
 }
+
+const uint8_t* BufferView::GetElementsData(const size_t elementIndex, const size_t elementCount, const size_t elementSize, const size_t elementOffset) const
+{
+    assert(elementCount > 0u);
+
+    const auto stride = GetElementStride(elementSize);
+    const auto bufferViewOffset = elementOffset + elementIndex * stride;
+    if (bufferViewOffset + (elementCount - 1u) * stride + elementSize > m_length)
+        return nullptr;
+
+    return &m_buffer->GetData()[m_offset + bufferViewOffset];
+}
+
+size_t BufferView::GetElementStride(const size_t elementSize) const
+{
+    return std::max(elementSize, m_stride);
+}
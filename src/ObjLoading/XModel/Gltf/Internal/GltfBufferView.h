@@ -10,6 +10,13 @@ namespace gltf
 
         bool ReadElement(void* dest, size_t elementIndex, size_t elementSize, size_t elementOffset) const;
 
+        /**
+         * \brief Returns the data of the first of a range of elements or nullptr if not all of them are inside the buffer view.
+         * Consecutive elements are GetElementStride bytes apart.
+         */
+        [[nodiscard]] const uint8_t* GetElementsData(size_t elementIndex, size_t elementCount, size_t elementSize, size_t elementOffset) const;
+        [[nodiscard]] size_t GetElementStride(size_t elementSize) const;
+
     private:
         const Buffer* m_buffer;
         size_t m_offset;
@@ -0,0 +1,319 @@
+#include "VertexCacheOptimization.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace vertex_cache
+{
+    namespace
+    {
+        // Parameters of the cache model as suggested by Tom Forsyth
+        constexpr size_t OPTIMIZATION_CACHE_SIZE = 32u;
+        constexpr float CACHE_DECAY_POWER = 1.5f;
+        constexpr float LAST_TRI_SCORE = 0.75f;
+        constexpr float VALENCE_BOOST_SCALE = 2.0f;
+        constexpr float VALENCE_BOOST_POWER = 0.5f;
+        constexpr size_t VALENCE_SCORE_TABLE_SIZE = 32u;
+
+        constexpr auto NOT_IN_CACHE = std::numeric_limits<size_t>::max();
+        constexpr auto NO_TRIANGLE = std::numeric_limits<size_t>::max();
+
+        class TriangleOrderOptimizer
+        {
+        public:
+            TriangleOrderOptimizer(const std::span<uint16_t> indices, const size_t vertexCount)
+                : m_indices(indices),
+                  m_tri_count(indices.size() / 3u),
+                  m_vertex_count(vertexCount)
+            {
+                InitScoreTables();
+            }
+
+            void Optimize()
+            {
+                if (m_tri_count == 0)
+                    return;
+
+                InitAdjacency();
+
+                std::vector<uint16_t> orderedIndices;
+                orderedIndices.reserve(m_tri_count * 3u);
+
+                auto bestTri = GetBestInitialTriangle();
+                auto nextUnaddedTri = 0uz;
+                for (auto addedTriCount = 0uz; addedTriCount < m_tri_count; addedTriCount++)
+                {
+                    // When no triangle uses a cached vertex, continue with the first remaining triangle
+                    if (bestTri == NO_TRIANGLE)
+                    {
+                        while (m_tri_added[nextUnaddedTri])
+                            nextUnaddedTri++;
+                        bestTri = nextUnaddedTri;
+                    }
+
+                    orderedIndices.insert(orderedIndices.end(), &m_indices[bestTri * 3u], &m_indices[bestTri * 3u + 3u]);
+                    bestTri = AddTriangle(bestTri);
+                }
+
+                std::ranges::copy(orderedIndices, m_indices.begin());
+            }
+
+        private:
+            void InitScoreTables()
+            {
+                for (auto cachePosition = 0uz; cachePosition < OPTIMIZATION_CACHE_SIZE; cachePosition++)
+                {
+                    // The vertices of the last triangle get a fixed score to not favour any of them
+                    if (cachePosition < 3u)
+                    {
+                        m_cache_position_scores[cachePosition] = LAST_TRI_SCORE;
+                        continue;
+                    }
+
+                    const auto scale = 1.0f / static_cast<float>(OPTIMIZATION_CACHE_SIZE - 3u);
+                    m_cache_position_scores[cachePosition] = std::pow(1.0f - static_cast<float>(cachePosition - 3u) * scale, CACHE_DECAY_POWER);
+                }
+
+                for (auto valence = 0uz; valence < VALENCE_SCORE_TABLE_SIZE; valence++)
+                    m_valence_scores[valence] = CalculateValenceScore(valence);
+            }
+
+            static float CalculateValenceScore(const size_t valence)
+            {
+                if (valence == 0u)
+                    return 0.0f;
+
+                // Prefer vertices with few remaining triangles to get rid of lone triangles early
+                return VALENCE_BOOST_SCALE * std::pow(static_cast<float>(valence), -VALENCE_BOOST_POWER);
+            }
+
+            void InitAdjacency()
+            {
+                m_vertex_tri_offsets.assign(m_vertex_count + 1u, 0u);
+                for (const auto index : m_indices)
+                {
+                    assert(index < m_vertex_count);
+                    m_vertex_tri_offsets[index + 1u]++;
+                }
+
+                m_vertex_live_tri_counts.resize(m_vertex_count);
+                for (auto vertexIndex = 0uz; vertexIndex < m_vertex_count; vertexIndex++)
+                {
+                    m_vertex_live_tri_counts[vertexIndex] = m_vertex_tri_offsets[vertexIndex + 1u];
+                    m_vertex_tri_offsets[vertexIndex + 1u] += m_vertex_tri_offsets[vertexIndex];
+                }
+
+                m_vertex_tris.resize(m_indices.size());
+                std::vector<size_t> vertexTriFill(m_vertex_tri_offsets.begin(), m_vertex_tri_offsets.end() - 1);
+                for (auto triIndex = 0uz; triIndex < m_tri_count; triIndex++)
+                {
+                    for (auto triVertex = 0u; triVertex < 3u; triVertex++)
+                        m_vertex_tris[vertexTriFill[m_indices[triIndex * 3u + triVertex]]++] = triIndex;
+                }
+
+                m_vertex_cache_positions.assign(m_vertex_count, NOT_IN_CACHE);
+                m_vertex_scores.resize(m_vertex_count);
+                for (auto vertexIndex = 0uz; vertexIndex < m_vertex_count; vertexIndex++)
+                    m_vertex_scores[vertexIndex] = CalculateVertexScore(vertexIndex);
+
+                m_tri_added.assign(m_tri_count, false);
+                m_tri_scores.resize(m_tri_count);
+                for (auto triIndex = 0uz; triIndex < m_tri_count; triIndex++)
+                    m_tri_scores[triIndex] = CalculateTriangleScore(triIndex);
+
+                m_cache.clear();
+                m_cache.reserve(OPTIMIZATION_CACHE_SIZE + 3u);
+            }
+
+            [[nodiscard]] float CalculateVertexScore(const size_t vertexIndex) const
+            {
+                const auto liveTriCount = m_vertex_live_tri_counts[vertexIndex];
+                if (liveTriCount == 0u)
+                    return -1.0f;
+
+                const auto cachePosition = m_vertex_cache_positions[vertexIndex];
+                const auto cacheScore = cachePosition != NOT_IN_CACHE ? m_cache_position_scores[cachePosition] : 0.0f;
+                const auto valenceScore = liveTriCount < VALENCE_SCORE_TABLE_SIZE ? m_valence_scores[liveTriCount] : CalculateValenceScore(liveTriCount);
+
+                return cacheScore + valenceScore;
+            }
+
+            [[nodiscard]] float CalculateTriangleScore(const size_t triIndex) const
+            {
+                const auto* triIndices = &m_indices[triIndex * 3u];
+                return m_vertex_scores[triIndices[0]] + m_vertex_scores[triIndices[1]] + m_vertex_scores[triIndices[2]];
+            }
+
+            [[nodiscard]] size_t GetBestInitialTriangle() const
+            {
+                const auto bestTri = std::ranges::max_element(m_tri_scores);
+                return static_cast<size_t>(bestTri - m_tri_scores.begin());
+            }
+
+            void RemoveTriangleFromVertex(const size_t vertexIndex, const size_t triIndex)
+            {
+                const auto begin = m_vertex_tris.begin() + static_cast<std::ptrdiff_t>(m_vertex_tri_offsets[vertexIndex]);
+                const auto end = begin + static_cast<std::ptrdiff_t>(m_vertex_live_tri_counts[vertexIndex]);
+
+                // Keep the remaining triangles in order so the result does not depend on the order they were added
+                const auto entry = std::find(begin, end, triIndex);
+                assert(entry != end);
+                std::copy(entry + 1, end, entry);
+                m_vertex_live_tri_counts[vertexIndex]--;
+            }
+
+            /**
+             * \brief Marks a triangle as added, updates the cache and scores and finds the next best triangle.
+             * \return The next best triangle or \c NO_TRIANGLE if none of the cached vertices have triangles left.
+             */
+            size_t AddTriangle(const size_t triIndex)
+            {
+                m_tri_added[triIndex] = true;
+
+                const auto* triIndices = &m_indices[triIndex * 3u];
+                for (auto triVertex = 0u; triVertex < 3u; triVertex++)
+                    RemoveTriangleFromVertex(triIndices[triVertex], triIndex);
+
+                // Move the vertices of the triangle to the front of the cache
+                std::erase_if(m_cache,
+                              [triIndices](const uint16_t vertexIndex)
+                              {
+                                  return vertexIndex == triIndices[0] || vertexIndex == triIndices[1] || vertexIndex == triIndices[2];
+                              });
+                auto insertPosition = m_cache.begin();
+                for (auto triVertex = 0u; triVertex < 3u; triVertex++)
+                {
+                    // Degenerate triangles may use a vertex more than once
+                    if (std::find(m_cache.begin(), insertPosition, triIndices[triVertex]) == insertPosition)
+                        insertPosition = m_cache.insert(insertPosition, triIndices[triVertex]) + 1;
+                }
+
+                for (auto cachePosition = 0uz; cachePosition < m_cache.size(); cachePosition++)
+                {
+                    const auto vertexIndex = m_cache[cachePosition];
+                    m_vertex_cache_positions[vertexIndex] = cachePosition < OPTIMIZATION_CACHE_SIZE ? cachePosition : NOT_IN_CACHE;
+                    m_vertex_scores[vertexIndex] = CalculateVertexScore(vertexIndex);
+                }
+
+                auto bestTri = NO_TRIANGLE;
+                auto bestTriScore = std::numeric_limits<float>::lowest();
+                for (const auto vertexIndex : m_cache)
+                {
+                    const auto trisBegin = m_vertex_tri_offsets[vertexIndex];
+                    const auto trisEnd = trisBegin + m_vertex_live_tri_counts[vertexIndex];
+                    for (auto vertexTri = trisBegin; vertexTri < trisEnd; vertexTri++)
+                    {
+                        const auto liveTriIndex = m_vertex_tris[vertexTri];
+                        const auto triScore = CalculateTriangleScore(liveTriIndex);
+                        m_tri_scores[liveTriIndex] = triScore;
+
+                        if (triScore > bestTriScore)
+                        {
+                            bestTri = liveTriIndex;
+                            bestTriScore = triScore;
+                        }
+                    }
+                }
+
+                if (m_cache.size() > OPTIMIZATION_CACHE_SIZE)
+                    m_cache.resize(OPTIMIZATION_CACHE_SIZE);
+
+                return bestTri;
+            }
+
+            std::span<uint16_t> m_indices;
+            size_t m_tri_count;
+            size_t m_vertex_count;
+
+            float m_cache_position_scores[OPTIMIZATION_CACHE_SIZE];
+            float m_valence_scores[VALENCE_SCORE_TABLE_SIZE];
+
+            std::vector<size_t> m_vertex_tri_offsets;
+            std::vector<size_t> m_vertex_live_tri_counts;
+            std::vector<size_t> m_vertex_tris;
+            std::vector<size_t> m_vertex_cache_positions;
+            std::vector<float> m_vertex_scores;
+
+            std::vector<bool> m_tri_added;
+            std::vector<float> m_tri_scores;
+
+            std::vector<uint16_t> m_cache;
+        };
+    } // namespace
+
+    CacheStatistics CalculateStatistics(const std::span<const uint16_t> indices, const size_t vertexCount, const size_t cacheSize)
+    {
+        const auto triCount = indices.size() / 3u;
+        if (triCount == 0)
+            return CacheStatistics{.acmr = 0.0f, .atvr = 0.0f};
+
+        // Simulate a fifo cache by remembering when each vertex entered it
+        std::vector<size_t> vertexCacheEntry(vertexCount, std::numeric_limits<size_t>::max());
+        std::vector<bool> vertexUsed(vertexCount, false);
+        auto transformCount = 0uz;
+        auto usedVertexCount = 0uz;
+
+        for (const auto index : indices)
+        {
+            assert(index < vertexCount);
+            if (vertexCacheEntry[index] == std::numeric_limits<size_t>::max() || transformCount - vertexCacheEntry[index] > cacheSize)
+            {
+                vertexCacheEntry[index] = transformCount;
+                transformCount++;
+            }
+
+            if (!vertexUsed[index])
+            {
+                vertexUsed[index] = true;
+                usedVertexCount++;
+            }
+        }
+
+        return CacheStatistics{
+            .acmr = static_cast<float>(transformCount) / static_cast<float>(triCount),
+            .atvr = static_cast<float>(transformCount) / static_cast<float>(usedVertexCount),
+        };
+    }
+
+    void OptimizeTriangleOrder(const std::span<uint16_t> indices, const size_t vertexCount)
+    {
+        TriangleOrderOptimizer optimizer(indices, vertexCount);
+        optimizer.Optimize();
+    }
+
+    std::vector<size_t> ReorderVerticesByFirstUse(const std::span<uint16_t> indices, const std::span<const size_t> vertexPartitions)
+    {
+        const auto vertexCount = vertexPartitions.size();
+
+        std::vector<size_t> firstUse(vertexCount, std::numeric_limits<size_t>::max());
+        for (auto i = 0uz; i < indices.size(); i++)
+        {
+            assert(indices[i] < vertexCount);
+            firstUse[indices[i]] = std::min(firstUse[indices[i]], i);
+        }
+
+        // Unused vertices keep their relative order behind the used ones of their partition
+        std::vector<size_t> newToOld(vertexCount);
+        std::iota(newToOld.begin(), newToOld.end(), 0uz);
+        std::ranges::stable_sort(newToOld,
+                                 [&vertexPartitions, &firstUse](const size_t vertex0, const size_t vertex1)
+                                 {
+                                     if (vertexPartitions[vertex0] != vertexPartitions[vertex1])
+                                         return vertexPartitions[vertex0] < vertexPartitions[vertex1];
+
+                                     return firstUse[vertex0] < firstUse[vertex1];
+                                 });
+
+        std::vector<size_t> oldToNew(vertexCount);
+        for (auto newIndex = 0uz; newIndex < vertexCount; newIndex++)
+            oldToNew[newToOld[newIndex]] = newIndex;
+
+        for (auto& index : indices)
+            index = static_cast<uint16_t>(oldToNew[index]);
+
+        return newToOld;
+    }
+} // namespace vertex_cache
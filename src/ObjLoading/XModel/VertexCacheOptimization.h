@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vertex_cache
+{
+    // Size of the fifo post transform cache that statistics are simulated with
+    constexpr size_t STATISTICS_CACHE_SIZE = 16u;
+
+    struct CacheStatistics
+    {
+        // Average cache miss ratio: Transformed vertices per triangle
+        float acmr;
+        // Average transform to vertex ratio: Transformed vertices per referenced vertex
+        float atvr;
+    };
+
+    CacheStatistics CalculateStatistics(std::span<const uint16_t> indices, size_t vertexCount, size_t cacheSize = STATISTICS_CACHE_SIZE);
+
+    /**
+     * \brief Reorders triangles to reuse recently transformed vertices as often as possible.
+     * Uses Tom Forsyth's linear-speed vertex cache optimisation. The vertices of each triangle keep their order so the winding does not change.
+     * \param indices Three vertex indices per triangle.
+     * \param vertexCount The amount of vertices the indices refer to.
+     */
+    void OptimizeTriangleOrder(std::span<uint16_t> indices, size_t vertexCount);
+
+    /**
+     * \brief Reorders vertices by their first use in the triangle list and updates the indices accordingly.
+     * Vertices are only moved within their partition so that groups of vertices that need to stay together are kept.
+     * \param indices Three vertex indices per triangle.
+     * \param vertexPartitions A partition number for each vertex. Partition numbers must not decrease with the vertex index.
+     * \return The previous index of each vertex in the new order.
+     */
+    std::vector<size_t> ReorderVerticesByFirstUse(std::span<uint16_t> indices, std::span<const size_t> vertexPartitions);
+} // namespace vertex_cache
@@ -1,9 +1,11 @@
 #include "ObjWriter.h"
 
+#include "Utils/BufferedTextWriter.h"
 #include "Utils/DistinctMapper.h"
 #include "XModel/Obj/ObjCommon.h"
 
-#include <format>
+#include <string>
+#include <vector>
 
 namespace
 {
@@ -25,7 +27,7 @@ namespace
     {
     public:
         ObjWriter(std::ostream& stream, std::string gameName, std::string zoneName, std::string mtlName)
-            : m_stream(stream),
+            : m_writer(stream),
               m_mtl_name(std::move(mtlName)),
               m_game_name(std::move(gameName)),
               m_zone_name(std::move(zoneName))
@@ -34,12 +36,12 @@ namespace
 
         void Write(const XModelCommon& xmodel) override
         {
-            m_stream << "# OpenAssetTools OBJ File ( " << m_game_name << ")\n";
-            m_stream << "# Game Origin: " << m_game_name << "\n";
-            m_stream << "# Zone Origin: " << m_zone_name << "\n";
+            m_writer << "# OpenAssetTools OBJ File ( " << m_game_name << ")\n";
+            m_writer << "# Game Origin: " << m_game_name << "\n";
+            m_writer << "# Zone Origin: " << m_zone_name << "\n";
 
             if (!m_mtl_name.empty())
-                m_stream << "mtllib " << m_mtl_name << "\n";
+                m_writer << "mtllib " << m_mtl_name << "\n";
 
             std::vector<ObjObjectDataOffsets> inputOffsetsByObject;
             std::vector<ObjObjectDataOffsets> distinctOffsetsByObject;
@@ -49,17 +51,17 @@ namespace
             for (const auto& object : xmodel.m_objects)
             {
                 const auto& objectData = m_object_data[objectIndex];
-                m_stream << "o " << object.name << "\n";
+                m_writer << "o " << object.name << "\n";
 
                 for (const auto& v : objectData.m_vertices.GetDistinctValues())
-                    m_stream << "v " << v.coordinates[0] << " " << v.coordinates[1] << " " << v.coordinates[2] << "\n";
+                    m_writer << "v " << v.coordinates[0] << " " << v.coordinates[1] << " " << v.coordinates[2] << "\n";
                 for (const auto& uv : objectData.m_uvs.GetDistinctValues())
-                    m_stream << "vt " << uv.uv[0] << " " << uv.uv[1] << "\n";
+                    m_writer << "vt " << uv.uv[0] << " " << uv.uv[1] << "\n";
                 for (const auto& n : objectData.m_normals.GetDistinctValues())
-                    m_stream << "vn " << n.normal[0] << " " << n.normal[1] << " " << n.normal[2] << "\n";
+                    m_writer << "vn " << n.normal[0] << " " << n.normal[1] << " " << n.normal[2] << "\n";
 
                 if (object.materialIndex >= 0 && static_cast<unsigned>(object.materialIndex) < xmodel.m_materials.size())
-                    m_stream << "usemtl " << xmodel.m_materials[object.materialIndex].name << "\n";
+                    m_writer << "usemtl " << xmodel.m_materials[object.materialIndex].name << "\n";
 
                 auto faceIndex = 0u;
                 for (const auto& f : object.m_faces)
@@ -81,12 +83,15 @@ namespace
                         objectData.m_uvs.GetDistinctPositionByInputPosition(faceVertexOffset + 2) + distinctOffsetsByObject[objectIndex].uvOffset + 1,
                     };
 
-                    m_stream << std::format("f {}/{}/{} {}/{}/{} {}/{}/{}\n", v[0], uv[0], n[0], v[1], uv[1], n[1], v[2], uv[2], n[2]);
+                    m_writer << "f " << v[0] << "/" << uv[0] << "/" << n[0] << " " << v[1] << "/" << uv[1] << "/" << n[1] << " " << v[2] << "/" << uv[2]
+                             << "/" << n[2] << "\n";
                     faceIndex++;
                 }
 
                 objectIndex++;
             }
+
+            m_writer.Flush();
         }
 
         void GetObjObjectDataOffsets(const XModelCommon& xmodel,
@@ -166,7 +171,7 @@ namespace
             objectData.m_uvs.Add(objUv);
         }
 
-        std::ostream& m_stream;
+        BufferedTextWriter m_writer;
         std::string m_mtl_name;
         std::string m_game_name;
         std::string m_zone_name;
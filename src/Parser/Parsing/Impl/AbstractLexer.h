@@ -10,6 +10,7 @@
 #include <concepts>
 #include <deque>
 #include <sstream>
+#include <string_view>
 
 template<std::derived_from<IParserValue> TokenType> class AbstractLexer : public ILexer<TokenType>
 {
@@ -182,6 +183,15 @@ protected:
      * \return The value of the read identifier
      */
     std::string ReadIdentifier()
+    {
+        return std::string(ReadIdentifierView());
+    }
+
+    /**
+     * \brief Reads an identifier from the current position without copying it
+     * \return A view of the read identifier that is only valid as long as the current line is cached
+     */
+    std::string_view ReadIdentifierView()
     {
         const auto& currentLine = CurrentLine();
         assert(m_current_line_offset >= 1);
@@ -199,7 +209,7 @@ protected:
             m_current_line_offset++;
         }
 
-        return std::string(currentLine.m_line, startPos, m_current_line_offset - startPos);
+        return std::string_view(currentLine.m_line).substr(startPos, m_current_line_offset - startPos);
     }
 
     /**
@@ -253,6 +263,15 @@ protected:
      * \return The value of the read identifier
      */
     std::string ReadString()
+    {
+        return std::string(ReadStringView());
+    }
+
+    /**
+     * \brief Reads a string from the current position without copying it
+     * \return A view of the read string that is only valid as long as the current line is cached
+     */
+    std::string_view ReadStringView()
     {
         const auto& currentLine = CurrentLine();
         assert(m_current_line_offset >= 1);
@@ -271,7 +290,7 @@ protected:
             m_current_line_offset++;
         }
 
-        return std::string(currentLine.m_line, startPos, m_current_line_offset++ - startPos);
+        return std::string_view(currentLine.m_line).substr(startPos, m_current_line_offset++ - startPos);
     }
 
     void ReadHexNumber(int& integerValue)
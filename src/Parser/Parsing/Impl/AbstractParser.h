@@ -4,8 +4,10 @@
 #include "Parsing/IParser.h"
 #include "Parsing/ParsingException.h"
 #include "Parsing/Sequence/AbstractSequence.h"
+#include "Parsing/Sequence/SequenceDispatchTable.h"
 
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 template<typename TokenType, typename ParserState> class AbstractParser : public IParser
@@ -19,15 +21,39 @@ public:
 protected:
     ILexer<TokenType>* m_lexer;
     std::unique_ptr<ParserState> m_state;
+    std::ostream* m_error_stream;
 
     explicit AbstractParser(ILexer<TokenType>* lexer, std::unique_ptr<ParserState> state)
         : m_lexer(lexer),
-          m_state(std::move(state))
+          m_state(std::move(state)),
+          m_error_stream(&std::cerr)
     {
     }
 
     virtual const std::vector<sequence_t*>& GetTestsForState() = 0;
 
+    /**
+     * \brief Returns the sequences of the current state that can start with the current token.
+     * When the token type supports it the candidates are looked up from a table built by the first sets of the sequences.
+     * The tables belong to this parser instance and are only reused while the sequence list still holds the same sequences,
+     * so a list that is modified or a new list allocated at the address of a previous one gets a new table.
+     */
+    const std::vector<sequence_t*>& GetCandidateTests()
+    {
+        const auto& availableTests = GetTestsForState();
+
+        if constexpr (FirstSetToken<TokenType>)
+        {
+            auto foundTable = m_dispatch_tables.find(&availableTests);
+            if (foundTable == m_dispatch_tables.end() || !foundTable->second.IsBuiltFrom(availableTests))
+                foundTable = m_dispatch_tables.insert_or_assign(&availableTests, SequenceDispatchTable<TokenType, ParserState>(availableTests)).first;
+
+            return foundTable->second.GetCandidates(m_lexer->GetToken(0));
+        }
+        else
+            return availableTests;
+    }
+
 public:
     ~AbstractParser() override = default;
     AbstractParser(const AbstractParser& other) = default;
@@ -35,6 +61,14 @@ public:
     AbstractParser& operator=(const AbstractParser& other) = default;
     AbstractParser& operator=(AbstractParser&& other) noexcept = default;
 
+    /**
+     * \brief Sets the stream that parsing errors are printed to. Defaults to \c std::cerr.
+     */
+    void SetErrorStream(std::ostream& errorStream)
+    {
+        m_error_stream = &errorStream;
+    }
+
     bool Parse() override
     {
         try
@@ -42,7 +76,7 @@ public:
             while (!m_lexer->IsEof())
             {
                 auto testSuccessful = false;
-                const auto& availableTests = GetTestsForState();
+                const auto& availableTests = GetCandidateTests();
 
                 for (const sequence_t* test : availableTests)
                 {
@@ -63,12 +97,12 @@ public:
 
                     if (!line.IsEof())
                     {
-                        std::cerr << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression:\n"
+                        *m_error_stream << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression:\n"
                                   << line.m_line.substr(pos.m_column - 1) << "\n";
                     }
                     else
                     {
-                        std::cerr << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression.\n";
+                        *m_error_stream << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression.\n";
                     }
                     return false;
                 }
@@ -81,11 +115,11 @@ public:
 
             if (!line.IsEof() && line.m_line.size() > static_cast<unsigned>(pos.m_column - 1))
             {
-                std::cerr << "Error: " << e.FullMessage() << "\n" << line.m_line.substr(pos.m_column - 1) << "\n";
+                *m_error_stream << "Error: " << e.FullMessage() << "\n" << line.m_line.substr(pos.m_column - 1) << "\n";
             }
             else
             {
-                std::cerr << "Error: " << e.FullMessage() << "\n";
+                *m_error_stream << "Error: " << e.FullMessage() << "\n";
             }
 
             return false;
@@ -93,4 +127,7 @@ public:
 
         return true;
     }
+
+private:
+    std::unordered_map<const std::vector<sequence_t*>*, SequenceDispatchTable<TokenType, ParserState>> m_dispatch_tables;
 };
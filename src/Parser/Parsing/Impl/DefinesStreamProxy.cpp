@@ -5,6 +5,7 @@
 #include "Parsing/Simple/Expression/ISimpleExpression.h"
 #include "Parsing/Simple/Expression/SimpleExpressionMatchers.h"
 #include "Parsing/Simple/SimpleExpressionInterpreter.h"
+#include "PreprocessedIncludeCache.h"
 #include "Utils/StringUtils.h"
 
 #include <regex>
@@ -165,10 +166,22 @@ DefinesStreamProxy::DefinesStreamProxy(IParserLineStream* stream, const bool ski
       m_ignore_depth(0),
       m_in_define(false),
       m_parameter_state(ParameterState::NOT_IN_PARAMETERS),
-      m_current_macro(nullptr)
+      m_current_macro(nullptr),
+      m_defines_fingerprint(0u),
+      m_include_cache(nullptr)
 {
 }
 
+class DefinesStreamProxy::IncludeRecording
+{
+public:
+    PreprocessedIncludeCache::Key m_key;
+    std::stack<BlockMode> m_modes;
+    std::shared_ptr<PreprocessedIncludeCache::Entry> m_entry;
+};
+
+DefinesStreamProxy::~DefinesStreamProxy() = default;
+
 int DefinesStreamProxy::GetLineEndEscapePos(const ParserLine& line)
 {
     for (auto linePos = line.m_line.size(); linePos > 0; linePos--)
@@ -311,10 +324,7 @@ bool DefinesStreamProxy::MatchUndefDirective(const ParserLine& line, const size_
         throw ParsingException(CreatePos(line, currentPos), "Cannot undef without a name.");
 
     const auto name = line.m_line.substr(nameStartPos, currentPos - nameStartPos);
-    const auto entry = m_defines.find(name);
-
-    if (entry != m_defines.end())
-        m_defines.erase(entry);
+    Undefine(name);
 
     return true;
 }
@@ -1079,7 +1089,19 @@ void DefinesStreamProxy::ProcessMacrosMultiLine(ParserLine& line)
 
 void DefinesStreamProxy::AddDefine(Define define)
 {
-    m_defines[define.m_name] = std::move(define);
+    if (m_include_recording)
+        m_include_recording->m_entry->m_define_changes.emplace_back(PreprocessedIncludeCache::DefineChange{define.m_name, define});
+
+    m_defines_fingerprint += GetDefineFingerprint(define);
+
+    const auto existingEntry = m_defines.find(define.m_name);
+    if (existingEntry != m_defines.end())
+    {
+        m_defines_fingerprint -= GetDefineFingerprint(existingEntry->second);
+        existingEntry->second = std::move(define);
+    }
+    else
+        m_defines.emplace(define.m_name, std::move(define));
 }
 
 void DefinesStreamProxy::Undefine(const std::string& name)
@@ -1087,15 +1109,170 @@ void DefinesStreamProxy::Undefine(const std::string& name)
     const auto entry = m_defines.find(name);
 
     if (entry != m_defines.end())
+    {
+        if (m_include_recording)
+            m_include_recording->m_entry->m_define_changes.emplace_back(PreprocessedIncludeCache::DefineChange{name, std::nullopt});
+
+        m_defines_fingerprint -= GetDefineFingerprint(entry->second);
         m_defines.erase(entry);
+    }
+}
+
+size_t DefinesStreamProxy::GetDefineFingerprint(const Define& define)
+{
+    auto hash = std::hash<std::string>()(define.m_name);
+    hash = hash * 31u + std::hash<std::string>()(define.m_value);
+    for (const auto& parameterPosition : define.m_parameter_positions)
+    {
+        hash = hash * 31u + parameterPosition.m_parameter_index;
+        hash = hash * 31u + parameterPosition.m_parameter_position;
+        hash = hash * 31u + (parameterPosition.m_stringize ? 1u : 0u);
+    }
+
+    return hash;
+}
+
+size_t DefinesStreamProxy::GetPragmaOnceFingerprint(const std::set<std::string>& pragmaOnceFiles)
+{
+    auto hash = pragmaOnceFiles.size();
+    for (const auto& file : pragmaOnceFiles)
+        hash = hash * 31u + std::hash<std::string>()(file);
+
+    return hash;
+}
+
+void DefinesStreamProxy::SetIncludeCache(PreprocessedIncludeCache* includeCache)
+{
+    m_include_cache = includeCache;
+}
+
+bool DefinesStreamProxy::CanCacheInclude() const
+{
+    return !m_in_define && m_multi_line_macro_parameters.m_parameter_state == ParameterState::NOT_IN_PARAMETERS
+           && (m_modes.empty() || m_modes.top() == BlockMode::IN_BLOCK);
+}
+
+bool DefinesStreamProxy::ReplayInclude(const ParserLine& directiveLine, const std::string& filename, std::set<std::string>& pragmaOnceFiles)
+{
+    if (!m_root_file_name)
+        m_root_file_name = directiveLine.m_filename;
+
+    // An include directive of the root file means a recorded include ended without the root file emitting another line in between
+    if (m_include_recording && directiveLine.m_filename == m_root_file_name)
+        FinishIncludeRecording();
+
+    if (!m_include_cache || m_include_recording || !CanCacheInclude())
+        return false;
+
+    const auto entry = m_include_cache->Find(PreprocessedIncludeCache::Key{
+        .m_file_name = filename,
+        .m_defines_fingerprint = m_defines_fingerprint,
+        .m_pragma_once_fingerprint = GetPragmaOnceFingerprint(pragmaOnceFiles),
+        .m_skip_directive_lines = m_skip_directive_lines,
+    });
+    if (!entry)
+        return false;
+
+    for (const auto& defineChange : entry->m_define_changes)
+    {
+        if (defineChange.m_define)
+            AddDefine(*defineChange.m_define);
+        else
+            Undefine(defineChange.m_name);
+    }
+
+    for (const auto& pragmaOnceFile : entry->m_pragma_once_files)
+        pragmaOnceFiles.emplace(pragmaOnceFile);
+
+    m_replayed_lines.insert(m_replayed_lines.end(), entry->m_lines.begin(), entry->m_lines.end());
+
+    return true;
+}
+
+void DefinesStreamProxy::OnIncludeOpened(const ParserLine& directiveLine, const std::string& filename, const std::set<std::string>& pragmaOnceFiles)
+{
+    // Only includes of the root file are recorded since only their end can be recognized by the root file continuing
+    if (!m_include_cache || m_include_recording || directiveLine.m_filename != m_root_file_name || !CanCacheInclude())
+        return;
+
+    m_include_recording = std::make_unique<IncludeRecording>(PreprocessedIncludeCache::Key{
+                                                                 .m_file_name = filename,
+                                                                 .m_defines_fingerprint = m_defines_fingerprint,
+                                                                 .m_pragma_once_fingerprint = GetPragmaOnceFingerprint(pragmaOnceFiles),
+                                                                 .m_skip_directive_lines = m_skip_directive_lines,
+                                                             },
+                                                             m_modes,
+                                                             std::make_shared<PreprocessedIncludeCache::Entry>());
+}
+
+void DefinesStreamProxy::OnPragmaOnce(const std::string& absoluteFilePath)
+{
+    if (m_include_recording)
+        m_include_recording->m_entry->m_pragma_once_files.emplace_back(absoluteFilePath);
+}
+
+void DefinesStreamProxy::FinishIncludeRecording()
+{
+    const auto recording = std::move(m_include_recording);
+
+    // Includes that leave a define, macro usage or conditional block open cannot be replayed on their own
+    if (CanCacheInclude() && m_modes == recording->m_modes)
+        m_include_cache->Add(std::move(recording->m_key), std::move(recording->m_entry));
+}
+
+ParserLine DefinesStreamProxy::NextInputLine()
+{
+    ParserLine line;
+    if (m_pending_input_line)
+    {
+        line = std::move(*m_pending_input_line);
+        m_pending_input_line.reset();
+    }
+    else
+        line = m_stream->NextLine();
+
+    if (!m_root_file_name && !line.IsEof())
+        m_root_file_name = line.m_filename;
+
+    if (m_include_recording && (line.IsEof() || line.m_filename == m_root_file_name))
+        FinishIncludeRecording();
+
+    return line;
 }
 
 ParserLine DefinesStreamProxy::NextLine()
 {
-    auto line = m_stream->NextLine();
+    if (m_replayed_lines.empty())
+    {
+        auto line = ProcessNextLine();
+        if (line)
+        {
+            if (m_include_recording)
+                m_include_recording->m_entry->m_lines.emplace_back(*line);
+
+            return std::move(*line);
+        }
+    }
+
+    auto replayedLine = std::move(m_replayed_lines.front());
+    m_replayed_lines.pop_front();
+
+    return replayedLine;
+}
+
+std::optional<ParserLine> DefinesStreamProxy::ProcessNextLine()
+{
+    auto line = NextInputLine();
 
     while (true)
     {
+        if (!m_replayed_lines.empty())
+        {
+            // The line was read after an include was replayed so it must only be processed after the replayed lines
+            m_pending_input_line = std::move(line);
+            return std::nullopt;
+        }
+
         if (m_in_define)
         {
             auto currentPos = 0uz;
@@ -1113,7 +1290,7 @@ ParserLine DefinesStreamProxy::NextLine()
                 return line;
             }
 
-            line = m_stream->NextLine();
+            line = NextInputLine();
         }
         else if (m_multi_line_macro_parameters.m_parameter_state != ParameterState::NOT_IN_PARAMETERS)
         {
@@ -1128,7 +1305,7 @@ ParserLine DefinesStreamProxy::NextLine()
                 return line;
             }
 
-            line = m_stream->NextLine();
+            line = NextInputLine();
         }
         else
         {
@@ -1155,5 +1332,5 @@ bool DefinesStreamProxy::IsOpen() const
 
 bool DefinesStreamProxy::Eof() const
 {
-    return m_stream->Eof();
+    return m_replayed_lines.empty() && !m_pending_input_line && m_stream->Eof();
 }
@@ -1,17 +1,23 @@
 #pragma once
 
 #include "AbstractDirectiveStreamProxy.h"
+#include "IncludingStreamProxy.h"
 #include "Parsing/IParserLineStream.h"
 #include "Parsing/Simple/Expression/ISimpleExpression.h"
 
 #include <cstddef>
+#include <deque>
 #include <map>
+#include <memory>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <stack>
 #include <vector>
 
-class DefinesStreamProxy final : public AbstractDirectiveStreamProxy
+class PreprocessedIncludeCache;
+
+class DefinesStreamProxy final : public AbstractDirectiveStreamProxy, public IIncludeCacheHandler
 {
 public:
     class DefineParameterPosition
@@ -61,10 +67,21 @@ public:
     };
 
     explicit DefinesStreamProxy(IParserLineStream* stream, bool skipDirectiveLines = false);
+    ~DefinesStreamProxy() override;
 
     void AddDefine(Define define);
     void Undefine(const std::string& name);
 
+    /**
+     * \brief Sets a cache for files included from the root file.
+     * The proxy must be set as include cache handler of the IncludingStreamProxy it reads from for the cache to be used.
+     */
+    void SetIncludeCache(PreprocessedIncludeCache* includeCache);
+
+    bool ReplayInclude(const ParserLine& directiveLine, const std::string& filename, std::set<std::string>& pragmaOnceFiles) override;
+    void OnIncludeOpened(const ParserLine& directiveLine, const std::string& filename, const std::set<std::string>& pragmaOnceFiles) override;
+    void OnPragmaOnce(const std::string& absoluteFilePath) override;
+
     [[nodiscard]] std::unique_ptr<ISimpleExpression> ParseExpression(std::shared_ptr<std::string> fileName, int lineNumber, std::string expressionString);
 
     ParserLine NextLine() override;
@@ -82,6 +99,15 @@ private:
         BLOCK_BLOCKED
     };
 
+    class IncludeRecording;
+
+    static size_t GetDefineFingerprint(const Define& define);
+    static size_t GetPragmaOnceFingerprint(const std::set<std::string>& pragmaOnceFiles);
+    [[nodiscard]] bool CanCacheInclude() const;
+    void FinishIncludeRecording();
+    ParserLine NextInputLine();
+    std::optional<ParserLine> ProcessNextLine();
+
     static int GetLineEndEscapePos(const ParserLine& line);
     void MatchDefineParameters(const ParserLine& line, size_t& currentPos);
     void ContinueDefine(const ParserLine& line, size_t currentPos);
@@ -135,4 +161,11 @@ private:
 
     const Define* m_current_macro;
     MacroParameterState m_multi_line_macro_parameters;
+
+    size_t m_defines_fingerprint;
+    PreprocessedIncludeCache* m_include_cache;
+    std::shared_ptr<std::string> m_root_file_name;
+    std::unique_ptr<IncludeRecording> m_include_recording;
+    std::deque<ParserLine> m_replayed_lines;
+    std::optional<ParserLine> m_pending_input_line;
 };
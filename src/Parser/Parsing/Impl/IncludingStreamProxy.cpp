@@ -8,10 +8,16 @@
 namespace fs = std::filesystem;
 
 IncludingStreamProxy::IncludingStreamProxy(IParserLineStream* stream)
-    : m_stream(stream)
+    : m_stream(stream),
+      m_include_cache_handler(nullptr)
 {
 }
 
+void IncludingStreamProxy::SetIncludeCacheHandler(IIncludeCacheHandler* includeCacheHandler)
+{
+    m_include_cache_handler = includeCacheHandler;
+}
+
 bool IncludingStreamProxy::ExtractIncludeFilename(const ParserLine& line,
                                                   const size_t includeDirectivePosition,
                                                   size_t& filenameStartPosition,
@@ -60,7 +66,7 @@ bool IncludingStreamProxy::ExtractIncludeFilename(const ParserLine& line,
     return false;
 }
 
-bool IncludingStreamProxy::MatchIncludeDirective(const ParserLine& line, const size_t directiveStartPos, const size_t directiveEndPos) const
+bool IncludingStreamProxy::MatchIncludeDirective(const ParserLine& line, const size_t directiveStartPos, const size_t directiveEndPos)
 {
     auto currentPos = directiveStartPos;
 
@@ -80,9 +86,15 @@ bool IncludingStreamProxy::MatchIncludeDirective(const ParserLine& line, const s
 
     const auto filename = line.m_line.substr(filenameStart, filenameEnd - filenameStart);
 
+    if (m_include_cache_handler && m_include_cache_handler->ReplayInclude(line, filename, m_included_files))
+        return true;
+
     if (!m_stream->IncludeFile(filename))
         throw ParsingException(CreatePos(line, currentPos), std::format("Could not include file \"{}\"", filename));
 
+    if (m_include_cache_handler)
+        m_include_cache_handler->OnIncludeOpened(line, filename, m_included_files);
+
     return true;
 }
 
@@ -109,8 +121,13 @@ bool IncludingStreamProxy::MatchPragmaOnceDirective(const ParserLine& line, cons
     if (existingPath != m_included_files.end())
         m_stream->PopCurrentFile();
     else
+    {
         m_included_files.emplace(absolutePathStr);
 
+        if (m_include_cache_handler)
+            m_include_cache_handler->OnPragmaOnce(absolutePathStr);
+    }
+
     return true;
 }
 
@@ -5,6 +5,36 @@
 
 #include <set>
 
+class IIncludeCacheHandler
+{
+public:
+    IIncludeCacheHandler() = default;
+    virtual ~IIncludeCacheHandler() = default;
+    IIncludeCacheHandler(const IIncludeCacheHandler& other) = default;
+    IIncludeCacheHandler(IIncludeCacheHandler&& other) noexcept = default;
+    IIncludeCacheHandler& operator=(const IIncludeCacheHandler& other) = default;
+    IIncludeCacheHandler& operator=(IIncludeCacheHandler&& other) noexcept = default;
+
+    /**
+     * \brief Called for every include directive before the included file is opened.
+     * \param directiveLine The line of the include directive.
+     * \param filename The name of the file to include.
+     * \param pragmaOnceFiles The files that were marked with pragma once. Files marked by a replayed include are added to it.
+     * \return \c true when the include was replayed from the cache and the file must not be opened.
+     */
+    virtual bool ReplayInclude(const ParserLine& directiveLine, const std::string& filename, std::set<std::string>& pragmaOnceFiles) = 0;
+
+    /**
+     * \brief Called after an included file that was not replayed was opened.
+     */
+    virtual void OnIncludeOpened(const ParserLine& directiveLine, const std::string& filename, const std::set<std::string>& pragmaOnceFiles) = 0;
+
+    /**
+     * \brief Called when a file was marked with pragma once for the first time.
+     */
+    virtual void OnPragmaOnce(const std::string& absoluteFilePath) = 0;
+};
+
 class IncludingStreamProxy final : public AbstractDirectiveStreamProxy
 {
     static constexpr const char* INCLUDE_QUOTES_ERROR = "Invalid include directive. Expected \"\" or <>";
@@ -14,16 +44,19 @@ class IncludingStreamProxy final : public AbstractDirectiveStreamProxy
 
     IParserLineStream* const m_stream;
     std::set<std::string> m_included_files;
+    IIncludeCacheHandler* m_include_cache_handler;
 
     _NODISCARD static bool
         ExtractIncludeFilename(const ParserLine& line, size_t includeDirectivePosition, size_t& filenameStartPosition, size_t& filenameEndPosition);
-    _NODISCARD bool MatchIncludeDirective(const ParserLine& line, size_t directiveStartPos, size_t directiveEndPos) const;
+    _NODISCARD bool MatchIncludeDirective(const ParserLine& line, size_t directiveStartPos, size_t directiveEndPos);
     _NODISCARD bool MatchPragmaOnceDirective(const ParserLine& line, size_t directiveStartPos, size_t directiveEndPos);
     _NODISCARD bool MatchDirectives(const ParserLine& line);
 
 public:
     explicit IncludingStreamProxy(IParserLineStream* stream);
 
+    void SetIncludeCacheHandler(IIncludeCacheHandler* includeCacheHandler);
+
     ParserLine NextLine() override;
     bool IncludeFile(const std::string& filename) override;
     void PopCurrentFile() override;
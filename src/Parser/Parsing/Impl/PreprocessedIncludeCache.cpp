@@ -0,0 +1,34 @@
+#include "PreprocessedIncludeCache.h"
+
+size_t PreprocessedIncludeCache::KeyHash::operator()(const Key& key) const
+{
+    auto hash = std::hash<std::string>()(key.m_file_name);
+    hash = hash * 31u + key.m_defines_fingerprint;
+    hash = hash * 31u + key.m_pragma_once_fingerprint;
+    hash = hash * 31u + (key.m_skip_directive_lines ? 1u : 0u);
+
+    return hash;
+}
+
+std::shared_ptr<const PreprocessedIncludeCache::Entry> PreprocessedIncludeCache::Find(const Key& key) const
+{
+    std::lock_guard lock(m_mutex);
+
+    const auto foundEntry = m_entries.find(key);
+    if (foundEntry == m_entries.end())
+        return nullptr;
+
+    return foundEntry->second;
+}
+
+void PreprocessedIncludeCache::Add(Key key, std::shared_ptr<const Entry> entry)
+{
+    std::lock_guard lock(m_mutex);
+    m_entries.try_emplace(std::move(key), std::move(entry));
+}
+
+size_t PreprocessedIncludeCache::GetEntryCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_entries.size();
+}
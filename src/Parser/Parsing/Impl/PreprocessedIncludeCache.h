@@ -0,0 +1,60 @@
+#pragma once
+
+#include "DefinesStreamProxy.h"
+#include "Parsing/IParserLineStream.h"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief Holds the result of preprocessing included files so that including them again in the same state does not need to read and process them again.
+ * Can be shared by multiple parsers concurrently.
+ */
+class PreprocessedIncludeCache
+{
+public:
+    class Key
+    {
+    public:
+        std::string m_file_name;
+        size_t m_defines_fingerprint;
+        size_t m_pragma_once_fingerprint;
+        bool m_skip_directive_lines;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    class DefineChange
+    {
+    public:
+        std::string m_name;
+        // Empty when the define was undefined
+        std::optional<DefinesStreamProxy::Define> m_define;
+    };
+
+    class Entry
+    {
+    public:
+        std::vector<ParserLine> m_lines;
+        std::vector<DefineChange> m_define_changes;
+        std::vector<std::string> m_pragma_once_files;
+    };
+
+    _NODISCARD std::shared_ptr<const Entry> Find(const Key& key) const;
+    void Add(Key key, std::shared_ptr<const Entry> entry);
+    _NODISCARD size_t GetEntryCount() const;
+
+private:
+    class KeyHash
+    {
+    public:
+        size_t operator()(const Key& key) const;
+    };
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<Key, std::shared_ptr<const Entry>, KeyHash> m_entries;
+};
@@ -2,6 +2,7 @@
 
 #include "Parsing/ILexer.h"
 #include "Parsing/IParserValue.h"
+#include "Parsing/Matcher/MatcherFirstSet.h"
 #include "Parsing/Matcher/MatcherResult.h"
 
 #include <functional>
@@ -32,6 +33,17 @@ protected:
 
     virtual MatcherResult<TokenType> CanMatch(ILexer<TokenType>* lexer, unsigned tokenOffset) = 0;
 
+    /**
+     * \brief Adds all tokens this matcher can start with to the first set.
+     * Matchers that cannot describe their first token add any token which disables dispatching for them.
+     * \return \c true if the matcher can match without consuming any token.
+     */
+    virtual bool AddFirstTokens(MatcherFirstSet& firstSet) const
+    {
+        firstSet.AddAnyToken();
+        return true;
+    }
+
 public:
     virtual ~AbstractMatcher() = default;
     AbstractMatcher(const AbstractMatcher& other) = default;
@@ -59,6 +71,17 @@ public:
         m_transform_func = std::move(transform);
     }
 
+    /**
+     * \brief Collects all tokens this matcher can start with.
+     * \return \c true if the following matcher may start at the same token.
+     */
+    bool CollectFirstSet(MatcherFirstSet& firstSet) const
+    {
+        const auto canMatchEmpty = AddFirstTokens(firstSet);
+
+        return canMatchEmpty || m_no_consume;
+    }
+
     MatcherResult<TokenType> Match(ILexer<TokenType>* lexer, const unsigned tokenOffset)
     {
         MatcherResult<TokenType> result = CanMatch(lexer, tokenOffset);
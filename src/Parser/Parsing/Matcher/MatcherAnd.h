@@ -31,6 +31,17 @@ protected:
         return matchResult;
     }
 
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override
+    {
+        for (const std::unique_ptr<AbstractMatcher<TokenType>>& matcher : m_matchers)
+        {
+            if (!matcher->CollectFirstSet(firstSet))
+                return false;
+        }
+
+        return true;
+    }
+
 public:
     MatcherAnd(std::initializer_list<Movable<std::unique_ptr<AbstractMatcher<TokenType>>>> matchers)
         : m_matchers(std::make_move_iterator(matchers.begin()), std::make_move_iterator(matchers.end()))
@@ -16,6 +16,11 @@ protected:
         return MatcherResult<TokenType>::NoMatch();
     }
 
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override
+    {
+        return false;
+    }
+
 public:
     MatcherFalse() = default;
 };
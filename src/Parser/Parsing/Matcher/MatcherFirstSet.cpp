@@ -0,0 +1,69 @@
+#include "MatcherFirstSet.h"
+
+#include "Utils/HashUtils.h"
+
+#include <algorithm>
+
+MatcherFirstSet::MatcherFirstSet()
+    : m_any_token(false)
+{
+}
+
+void MatcherFirstSet::AddAnyToken()
+{
+    m_any_token = true;
+}
+
+void MatcherFirstSet::AddTokenType(const int tokenType)
+{
+    if (!ContainsTokenType(tokenType))
+        m_token_types.emplace_back(tokenType);
+}
+
+void MatcherFirstSet::AddTokenValue(const int tokenType, const size_t valueHash)
+{
+    if (!ContainsTokenValue(tokenType, valueHash))
+        m_token_values.emplace_back(tokenType, valueHash);
+}
+
+void MatcherFirstSet::Add(const MatcherFirstSet& other)
+{
+    if (other.m_any_token)
+        m_any_token = true;
+
+    for (const auto tokenType : other.m_token_types)
+        AddTokenType(tokenType);
+
+    for (const auto& [tokenType, valueHash] : other.m_token_values)
+        AddTokenValue(tokenType, valueHash);
+}
+
+bool MatcherFirstSet::ContainsAnyToken() const
+{
+    return m_any_token;
+}
+
+bool MatcherFirstSet::ContainsTokenType(const int tokenType) const
+{
+    return std::ranges::find(m_token_types, tokenType) != m_token_types.end();
+}
+
+bool MatcherFirstSet::ContainsTokenValue(const int tokenType, const size_t valueHash) const
+{
+    return std::ranges::find(m_token_values, std::make_pair(tokenType, valueHash)) != m_token_values.end();
+}
+
+const std::vector<int>& MatcherFirstSet::GetTokenTypes() const
+{
+    return m_token_types;
+}
+
+const std::vector<std::pair<int, size_t>>& MatcherFirstSet::GetTokenValues() const
+{
+    return m_token_values;
+}
+
+size_t MatcherFirstSet::HashIgnoreCase(const std::string_view value)
+{
+    return static_cast<size_t>(utils::Fnv1a64IgnoreCase(value));
+}
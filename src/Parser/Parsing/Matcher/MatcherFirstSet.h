@@ -0,0 +1,50 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief The set of tokens a matcher can start with.
+ * Tokens are described by their type and optionally by a hash of their value.
+ * A set that contains any token cannot be used to rule out a matcher.
+ */
+class MatcherFirstSet
+{
+public:
+    MatcherFirstSet();
+
+    void AddAnyToken();
+    void AddTokenType(int tokenType);
+    void AddTokenValue(int tokenType, size_t valueHash);
+    void Add(const MatcherFirstSet& other);
+
+    [[nodiscard]] bool ContainsAnyToken() const;
+    [[nodiscard]] bool ContainsTokenType(int tokenType) const;
+    [[nodiscard]] bool ContainsTokenValue(int tokenType, size_t valueHash) const;
+    [[nodiscard]] const std::vector<int>& GetTokenTypes() const;
+    [[nodiscard]] const std::vector<std::pair<int, size_t>>& GetTokenValues() const;
+
+    /**
+     * \brief Hashes a string without regarding its case.
+     * Used for identifier tokens since keywords may be matched case-insensitively.
+     */
+    [[nodiscard]] static size_t HashIgnoreCase(std::string_view value);
+
+private:
+    bool m_any_token;
+    std::vector<int> m_token_types;
+    std::vector<std::pair<int, size_t>> m_token_values;
+};
+
+/**
+ * \brief A token that can describe itself in terms of a \c MatcherFirstSet.
+ * Parsers only dispatch sequences by their first token when their token type satisfies this.
+ */
+template<typename TokenType>
+concept FirstSetToken = requires(const TokenType& token) {
+    { token.FirstSetTokenType() } -> std::convertible_to<int>;
+    { token.FirstSetValueHash() } -> std::convertible_to<size_t>;
+};
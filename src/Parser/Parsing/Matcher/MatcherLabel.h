@@ -29,6 +29,7 @@ template<typename TokenType> class MatcherLabel final : public AbstractMatcher<T
 
     const IMatcherForLabelSupplier<TokenType>* m_supplier;
     int m_label;
+    mutable bool m_collecting_first_set;
 
 protected:
     MatcherResult<TokenType> CanMatch(ILexer<TokenType>* lexer, unsigned tokenOffset) override
@@ -42,10 +43,29 @@ protected:
         return MatcherResult<TokenType>::NoMatch();
     }
 
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override
+    {
+        const AbstractMatcher<TokenType>* matcher = m_supplier->GetMatcherForLabel(m_label);
+
+        // Left recursive labels cannot be resolved so just assume they can start with anything
+        if (!matcher || m_collecting_first_set)
+        {
+            firstSet.AddAnyToken();
+            return true;
+        }
+
+        m_collecting_first_set = true;
+        const auto canMatchEmpty = matcher->CollectFirstSet(firstSet);
+        m_collecting_first_set = false;
+
+        return canMatchEmpty;
+    }
+
 public:
     MatcherLabel(const IMatcherForLabelSupplier<TokenType>* supplier, const int label)
         : m_supplier(supplier),
-          m_label(label)
+          m_label(label),
+          m_collecting_first_set(false)
     {
     }
 };
@@ -35,6 +35,11 @@ protected:
         }
     }
 
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override
+    {
+        return m_matcher->CollectFirstSet(firstSet);
+    }
+
 public:
     explicit MatcherLoop(std::unique_ptr<AbstractMatcher<TokenType>> matcher)
         : m_matcher(std::move(matcher))
@@ -23,6 +23,12 @@ protected:
         return MatcherResult<TokenType>::Match(0);
     }
 
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override
+    {
+        m_matcher->CollectFirstSet(firstSet);
+        return true;
+    }
+
 public:
     explicit MatcherOptional(std::unique_ptr<AbstractMatcher<TokenType>> matcher)
         : m_matcher(std::move(matcher))
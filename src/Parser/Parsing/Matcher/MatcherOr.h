@@ -29,6 +29,18 @@ protected:
         return MatcherResult<TokenType>::NoMatch();
     }
 
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override
+    {
+        auto canMatchEmpty = false;
+        for (const std::unique_ptr<AbstractMatcher<TokenType>>& matcher : m_matchers)
+        {
+            if (matcher->CollectFirstSet(firstSet))
+                canMatchEmpty = true;
+        }
+
+        return canMatchEmpty;
+    }
+
 public:
     MatcherOr(std::initializer_list<Movable<std::unique_ptr<AbstractMatcher<TokenType>>>> matchers)
         : m_matchers(std::make_move_iterator(matchers.begin()), std::make_move_iterator(matchers.end()))
@@ -16,6 +16,11 @@ protected:
         return MatcherResult<TokenType>::Match(0);
     }
 
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override
+    {
+        return true;
+    }
+
 public:
     MatcherTrue() = default;
 };
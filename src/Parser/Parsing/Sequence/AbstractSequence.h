@@ -2,6 +2,7 @@
 
 #include "Parsing/Matcher/AbstractMatcher.h"
 #include "Parsing/Matcher/MatcherAnd.h"
+#include "Parsing/Matcher/MatcherFirstSet.h"
 #include "Parsing/Matcher/MatcherLabel.h"
 #include "SequenceResult.h"
 #include "Utils/ClassUtils.h"
@@ -72,6 +73,20 @@ public:
         return nullptr;
     }
 
+    /**
+     * \brief Collects all tokens this sequence can start with.
+     */
+    _NODISCARD MatcherFirstSet GetFirstSet() const
+    {
+        MatcherFirstSet firstSet;
+
+        // Sequences that can match without consuming anything can start with any token
+        if (m_entry && m_entry->CollectFirstSet(firstSet))
+            firstSet.AddAnyToken();
+
+        return firstSet;
+    }
+
     _NODISCARD bool MatchSequence(ILexer<TokenType>* lexer, ParserState* state, unsigned& consumedTokenCount) const
     {
         if (!m_entry)
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "AbstractSequence.h"
+#include "Parsing/Matcher/MatcherFirstSet.h"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief Preselects the sequences that can match a token by the first sets of the sequences.
+ * Candidates always keep the order of the original sequences so that the sequence matching first is the same as without the table.
+ */
+template<typename TokenType, typename ParserState> class SequenceDispatchTable
+{
+    // TokenType must inherit IParserValue
+    static_assert(std::is_base_of<IParserValue, TokenType>::value);
+
+public:
+    typedef AbstractSequence<TokenType, ParserState> sequence_t;
+
+private:
+    class TokenTypeCandidates
+    {
+    public:
+        std::vector<sequence_t*> m_sequences;
+        std::unordered_map<size_t, std::vector<sequence_t*>> m_sequences_by_value;
+    };
+
+    std::vector<sequence_t*> m_sequences;
+    std::vector<sequence_t*> m_any_token_sequences;
+    std::unordered_map<int, TokenTypeCandidates> m_candidates_by_type;
+
+public:
+    explicit SequenceDispatchTable(const std::vector<sequence_t*>& sequences)
+        : m_sequences(sequences)
+    {
+        std::vector<MatcherFirstSet> firstSets;
+        firstSets.reserve(sequences.size());
+        for (const auto* sequence : sequences)
+            firstSets.emplace_back(sequence->GetFirstSet());
+
+        for (const auto& firstSet : firstSets)
+        {
+            for (const auto tokenType : firstSet.GetTokenTypes())
+                m_candidates_by_type.try_emplace(tokenType);
+
+            for (const auto& [tokenType, valueHash] : firstSet.GetTokenValues())
+                m_candidates_by_type[tokenType].m_sequences_by_value.try_emplace(valueHash);
+        }
+
+        for (auto i = 0u; i < sequences.size(); i++)
+        {
+            auto* sequence = sequences[i];
+            const auto& firstSet = firstSets[i];
+
+            if (firstSet.ContainsAnyToken())
+                m_any_token_sequences.emplace_back(sequence);
+
+            for (auto& [tokenType, candidates] : m_candidates_by_type)
+            {
+                const auto matchesAllOfType = firstSet.ContainsAnyToken() || firstSet.ContainsTokenType(tokenType);
+                if (matchesAllOfType)
+                    candidates.m_sequences.emplace_back(sequence);
+
+                for (auto& [valueHash, valueSequences] : candidates.m_sequences_by_value)
+                {
+                    if (matchesAllOfType || firstSet.ContainsTokenValue(tokenType, valueHash))
+                        valueSequences.emplace_back(sequence);
+                }
+            }
+        }
+    }
+
+    /**
+     * \brief Returns all sequences that can start with the specified token in their original order.
+     */
+    _NODISCARD const std::vector<sequence_t*>& GetCandidates(const TokenType& token) const
+    {
+        const auto foundType = m_candidates_by_type.find(token.FirstSetTokenType());
+        if (foundType == m_candidates_by_type.end())
+            return m_any_token_sequences;
+
+        const auto& candidates = foundType->second;
+        if (!candidates.m_sequences_by_value.empty())
+        {
+            const auto foundValue = candidates.m_sequences_by_value.find(token.FirstSetValueHash());
+            if (foundValue != candidates.m_sequences_by_value.end())
+                return foundValue->second;
+        }
+
+        return candidates.m_sequences;
+    }
+
+    /**
+     * \brief Checks whether the table was built from exactly the specified sequences in the same order.
+     */
+    _NODISCARD bool IsBuiltFrom(const std::vector<sequence_t*>& sequences) const
+    {
+        return m_sequences == sequences;
+    }
+};
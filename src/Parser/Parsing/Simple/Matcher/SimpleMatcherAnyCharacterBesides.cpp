@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherAnyCharacterBesides::CanMatch(ILex
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherAnyCharacterBesides::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenType(static_cast<int>(SimpleParserValueType::CHARACTER));
+    return false;
+}
@@ -11,6 +11,7 @@ class SimpleMatcherAnyCharacterBesides final : public AbstractMatcher<SimplePars
 
 protected:
     MatcherResult<SimpleParserValue> CanMatch(ILexer<SimpleParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit SimpleMatcherAnyCharacterBesides(std::vector<char> chars);
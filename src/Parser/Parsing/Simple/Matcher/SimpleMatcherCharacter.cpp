@@ -11,3 +11,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherCharacter::CanMatch(ILexer<SimpleP
     return token.m_type == SimpleParserValueType::CHARACTER && token.CharacterValue() == m_char ? MatcherResult<SimpleParserValue>::Match(1)
                                                                                                 : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherCharacter::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenValue(static_cast<int>(SimpleParserValueType::CHARACTER), static_cast<unsigned char>(m_char));
+    return false;
+}
@@ -9,6 +9,7 @@ class SimpleMatcherCharacter final : public AbstractMatcher<SimpleParserValue>
 
 protected:
     MatcherResult<SimpleParserValue> CanMatch(ILexer<SimpleParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit SimpleMatcherCharacter(char c);
@@ -14,3 +14,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeyword::CanMatch(ILexer<SimplePar
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeyword::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenValue(static_cast<int>(SimpleParserValueType::IDENTIFIER), MatcherFirstSet::HashIgnoreCase(m_value));
+    return false;
+}
@@ -12,6 +12,7 @@ class SimpleMatcherKeyword final : public AbstractMatcher<SimpleParserValue>
 
 protected:
     MatcherResult<SimpleParserValue> CanMatch(ILexer<SimpleParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit SimpleMatcherKeyword(std::string value);
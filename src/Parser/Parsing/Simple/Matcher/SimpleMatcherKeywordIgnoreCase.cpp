@@ -29,3 +29,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeywordIgnoreCase::CanMatch(ILexer
 
     return MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeywordIgnoreCase::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenValue(static_cast<int>(SimpleParserValueType::IDENTIFIER), MatcherFirstSet::HashIgnoreCase(m_value));
+    return false;
+}
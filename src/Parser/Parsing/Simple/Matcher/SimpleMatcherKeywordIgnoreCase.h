@@ -11,6 +11,7 @@ class SimpleMatcherKeywordIgnoreCase final : public AbstractMatcher<SimpleParser
 
 protected:
     MatcherResult<SimpleParserValue> CanMatch(ILexer<SimpleParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit SimpleMatcherKeywordIgnoreCase(std::string value);
@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeywordPrefix::CanMatch(ILexer<Sim
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeywordPrefix::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenType(static_cast<int>(SimpleParserValueType::IDENTIFIER));
+    return false;
+}
@@ -11,6 +11,7 @@ class SimpleMatcherKeywordPrefix final : public AbstractMatcher<SimpleParserValu
 
 protected:
     MatcherResult<SimpleParserValue> CanMatch(ILexer<SimpleParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit SimpleMatcherKeywordPrefix(std::string value);
@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherMultiCharacter::CanMatch(ILexer<Si
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherMultiCharacter::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenValue(static_cast<int>(SimpleParserValueType::MULTI_CHARACTER), static_cast<size_t>(m_multi_character_sequence_id));
+    return false;
+}
@@ -9,6 +9,7 @@ class SimpleMatcherMultiCharacter final : public AbstractMatcher<SimpleParserVal
 
 protected:
     MatcherResult<SimpleParserValue> CanMatch(ILexer<SimpleParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit SimpleMatcherMultiCharacter(int multiCharacterSequenceId);
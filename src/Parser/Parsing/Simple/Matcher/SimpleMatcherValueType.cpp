@@ -9,3 +9,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherValueType::CanMatch(ILexer<SimpleP
 {
     return lexer->GetToken(tokenOffset).m_type == m_type ? MatcherResult<SimpleParserValue>::Match(1) : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherValueType::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenType(static_cast<int>(m_type));
+    return false;
+}
@@ -9,6 +9,7 @@ class SimpleMatcherValueType final : public AbstractMatcher<SimpleParserValue>
 
 protected:
     MatcherResult<SimpleParserValue> CanMatch(ILexer<SimpleParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit SimpleMatcherValueType(SimpleParserValueType type);
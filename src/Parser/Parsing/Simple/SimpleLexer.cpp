@@ -19,6 +19,7 @@ SimpleLexer::SimpleLexer(IParserLineStream* stream)
                .m_string_escape_sequences = false,
                .m_read_integer_numbers = true,
                .m_read_floating_point_numbers = true,
+               .m_use_token_arena = false,
                .m_multi_character_tokens = {}},
       m_check_for_multi_character_tokens(false),
       m_last_line(1)
@@ -127,7 +128,7 @@ SimpleParserValue SimpleLexer::GetNextToken()
     }
 
     if (m_config.m_read_strings && c == '\"')
-        return SimpleParserValue::String(pos, new std::string(m_config.m_string_escape_sequences ? ReadStringWithEscapeSequences() : ReadString()));
+        return CreateStringToken(pos);
 
     if (m_config.m_read_integer_numbers
         && (isdigit(c) || (c == '+' || c == '-' || (m_config.m_read_floating_point_numbers && c == '.')) && isdigit(PeekChar())))
@@ -153,11 +154,26 @@ SimpleParserValue SimpleLexer::GetNextToken()
     }
 
     if (isalpha(c) || c == '_')
-    {
-        auto identifier = ReadIdentifier();
-
-        return SimpleParserValue::Identifier(pos, new std::string(std::move(identifier)));
-    }
+        return CreateIdentifierToken(pos);
 
     return SimpleParserValue::Character(pos, static_cast<char>(c));
 }
+
+SimpleParserValue SimpleLexer::CreateStringToken(const TokenPos& pos)
+{
+    if (!m_config.m_use_token_arena)
+        return SimpleParserValue::String(pos, new std::string(m_config.m_string_escape_sequences ? ReadStringWithEscapeSequences() : ReadString()));
+
+    if (m_config.m_string_escape_sequences)
+        return SimpleParserValue::String(pos, m_token_arena.Intern(ReadStringWithEscapeSequences()));
+
+    return SimpleParserValue::String(pos, m_token_arena.Intern(ReadStringView()));
+}
+
+SimpleParserValue SimpleLexer::CreateIdentifierToken(const TokenPos& pos)
+{
+    if (!m_config.m_use_token_arena)
+        return SimpleParserValue::Identifier(pos, new std::string(ReadIdentifier()));
+
+    return SimpleParserValue::Identifier(pos, m_token_arena.Intern(ReadIdentifierView()));
+}
@@ -27,6 +27,12 @@ public:
         bool m_string_escape_sequences = false;
         bool m_read_integer_numbers = true;
         bool m_read_floating_point_numbers = true;
+
+        /**
+         * \brief Whether string and identifier tokens should refer to deduplicated text owned by the lexer instead of owning a copy each.
+         * Tokens must not outlive the lexer when this is enabled.
+         */
+        bool m_use_token_arena = false;
         std::vector<MultiCharacterToken> m_multi_character_tokens;
     };
 
@@ -50,8 +56,11 @@ protected:
     bool ReadMultiCharacterToken(const MultiCharacterTokenLookupEntry* multiTokenLookup);
 
     SimpleParserValue GetNextToken() override;
+    SimpleParserValue CreateStringToken(const TokenPos& pos);
+    SimpleParserValue CreateIdentifierToken(const TokenPos& pos);
 
     Config m_config;
     bool m_check_for_multi_character_tokens;
     size_t m_last_line;
+    TokenArena m_token_arena;
 };
@@ -1,5 +1,7 @@
 #include "SimpleParserValue.h"
 
+#include "Parsing/Matcher/MatcherFirstSet.h"
+
 #include <cassert>
 
 SimpleParserValue SimpleParserValue::Invalid(const TokenPos pos)
@@ -79,11 +81,29 @@ SimpleParserValue SimpleParserValue::Identifier(const TokenPos pos, std::string*
     return pv;
 }
 
+SimpleParserValue SimpleParserValue::String(const TokenPos pos, TokenArena::Entry& arenaEntry)
+{
+    SimpleParserValue pv(pos, SimpleParserValueType::STRING);
+    pv.m_value.string_value = &arenaEntry.m_value;
+    pv.m_owns_string = false;
+    return pv;
+}
+
+SimpleParserValue SimpleParserValue::Identifier(const TokenPos pos, TokenArena::Entry& arenaEntry)
+{
+    SimpleParserValue pv(pos, SimpleParserValueType::IDENTIFIER);
+    pv.m_value.string_value = &arenaEntry.m_value;
+    pv.m_hash = arenaEntry.m_hash;
+    pv.m_owns_string = false;
+    return pv;
+}
+
 SimpleParserValue::SimpleParserValue(const TokenPos pos, const SimpleParserValueType type)
     : m_pos(pos),
       m_type(type),
       m_hash(0),
       m_has_sign_prefix(false),
+      m_owns_string(true),
       m_value{}
 {
 }
@@ -94,7 +114,8 @@ SimpleParserValue::~SimpleParserValue()
     {
     case SimpleParserValueType::STRING:
     case SimpleParserValueType::IDENTIFIER:
-        delete m_value.string_value;
+        if (m_owns_string)
+            delete m_value.string_value;
         break;
 
     default:
@@ -109,6 +130,7 @@ SimpleParserValue::SimpleParserValue(SimpleParserValue&& other) noexcept
       m_type(other.m_type),
       m_hash(other.m_hash),
       m_has_sign_prefix(other.m_has_sign_prefix),
+      m_owns_string(other.m_owns_string),
       m_value(other.m_value)
 {
     other.m_value = ValueType();
@@ -121,6 +143,7 @@ SimpleParserValue& SimpleParserValue::operator=(SimpleParserValue&& other) noexc
     m_value = other.m_value;
     m_hash = other.m_hash;
     m_has_sign_prefix = other.m_has_sign_prefix;
+    m_owns_string = other.m_owns_string;
     other.m_value = ValueType();
 
     return *this;
@@ -177,3 +200,26 @@ size_t SimpleParserValue::IdentifierHash() const
     assert(m_type == SimpleParserValueType::IDENTIFIER);
     return m_hash;
 }
+
+int SimpleParserValue::FirstSetTokenType() const
+{
+    return static_cast<int>(m_type);
+}
+
+size_t SimpleParserValue::FirstSetValueHash() const
+{
+    switch (m_type)
+    {
+    case SimpleParserValueType::CHARACTER:
+        return static_cast<unsigned char>(m_value.char_value);
+
+    case SimpleParserValueType::MULTI_CHARACTER:
+        return static_cast<size_t>(m_value.multi_character_sequence_id);
+
+    case SimpleParserValueType::IDENTIFIER:
+        return MatcherFirstSet::HashIgnoreCase(*m_value.string_value);
+
+    default:
+        return 0u;
+    }
+}
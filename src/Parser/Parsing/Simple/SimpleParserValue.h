@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Parsing/IParserValue.h"
+#include "Parsing/TokenArena.h"
 #include "Parsing/TokenPos.h"
 #include "Utils/ClassUtils.h"
 
@@ -34,6 +35,7 @@ public:
     SimpleParserValueType m_type;
     size_t m_hash;
     bool m_has_sign_prefix;
+    bool m_owns_string;
 
     union ValueType
     {
@@ -56,6 +58,18 @@ public:
     static SimpleParserValue String(TokenPos pos, std::string* stringValue);
     static SimpleParserValue Identifier(TokenPos pos, std::string* identifier);
 
+    /**
+     * \brief Creates a string token that refers to text owned by a TokenArena instead of owning it.
+     * The arena must outlive the token.
+     */
+    static SimpleParserValue String(TokenPos pos, TokenArena::Entry& arenaEntry);
+
+    /**
+     * \brief Creates an identifier token that refers to text owned by a TokenArena instead of owning it.
+     * The arena must outlive the token.
+     */
+    static SimpleParserValue Identifier(TokenPos pos, TokenArena::Entry& arenaEntry);
+
 private:
     SimpleParserValue(TokenPos pos, SimpleParserValueType type);
 
@@ -76,4 +90,7 @@ public:
     _NODISCARD std::string& StringValue() const;
     _NODISCARD std::string& IdentifierValue() const;
     _NODISCARD size_t IdentifierHash() const;
+
+    _NODISCARD int FirstSetTokenType() const;
+    _NODISCARD size_t FirstSetValueHash() const;
 };
@@ -0,0 +1,25 @@
+#include "TokenArena.h"
+
+TokenArena::Entry::Entry(std::string value, const size_t hash)
+    : m_value(std::move(value)),
+      m_hash(hash)
+{
+}
+
+TokenArena::Entry& TokenArena::Intern(const std::string_view value)
+{
+    const auto existingEntry = m_entries_by_value.find(value);
+    if (existingEntry != m_entries_by_value.end())
+        return *existingEntry->second;
+
+    // The key must view the string owned by the entry since the passed value may not outlive this call
+    auto& entry = m_entries.emplace_back(std::string(value), std::hash<std::string_view>()(value));
+    m_entries_by_value.emplace(entry.m_value, &entry);
+
+    return entry;
+}
+
+size_t TokenArena::GetEntryCount() const
+{
+    return m_entries.size();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * \brief Owns the text of tokens for the lifetime of a lexer.
+ * Every distinct value is only stored once so tokens with the same text share the same string.
+ */
+class TokenArena
+{
+public:
+    class Entry
+    {
+    public:
+        std::string m_value;
+        size_t m_hash;
+
+        Entry(std::string value, size_t hash);
+    };
+
+    TokenArena() = default;
+    ~TokenArena() = default;
+    TokenArena(const TokenArena& other) = delete;
+    TokenArena& operator=(const TokenArena& other) = delete;
+
+    /**
+     * \brief Returns the entry for the specified value, creating it if it was not interned yet.
+     * The returned entry stays valid until the arena is destroyed.
+     */
+    Entry& Intern(std::string_view value);
+
+    _NODISCARD size_t GetEntryCount() const;
+
+private:
+    std::deque<Entry> m_entries;
+    std::unordered_map<std::string_view, Entry*> m_entries_by_value;
+};
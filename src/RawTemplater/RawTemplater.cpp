@@ -28,6 +28,7 @@ class RawTemplater::Impl
         templating::Templater templater(file, filename);
         if (m_write_build_log)
             templater.SetBuildLogFile(&m_build_log_file);
+        templater.SetJobCount(m_args.m_job_count);
         if (!m_args.m_output_directory.empty())
             return templater.TemplateToDirectory(m_args.m_output_directory);
 
@@ -2,6 +2,7 @@
 
 #include "GitVersion.h"
 #include "Utils/Arguments/CommandLineOption.h"
+#include "Utils/Arguments/JobCountOption.h"
 #include "Utils/Arguments/UsageInformation.h"
 
 #include <format>
@@ -44,6 +45,14 @@ const CommandLineOption* const OPTION_BUILD_LOG =
     .WithParameter("logFilePath")
     .Build();
 
+const CommandLineOption* const OPTION_JOBS =
+    CommandLineOption::Builder::Create()
+    .WithShortName("j")
+    .WithLongName("jobs")
+    .WithDescription("Specifies the amount of template variations to create concurrently. Specify 0 to use all hardware threads. Defaults to 1.")
+    .WithParameter("jobCount")
+    .Build();
+
 const CommandLineOption* const OPTION_DEFINE =
     CommandLineOption::Builder::Create()
     .WithShortName("d")
@@ -60,12 +69,14 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_VERBOSE,
     OPTION_OUTPUT_FOLDER,
     OPTION_BUILD_LOG,
+    OPTION_JOBS,
     OPTION_DEFINE,
 };
 
 RawTemplaterArguments::RawTemplaterArguments()
     : m_argument_parser(COMMAND_LINE_OPTIONS, std::extent_v<decltype(COMMAND_LINE_OPTIONS)>),
-      m_verbose(false)
+      m_verbose(false),
+      m_job_count(1u)
 {
 }
 
@@ -131,6 +142,10 @@ bool RawTemplaterArguments::ParseArgs(const int argc, const char** argv, bool& s
     if (m_argument_parser.IsOptionSpecified(OPTION_BUILD_LOG))
         m_build_log_file = m_argument_parser.GetValueForOption(OPTION_BUILD_LOG);
 
+    // -j; --jobs
+    if (!ReadJobCountOption(m_argument_parser, OPTION_JOBS, m_job_count))
+        return false;
+
     // -d; --define
     if (m_argument_parser.IsOptionSpecified(OPTION_DEFINE))
     {
@@ -23,6 +23,7 @@ public:
     std::string m_output_directory;
 
     std::string m_build_log_file;
+    unsigned m_job_count;
 
     std::vector<std::pair<std::string, std::string>> m_defines;
 
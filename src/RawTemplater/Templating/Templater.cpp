@@ -8,10 +8,16 @@
 #include "SetDefineStreamProxy.h"
 #include "TemplatingStreamProxy.h"
 #include "Utils/ClassUtils.h"
+#include "Utils/ThreadPool.h"
 
+#include <algorithm>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include <unordered_map>
 #include <vector>
 
@@ -58,260 +64,121 @@ namespace templating
         SWITCH
     };
 
-    class ITemplatingVariation
-    {
-    protected:
-        ITemplatingVariation() = default;
-
-    public:
-        virtual ~ITemplatingVariation() = default;
-        ITemplatingVariation(const ITemplatingVariation& other) = default;
-        ITemplatingVariation(ITemplatingVariation&& other) noexcept = default;
-        ITemplatingVariation& operator=(const ITemplatingVariation& other) = default;
-        ITemplatingVariation& operator=(ITemplatingVariation&& other) noexcept = default;
-
-        virtual const std::string& GetName() = 0;
-        virtual void Advance() = 0;
-        virtual void Apply(DefinesStreamProxy* definesProxy) = 0;
-        _NODISCARD virtual bool IsFinished() const = 0;
-        _NODISCARD virtual TemplatingVariationType GetVariationType() const = 0;
-    };
-
-    class SwitchVariation final : public ITemplatingVariation
+    /**
+     * \brief A switch or options directive of a template together with the value it takes in a pass.
+     */
+    class TemplatingVariation
     {
     public:
-        explicit SwitchVariation(std::string name)
-            : m_name(std::move(name)),
-              m_should_define(true),
-              m_finished(false)
+        TemplatingVariation(const TemplatingVariationType type, std::string name, std::vector<std::string> values)
+            : m_type(type),
+              m_name(std::move(name)),
+              m_values(std::move(values)),
+              m_value_index(0u)
         {
         }
 
-        const std::string& GetName() override
+        static TemplatingVariation Switch(std::string name)
         {
-            return m_name;
+            return TemplatingVariation(TemplatingVariationType::SWITCH, std::move(name), std::vector<std::string>());
         }
 
-        void Advance() override
+        static TemplatingVariation Options(std::string name, std::vector<std::string> values)
         {
-            if (!m_should_define)
-                m_finished = true;
-            else
-                m_should_define = false;
+            return TemplatingVariation(TemplatingVariationType::OPTIONS, std::move(name), std::move(values));
         }
 
-        void Apply(DefinesStreamProxy* definesProxy) override
+        void Apply(DefinesStreamProxy* definesProxy) const
         {
-            if (m_should_define)
-                definesProxy->AddDefine(DefinesStreamProxy::Define(m_name, "1"));
+            if (m_type == TemplatingVariationType::SWITCH)
+            {
+                // Switches are defined in their first pass and undefined in their second one
+                if (m_value_index == 0u)
+                    definesProxy->AddDefine(DefinesStreamProxy::Define(m_name, "1"));
+            }
+            else if (m_value_index < m_values.size())
+                definesProxy->AddDefine(DefinesStreamProxy::Define(m_name, m_values[m_value_index]));
         }
 
-        _NODISCARD bool IsFinished() const override
+        _NODISCARD size_t GetValueCount() const
         {
-            return m_finished;
-        }
+            if (m_type == TemplatingVariationType::SWITCH)
+                return 2u;
 
-        _NODISCARD TemplatingVariationType GetVariationType() const override
-        {
-            return TemplatingVariationType::SWITCH;
+            return m_values.size();
         }
 
+        TemplatingVariationType m_type;
         std::string m_name;
-        bool m_should_define;
-        bool m_finished;
+        std::vector<std::string> m_values;
+        size_t m_value_index;
     };
 
-    class OptionsVariation final : public ITemplatingVariation
+    class TemplatingPassResult
     {
     public:
-        OptionsVariation(std::string name, std::vector<std::string> values)
-            : m_name(std::move(name)),
-              m_values(std::move(values)),
-              m_value_offset(0u)
-        {
-        }
-
-        const std::string& GetName() override
-        {
-            return m_name;
-        }
-
-        void Advance() override
-        {
-            m_value_offset++;
-        }
-
-        void Apply(DefinesStreamProxy* definesProxy) override
-        {
-            if (m_value_offset < m_values.size())
-                definesProxy->AddDefine(DefinesStreamProxy::Define(m_name, m_values[m_value_offset]));
-        }
-
-        _NODISCARD bool IsFinished() const override
-        {
-            return m_value_offset >= m_values.size();
-        }
+        bool m_success = false;
+        bool m_skipped = false;
+        std::string m_error_messages;
 
-        _NODISCARD TemplatingVariationType GetVariationType() const override
-        {
-            return TemplatingVariationType::OPTIONS;
-        }
+        std::vector<TemplatingVariation> m_variations;
+        size_t m_predefined_variation_count = 0u;
 
-        std::string m_name;
-        std::vector<std::string> m_values;
-        size_t m_value_offset;
+        std::string m_output_file;
+        std::string m_output;
     };
 
+    /**
+     * \brief Runs a single pass over the template with a fixed set of variation values.
+     * Variations that are only discovered during the pass take their first value.
+     */
     class TemplaterControlImpl final : ITemplaterControl
     {
     public:
-        TemplaterControlImpl(std::istream& stream, std::string filename, const std::string& outputDirectory)
-            : m_stream(stream),
-              m_filename(std::move(filename)),
+        TemplaterControlImpl(std::string filename, const std::string& outputDirectory, std::vector<TemplatingVariation> variations)
+            : m_filename(std::move(filename)),
               m_output_directory(outputDirectory),
-              m_first_line(true),
-              m_skip_pass(false),
-              m_write_output_to_file(false)
+              m_write_output_to_file(false),
+              m_skip_pass(false)
         {
             const fs::path filenamePath(m_filename);
-            m_default_output_file = (m_output_directory / filenamePath.filename().replace_extension()).string();
+            m_output_file = (m_output_directory / filenamePath.filename().replace_extension()).string();
+
+            m_result.m_predefined_variation_count = variations.size();
+            m_result.m_variations = std::move(variations);
+            for (auto variationIndex = 0u; variationIndex < m_result.m_variations.size(); variationIndex++)
+                m_variations_by_name.emplace(m_result.m_variations[variationIndex].m_name, variationIndex);
         }
 
-        bool RunNextPass(std::ostream* buildLogFile)
+        TemplatingPassResult RunPass(const std::string& source)
         {
-            m_stream.clear();
-            m_stream.seekg(0, std::ios::beg);
-
-            m_output_file = m_default_output_file;
-            m_current_pass = TemplatingPass(m_stream, m_filename, this);
-
-            for (const auto& activeVariation : m_active_variations)
-                activeVariation->Apply(m_current_pass.m_defines_proxy.get());
-
-            while (!m_skip_pass && !m_current_pass.m_stream->Eof())
+            try
             {
-                auto nextLine = m_current_pass.m_stream->NextLine();
-
-                if (m_write_output_to_file)
-                {
-                    if (m_first_line)
-                        m_first_line = false;
-                    else
-                        m_output_stream << '\n';
-
-                    m_output_stream << nextLine.m_line;
-                }
-                else
-                {
-                    if (m_first_line)
-                        m_first_line = false;
-                    else
-                        m_output_cache << '\n';
-
-                    m_output_cache << nextLine.m_line;
-                }
+                m_result.m_success = RunPassInternal(source);
             }
-
-            if (m_skip_pass)
-                return true;
-
-            if (!m_write_output_to_file)
+            catch (ParsingException& e)
             {
-                if (!m_active_variations.empty())
-                {
-                    std::cerr << "Template with variations must specify a filename\n";
-                    return false;
-                }
-
-                if (!OpenOutputStream())
-                    return false;
-
-                const auto cachedData = m_output_cache.str();
-                if (!cachedData.empty())
-                    m_output_stream << cachedData;
+                m_error_messages << "Error: " << e.FullMessage() << "\n";
+                m_result.m_success = false;
             }
 
-            std::cout << "Templated file \"" << m_output_file << "\"\n";
-
-            if (buildLogFile)
-                *buildLogFile << "Templated file \"" << m_output_file << "\"\n";
-
-            m_first_line = true;
-            m_write_output_to_file = false;
-            m_output_cache.clear();
-            m_output_cache.str(std::string());
-            m_output_stream.close();
-
-            return true;
-        }
-
-        void AdvanceActiveVariations()
-        {
-            while (!m_active_variations.empty())
-            {
-                const auto& lastVariation = m_active_variations[m_active_variations.size() - 1];
-                lastVariation->Advance();
-
-                if (lastVariation->IsFinished())
-                {
-                    m_active_variations_by_name.erase(lastVariation->GetName());
-                    m_active_variations.pop_back();
-                }
-                else
-                    break;
-            }
-        }
+            m_result.m_skipped = m_skip_pass;
+            m_result.m_error_messages = m_error_messages.str();
+            m_result.m_output_file = std::move(m_output_file);
+            m_result.m_output = m_output.str();
 
-        _NODISCARD bool HasActiveVariations() const
-        {
-            return !m_active_variations.empty();
+            return std::move(m_result);
         }
 
     protected:
         bool AddSwitch(std::string switchName) override
         {
-            const auto existingVariation = m_active_variations_by_name.find(switchName);
-            if (existingVariation != m_active_variations_by_name.end())
-            {
-                const auto isValidRedefinition = existingVariation->second->GetVariationType() == TemplatingVariationType::SWITCH;
-
-                if (!isValidRedefinition)
-                    std::cerr << "Redefinition of \"" << switchName << "\" as switch is invalid\n";
-
-                return isValidRedefinition;
-            }
-
-            auto switchVariation = std::make_unique<SwitchVariation>(std::move(switchName));
-            if (m_current_pass.m_defines_proxy)
-                switchVariation->Apply(m_current_pass.m_defines_proxy.get());
-
-            m_active_variations_by_name.emplace(switchVariation->m_name, switchVariation.get());
-            m_active_variations.emplace_back(std::move(switchVariation));
-
-            return true;
+            return AddVariation(TemplatingVariation::Switch(std::move(switchName)), "switch");
         }
 
         bool AddOptions(std::string optionsName, std::vector<std::string> optionValues) override
         {
-            const auto existingVariation = m_active_variations_by_name.find(optionsName);
-            if (existingVariation != m_active_variations_by_name.end())
-            {
-                const auto isValidRedefinition = existingVariation->second->GetVariationType() == TemplatingVariationType::OPTIONS;
-
-                if (!isValidRedefinition)
-                    std::cerr << "Redefinition of \"" << optionsName << "\" as options is invalid\n";
-
-                return isValidRedefinition;
-            }
-
-            auto optionsVariation = std::make_unique<OptionsVariation>(std::move(optionsName), std::move(optionValues));
-            if (m_current_pass.m_defines_proxy)
-                optionsVariation->Apply(m_current_pass.m_defines_proxy.get());
-
-            m_active_variations_by_name.emplace(optionsVariation->m_name, optionsVariation.get());
-            m_active_variations.emplace_back(std::move(optionsVariation));
-
-            return true;
+            return AddVariation(TemplatingVariation::Options(std::move(optionsName), std::move(optionValues)), "options");
         }
 
         bool SetFileName(const std::string& fileName) override
@@ -320,15 +187,7 @@ namespace templating
                 return false;
 
             m_output_file = (m_output_directory / fileName).string();
-            if (!OpenOutputStream())
-                return false;
-
             m_write_output_to_file = true;
-            const auto cachedData = m_output_cache.str();
-            if (!cachedData.empty())
-                m_output_stream << cachedData;
-            m_output_cache.clear();
-            m_output_cache.str(std::string());
 
             return true;
         }
@@ -337,7 +196,7 @@ namespace templating
         {
             if (m_write_output_to_file)
             {
-                std::cerr << "Cannot skip when already writing to file\n";
+                m_error_messages << "Cannot skip when already writing to file\n";
                 return false;
             }
 
@@ -346,44 +205,137 @@ namespace templating
         }
 
     private:
-        bool OpenOutputStream()
+        bool RunPassInternal(const std::string& source)
         {
-            const auto parentDir = fs::path(m_output_file).parent_path();
-            if (!parentDir.empty())
-                create_directories(parentDir);
+            m_source_stream.str(source);
+            m_current_pass = TemplatingPass(m_source_stream, m_filename, this);
+
+            for (const auto& variation : m_result.m_variations)
+                variation.Apply(m_current_pass.m_defines_proxy.get());
+
+            auto firstLine = true;
+            while (!m_skip_pass && !m_current_pass.m_stream->Eof())
+            {
+                auto nextLine = m_current_pass.m_stream->NextLine();
+
+                if (firstLine)
+                    firstLine = false;
+                else
+                    m_output << '\n';
+
+                m_output << nextLine.m_line;
+            }
 
-            m_output_stream = std::ofstream(m_output_file, std::ios::out | std::ios::binary);
-            if (!m_output_stream.is_open())
+            if (m_skip_pass)
+                return true;
+
+            if (!m_write_output_to_file && !m_result.m_variations.empty())
             {
-                std::cerr << "Failed to open output file \"" << m_output_file << "\"\n";
+                m_error_messages << "Template with variations must specify a filename\n";
                 return false;
             }
 
             return true;
         }
 
-        std::vector<std::unique_ptr<ITemplatingVariation>> m_active_variations;
-        std::unordered_map<std::string, ITemplatingVariation*> m_active_variations_by_name;
+        bool AddVariation(TemplatingVariation variation, const char* directiveName)
+        {
+            const auto existingVariation = m_variations_by_name.find(variation.m_name);
+            if (existingVariation != m_variations_by_name.end())
+            {
+                const auto isValidRedefinition = m_result.m_variations[existingVariation->second].m_type == variation.m_type;
+
+                if (!isValidRedefinition)
+                    m_error_messages << "Redefinition of \"" << variation.m_name << "\" as " << directiveName << " is invalid\n";
+
+                return isValidRedefinition;
+            }
+
+            if (m_current_pass.m_defines_proxy)
+                variation.Apply(m_current_pass.m_defines_proxy.get());
+
+            m_variations_by_name.emplace(variation.m_name, m_result.m_variations.size());
+            m_result.m_variations.emplace_back(std::move(variation));
+
+            return true;
+        }
+
+        std::istringstream m_source_stream;
         TemplatingPass m_current_pass;
+        TemplatingPassResult m_result;
+        std::unordered_map<std::string, size_t> m_variations_by_name;
 
-        std::istream& m_stream;
         std::string m_filename;
         std::string m_output_file;
-        std::string m_default_output_file;
         const fs::path m_output_directory;
 
-        bool m_first_line;
-        bool m_skip_pass;
         bool m_write_output_to_file;
-        std::ofstream m_output_stream;
-        std::ostringstream m_output_cache;
+        bool m_skip_pass;
+        std::ostringstream m_output;
+        std::ostringstream m_error_messages;
     };
+
+    /**
+     * \brief Creates the variation values of all passes that follow up on the specified pass.
+     * Every variation that was discovered in the pass needs a pass for each of its remaining values
+     * while the variations before it keep the values of the pass and the variations after it have not been discovered yet.
+     */
+    std::vector<std::vector<TemplatingVariation>> GetFollowUpPasses(const TemplatingPassResult& result)
+    {
+        std::vector<std::vector<TemplatingVariation>> followUpPasses;
+
+        for (auto variationIndex = result.m_predefined_variation_count; variationIndex < result.m_variations.size(); variationIndex++)
+        {
+            const auto valueCount = result.m_variations[variationIndex].GetValueCount();
+            for (auto valueIndex = 1u; valueIndex < valueCount; valueIndex++)
+            {
+                std::vector<TemplatingVariation> variations(result.m_variations.begin(),
+                                                            result.m_variations.begin() + static_cast<std::ptrdiff_t>(variationIndex) + 1);
+                variations.back().m_value_index = valueIndex;
+                followUpPasses.emplace_back(std::move(variations));
+            }
+        }
+
+        return followUpPasses;
+    }
+
+    /**
+     * \brief Orders passes the same way enumerating the variations one after another would.
+     */
+    bool ComparePassOrder(const TemplatingPassResult& a, const TemplatingPassResult& b)
+    {
+        return std::ranges::lexicographical_compare(a.m_variations,
+                                                    b.m_variations,
+                                                    [](const TemplatingVariation& v0, const TemplatingVariation& v1)
+                                                    {
+                                                        return v0.m_value_index < v1.m_value_index;
+                                                    });
+    }
+
+    bool WriteOutputFile(const TemplatingPassResult& result)
+    {
+        const auto parentDir = fs::path(result.m_output_file).parent_path();
+        if (!parentDir.empty())
+            create_directories(parentDir);
+
+        std::ofstream outputStream(result.m_output_file, std::ios::out | std::ios::binary);
+        if (!outputStream.is_open())
+        {
+            std::cerr << "Failed to open output file \"" << result.m_output_file << "\"\n";
+            return false;
+        }
+
+        outputStream << result.m_output;
+
+        return true;
+    }
 } // namespace templating
 
 Templater::Templater(std::istream& stream, std::string fileName)
     : m_stream(stream),
       m_build_log(nullptr),
-      m_file_name(std::move(fileName))
+      m_file_name(std::move(fileName)),
+      m_job_count(1u)
 {
 }
 
@@ -392,29 +344,91 @@ void Templater::SetBuildLogFile(std::ostream* buildLogFile)
     m_build_log = buildLogFile;
 }
 
+void Templater::SetJobCount(const unsigned jobCount)
+{
+    m_job_count = jobCount;
+}
+
 bool Templater::TemplateToDirectory(const std::string& outputDirectory) const
 {
-    TemplaterControlImpl control(m_stream, m_file_name, outputDirectory);
+    const std::string source{std::istreambuf_iterator<char>(m_stream), std::istreambuf_iterator<char>()};
 
-    try
+    const auto runPass = [&source, &outputDirectory, this](std::vector<TemplatingVariation> variations)
     {
-        if (!control.RunNextPass(m_build_log))
-            return false;
+        TemplaterControlImpl control(m_file_name, outputDirectory, std::move(variations));
+        return control.RunPass(source);
+    };
 
-        control.AdvanceActiveVariations();
-        while (control.HasActiveVariations())
+    // Which variations exist can depend on the values of previous variations,
+    // so the follow up passes of a pass are only known once it finished.
+    // All passes before the first failing one are always run, so the output is the same as when stopping at the first failure.
+    std::vector<TemplatingPassResult> results;
+    if (m_job_count == 1u)
+    {
+        std::deque<std::vector<TemplatingVariation>> pendingPasses;
+        pendingPasses.emplace_back();
+
+        while (!pendingPasses.empty())
         {
-            if (!control.RunNextPass(m_build_log))
-                return false;
+            auto& result = results.emplace_back(runPass(std::move(pendingPasses.front())));
+            pendingPasses.pop_front();
 
-            control.AdvanceActiveVariations();
+            if (!result.m_success)
+                continue;
+
+            for (auto& followUpPass : GetFollowUpPasses(result))
+                pendingPasses.emplace_back(std::move(followUpPass));
         }
     }
-    catch (ParsingException& e)
+    else
     {
-        std::cerr << "Error: " << e.FullMessage() << "\n";
+        ThreadPool threadPool(m_job_count);
+        std::deque<std::future<TemplatingPassResult>> pendingPasses;
+        pendingPasses.emplace_back(threadPool.Submit(
+            [&runPass]
+            {
+                return runPass(std::vector<TemplatingVariation>());
+            }));
+
+        while (!pendingPasses.empty())
+        {
+            auto& result = results.emplace_back(pendingPasses.front().get());
+            pendingPasses.pop_front();
+
+            if (!result.m_success)
+                continue;
+
+            for (auto& followUpPass : GetFollowUpPasses(result))
+            {
+                pendingPasses.emplace_back(threadPool.Submit(
+                    [&runPass, variations = std::move(followUpPass)]() mutable
+                    {
+                        return runPass(std::move(variations));
+                    }));
+            }
+        }
+    }
+
+    std::ranges::stable_sort(results, ComparePassOrder);
+
+    for (const auto& result : results)
+    {
+        if (!result.m_error_messages.empty())
+            std::cerr << result.m_error_messages;
+
+        if (!result.m_success)
+            return false;
+
+        if (result.m_skipped)
+            continue;
+
+        if (!WriteOutputFile(result))
+            return false;
+
+        std::cout << "Templated file \"" << result.m_output_file << "\"\n";
 
-        return false;
+        if (m_build_log)
+            *m_build_log << "Templated file \"" << result.m_output_file << "\"\n";
     }
 
     return true;
@@ -12,11 +12,17 @@ namespace templating
         Templater(std::istream& stream, std::string fileName);
 
         void SetBuildLogFile(std::ostream* buildLogFile);
+
+        /**
+         * \brief Sets the amount of variation passes to run concurrently. When \c 0 the amount of hardware threads is used.
+         */
+        void SetJobCount(unsigned jobCount);
         _NODISCARD bool TemplateToDirectory(const std::string& outputDirectory) const;
 
     private:
         std::istream& m_stream;
         std::ostream* m_build_log;
         std::string m_file_name;
+        unsigned m_job_count;
     };
 } // namespace templating
@@ -58,6 +58,12 @@ private:
         return m_args.m_task != UnlinkerArgs::ProcessingTask::LIST && !m_args.m_skip_obj;
     }
 
+    _NODISCARD ZoneLoadingMode GetZoneLoadingMode() const
+    {
+        // Listing only requires the names of assets so marking and custom loading actions can be skipped
+        return m_args.m_task == UnlinkerArgs::ProcessingTask::LIST ? ZoneLoadingMode::HEADER_SCAN : ZoneLoadingMode::FULL;
+    }
+
     bool WriteZoneDefinitionFile(const Zone& zone, const fs::path& zoneDefinitionFileFolder) const
     {
         auto zoneDefinitionFilePath(zoneDefinitionFileFolder);
@@ -288,7 +294,7 @@ private:
             auto searchPathsForZone = paths.GetSearchPathsForZone(absoluteZoneDirectory);
 
             std::string zoneName;
-            auto zone = ZoneLoading::LoadZone(zonePath);
+            auto zone = ZoneLoading::LoadZone(zonePath, GetZoneLoadingMode());
             if (zone == nullptr)
             {
                 std::cerr << std::format("Failed to load zone \"{}\".\n", zonePath);
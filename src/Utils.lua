@@ -10,6 +10,10 @@ end
 
 function Utils:link(links)
 	links:add(self:name())
+
+	if os.host() == "linux" then
+		links:add("pthread")
+	end
 end
 
 function Utils:use()
@@ -0,0 +1,22 @@
+#include "JobCountOption.h"
+
+#include <charconv>
+#include <format>
+#include <iostream>
+
+bool ReadJobCountOption(const ArgumentParser& argumentParser, const CommandLineOption* jobCountOption, unsigned& jobCount)
+{
+    if (!argumentParser.IsOptionSpecified(jobCountOption))
+        return true;
+
+    const auto specifiedValue = argumentParser.GetValueForOption(jobCountOption);
+    const auto* end = specifiedValue.data() + specifiedValue.size();
+    const auto [ptr, ec] = std::from_chars(specifiedValue.data(), end, jobCount);
+    if (ec != std::errc() || ptr != end)
+    {
+        std::cerr << std::format("Illegal value: \"{}\" is not a valid job count.\n", specifiedValue);
+        return false;
+    }
+
+    return true;
+}
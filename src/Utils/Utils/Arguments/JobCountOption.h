@@ -0,0 +1,12 @@
+#pragma once
+#include "ArgumentParser.h"
+#include "CommandLineOption.h"
+
+/**
+ * \brief Reads the value of a job count option like \c -j; \c --jobs.
+ * \param argumentParser The parser that parsed the command line.
+ * \param jobCountOption The option that specifies the job count.
+ * \param jobCount Is set to the specified job count if the option was specified. \c 0 means to use all hardware threads.
+ * \return \c true if the option was not specified or its value is a valid job count.
+ */
+bool ReadJobCountOption(const ArgumentParser& argumentParser, const CommandLineOption* jobCountOption, unsigned& jobCount);
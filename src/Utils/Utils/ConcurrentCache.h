@@ -0,0 +1,64 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+/**
+ * \brief A cache that can be used from multiple threads at once.
+ * The cache is only locked for looking up and inserting entries. Values are created while only their own entry is locked,
+ * so values for different keys are created concurrently while threads requesting the same key wait for it to be created once.
+ */
+template<typename TKey, typename TValue> class ConcurrentCache
+{
+    class Entry
+    {
+    public:
+        std::mutex m_mutex;
+        bool m_created = false;
+        std::unique_ptr<TValue> m_value;
+    };
+
+public:
+    /**
+     * \param cacheFailures Whether a value that failed to be created is remembered as \c nullptr instead of being created again on the next request.
+     */
+    explicit ConcurrentCache(const bool cacheFailures)
+        : m_cache_failures(cacheFailures)
+    {
+    }
+
+    /**
+     * \brief Returns the value for a key, creating it if it is not cached yet.
+     * \param key The key of the value.
+     * \param create A function returning a \c std::unique_ptr to the created value or \c nullptr if it could not be created.
+     * \return The cached value or \c nullptr if it could not be created.
+     */
+    template<typename TCreate> const TValue* GetOrCreate(TKey key, TCreate&& create)
+    {
+        Entry* entry;
+        {
+            std::lock_guard lock(m_mutex);
+            auto& existingEntry = m_entries[std::move(key)];
+            if (!existingEntry)
+                existingEntry = std::make_unique<Entry>();
+
+            entry = existingEntry.get();
+        }
+
+        std::lock_guard entryLock(entry->m_mutex);
+        if (!entry->m_value && !(entry->m_created && m_cache_failures))
+        {
+            entry->m_value = create();
+            entry->m_created = true;
+        }
+
+        return entry->m_value.get();
+    }
+
+private:
+    bool m_cache_failures;
+    std::mutex m_mutex;
+    std::map<TKey, std::unique_ptr<Entry>> m_entries;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cctype>
+#include <cstdint>
+#include <string_view>
+
+namespace utils
+{
+    static constexpr uint64_t FNV1A_64_OFFSET_BASIS = 14695981039346656037ull;
+    static constexpr uint64_t FNV1A_64_PRIME = 1099511628211ull;
+
+    /**
+     * \brief Hashes a string with 64 bit FNV-1a.
+     * \param basis The value to start hashing with, which can be changed from the offset basis to seed the hash.
+     */
+    constexpr uint64_t Fnv1a64(const std::string_view str, uint64_t basis = FNV1A_64_OFFSET_BASIS)
+    {
+        for (const auto c : str)
+        {
+            basis ^= static_cast<unsigned char>(c);
+            basis *= FNV1A_64_PRIME;
+        }
+
+        return basis;
+    }
+
+    /**
+     * \brief Hashes a string with 64 bit FNV-1a without regarding its case.
+     */
+    inline uint64_t Fnv1a64IgnoreCase(const std::string_view str, uint64_t basis = FNV1A_64_OFFSET_BASIS)
+    {
+        for (const auto c : str)
+        {
+            basis ^= static_cast<uint64_t>(tolower(static_cast<unsigned char>(c)));
+            basis *= FNV1A_64_PRIME;
+        }
+
+        return basis;
+    }
+} // namespace utils
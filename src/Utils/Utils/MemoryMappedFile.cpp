@@ -0,0 +1,152 @@
+#include "MemoryMappedFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MemoryMappedFile::MemoryMappedFile()
+    : m_data(nullptr),
+      m_size(0u)
+#ifdef _WIN32
+      ,
+      m_file_handle(nullptr),
+      m_mapping_handle(nullptr)
+#endif
+{
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    Close();
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)),
+      m_size(std::exchange(other.m_size, 0u))
+#ifdef _WIN32
+      ,
+      m_file_handle(std::exchange(other.m_file_handle, nullptr)),
+      m_mapping_handle(std::exchange(other.m_mapping_handle, nullptr))
+#endif
+{
+}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0u);
+#ifdef _WIN32
+        m_file_handle = std::exchange(other.m_file_handle, nullptr);
+        m_mapping_handle = std::exchange(other.m_mapping_handle, nullptr);
+#endif
+    }
+
+    return *this;
+}
+
+bool MemoryMappedFile::Open(const std::filesystem::path& filePath)
+{
+    Close();
+
+#ifdef _WIN32
+    const auto fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    const auto mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mappingHandle)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    const auto* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    m_file_handle = fileHandle;
+    m_mapping_handle = mappingHandle;
+#else
+    const auto fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat fileStat{};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    const auto fileSize = static_cast<size_t>(fileStat.st_size);
+    auto* data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping stays valid after closing the file descriptor
+    close(fd);
+
+    if (data == MAP_FAILED)
+        return false;
+
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = fileSize;
+#endif
+
+    return true;
+}
+
+void MemoryMappedFile::Close()
+{
+    if (!m_data)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping_handle);
+    CloseHandle(m_file_handle);
+    m_file_handle = nullptr;
+    m_mapping_handle = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0u;
+}
+
+bool MemoryMappedFile::IsOpen() const
+{
+    return m_data != nullptr;
+}
+
+const uint8_t* MemoryMappedFile::GetData() const
+{
+    return m_data;
+}
+
+size_t MemoryMappedFile::GetSize() const
+{
+    return m_size;
+}
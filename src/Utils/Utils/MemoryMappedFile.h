@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+/**
+ * \brief A read only view of a file that is mapped into memory.
+ * Pages are loaded by the os on first access and can be dropped again under memory pressure since they are backed by the file.
+ */
+class MemoryMappedFile
+{
+public:
+    MemoryMappedFile();
+    ~MemoryMappedFile();
+    MemoryMappedFile(const MemoryMappedFile& other) = delete;
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+    MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+    bool Open(const std::filesystem::path& filePath);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const;
+    [[nodiscard]] const uint8_t* GetData() const;
+    [[nodiscard]] size_t GetSize() const;
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+#ifdef _WIN32
+    void* m_file_handle;
+    void* m_mapping_handle;
+#endif
+};
@@ -0,0 +1,62 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned threadCount)
+    : m_stopping(false)
+{
+    if (threadCount == 0u)
+        threadCount = GetHardwareThreadCount();
+
+    m_threads.reserve(threadCount);
+    for (auto i = 0u; i < threadCount; i++)
+        m_threads.emplace_back(&ThreadPool::Work, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+
+    for (auto& thread : m_threads)
+        thread.join();
+}
+
+unsigned ThreadPool::GetThreadCount() const
+{
+    return static_cast<unsigned>(m_threads.size());
+}
+
+unsigned ThreadPool::GetHardwareThreadCount()
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void ThreadPool::Work()
+{
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock,
+                             [this]
+                             {
+                                 return m_stopping || !m_tasks.empty();
+                             });
+
+            // Remaining tasks are still executed when stopping so no future is left without a result
+            if (m_tasks.empty())
+                return;
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+
+        task();
+    }
+}
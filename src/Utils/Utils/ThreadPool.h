@@ -0,0 +1,56 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class ThreadPool
+{
+public:
+    /**
+     * \brief Creates a new thread pool.
+     * \param threadCount The amount of worker threads. When \c 0 the amount of hardware threads is used.
+     */
+    explicit ThreadPool(unsigned threadCount = 0u);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) noexcept = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) noexcept = delete;
+
+    [[nodiscard]] unsigned GetThreadCount() const;
+    [[nodiscard]] static unsigned GetHardwareThreadCount();
+
+    template<typename Func> std::future<std::invoke_result_t<Func>> Submit(Func&& func)
+    {
+        auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Func>()>>(std::forward<Func>(func));
+        auto future = task->get_future();
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks.emplace(
+                [task]
+                {
+                    (*task)();
+                });
+        }
+        m_condition.notify_one();
+
+        return future;
+    }
+
+private:
+    void Work();
+
+    std::vector<std::thread> m_threads;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stopping;
+};
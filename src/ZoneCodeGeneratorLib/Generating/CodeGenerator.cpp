@@ -5,16 +5,63 @@
 #include "Templates/ZoneLoadTemplate.h"
 #include "Templates/ZoneMarkTemplate.h"
 #include "Templates/ZoneWriteTemplate.h"
+#include "Utils/ThreadPool.h"
 
+#include <chrono>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 
 namespace fs = std::filesystem;
 
+namespace
+{
+    class PendingRender
+    {
+    public:
+        PendingRender(StructureInformation* asset, std::string templateName, std::future<std::vector<RenderedCodeFile>> renderedFiles)
+            : m_asset(asset),
+              m_template_name(std::move(templateName)),
+              m_rendered_files(std::move(renderedFiles))
+        {
+        }
+
+        StructureInformation* m_asset;
+        std::string m_template_name;
+        std::future<std::vector<RenderedCodeFile>> m_rendered_files;
+    };
+
+    bool IsFileContentEqual(const fs::path& filePath, const std::string& content)
+    {
+        std::error_code ec;
+        const auto existingFileSize = fs::file_size(filePath, ec);
+        if (ec || existingFileSize != content.size())
+            return false;
+
+        std::ifstream stream(filePath, std::fstream::in | std::fstream::binary);
+        if (!stream.is_open())
+            return false;
+
+        const std::string existingContent((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+        return existingContent == content;
+    }
+} // namespace
+
+RenderedCodeFile::RenderedCodeFile(std::filesystem::path filePath, std::string content)
+    : m_file_path(std::move(filePath)),
+      m_content(std::move(content))
+{
+}
+
 CodeGenerator::CodeGenerator(const ZoneCodeGeneratorArguments* args)
-    : m_args(args)
+    : m_args(args),
+      m_written_file_count(0u),
+      m_unchanged_file_count(0u)
 {
     SetupTemplates();
 }
@@ -27,28 +74,51 @@ void CodeGenerator::SetupTemplates()
     m_template_mapping["assetstructtests"] = std::make_unique<AssetStructTestsTemplate>();
 }
 
-bool CodeGenerator::GenerateCodeForTemplate(const RenderingContext& context, ICodeTemplate* codeTemplate) const
+std::vector<RenderedCodeFile> CodeGenerator::RenderTemplate(const RenderingContext& context, ICodeTemplate* codeTemplate) const
 {
+    std::vector<RenderedCodeFile> renderedFiles;
+
     for (const auto& codeFile : codeTemplate->GetFilesToRender(context))
     {
         fs::path p(m_args->m_output_directory);
         p.append(codeFile.m_file_name);
 
-        auto parentFolder(p);
+        std::ostringstream stream;
+        codeTemplate->RenderFile(stream, codeFile.m_tag, context);
+
+        renderedFiles.emplace_back(std::move(p), std::move(stream).str());
+    }
+
+    return renderedFiles;
+}
+
+bool CodeGenerator::WriteRenderedFiles(const std::vector<RenderedCodeFile>& renderedFiles)
+{
+    for (const auto& renderedFile : renderedFiles)
+    {
+        // Leave files with unchanged content untouched to not trigger recompiling them
+        if (IsFileContentEqual(renderedFile.m_file_path, renderedFile.m_content))
+        {
+            m_unchanged_file_count++;
+            continue;
+        }
+
+        auto parentFolder(renderedFile.m_file_path);
         parentFolder.remove_filename();
         create_directories(parentFolder);
 
-        std::ofstream stream(p, std::fstream::out | std::fstream::binary);
+        std::ofstream stream(renderedFile.m_file_path, std::fstream::out | std::fstream::binary);
 
         if (!stream.is_open())
         {
-            std::cerr << std::format("Failed to open file '{}'\n", p.string());
+            std::cerr << std::format("Failed to open file '{}'\n", renderedFile.m_file_path.string());
             return false;
         }
 
-        codeTemplate->RenderFile(stream, codeFile.m_tag, context);
-
+        stream.write(renderedFile.m_content.data(), static_cast<std::streamsize>(renderedFile.m_content.size()));
         stream.close();
+
+        m_written_file_count++;
     }
 
     return true;
@@ -92,6 +162,25 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
     }
 
     const auto start = std::chrono::steady_clock::now();
+    m_written_file_count = 0u;
+    m_unchanged_file_count = 0u;
+
+    // Templates are rendered concurrently into memory while the results are written in order on this thread
+    ThreadPool threadPool;
+    std::vector<PendingRender> pendingRenders;
+
+    const auto submitRender = [&](StructureInformation* asset, ICodeTemplate* codeTemplate, const std::string& templateName)
+    {
+        pendingRenders.emplace_back(asset,
+                                    templateName,
+                                    threadPool.Submit(
+                                        [this, repository, asset, codeTemplate]
+                                        {
+                                            const auto context = RenderingContext::BuildContext(repository, asset);
+                                            return RenderTemplate(*context, codeTemplate);
+                                        }));
+    };
+
     for (const auto& generationTask : m_args->m_generation_tasks)
     {
         auto templateName = generationTask.m_template_name;
@@ -108,18 +197,7 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
         if (generationTask.m_all_assets)
         {
             for (auto* asset : assets)
-            {
-                auto context = RenderingContext::BuildContext(repository, asset);
-                if (!GenerateCodeForTemplate(*context, foundTemplate->second.get()))
-                {
-                    std::cerr << std::format(
-                        "Failed to generate code for asset '{}' with preset '{}'\n", asset->m_definition->GetFullName(), foundTemplate->first);
-                    return false;
-                }
-
-                std::cout << std::format(
-                    "Successfully generated code for asset '{}' with preset '{}'\n", asset->m_definition->GetFullName(), foundTemplate->first);
-            }
+                submitRender(asset, foundTemplate->second.get(), foundTemplate->first);
         }
         else
         {
@@ -127,14 +205,29 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
             if (!GetAssetWithName(repository, generationTask.m_asset_name, asset))
                 return false;
 
-            auto context = RenderingContext::BuildContext(repository, asset);
-            if (!GenerateCodeForTemplate(*context, foundTemplate->second.get()))
-                return false;
+            submitRender(asset, foundTemplate->second.get(), foundTemplate->first);
+        }
+    }
+
+    for (auto& pendingRender : pendingRenders)
+    {
+        if (!WriteRenderedFiles(pendingRender.m_rendered_files.get()))
+        {
+            std::cerr << std::format(
+                "Failed to generate code for asset '{}' with preset '{}'\n", pendingRender.m_asset->m_definition->GetFullName(), pendingRender.m_template_name);
+            return false;
         }
+
+        std::cout << std::format(
+            "Successfully generated code for asset '{}' with preset '{}'\n", pendingRender.m_asset->m_definition->GetFullName(), pendingRender.m_template_name);
     }
+
     const auto end = std::chrono::steady_clock::now();
     if (m_args->m_verbose)
+    {
         std::cout << std::format("Generating code took {}ms\n", std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+        std::cout << std::format("Wrote {} files, {} files were unchanged\n", m_written_file_count, m_unchanged_file_count);
+    }
 
     return true;
 }
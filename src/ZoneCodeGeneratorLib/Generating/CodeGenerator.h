@@ -3,9 +3,20 @@
 #include "ICodeTemplate.h"
 #include "ZoneCodeGeneratorArguments.h"
 
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+class RenderedCodeFile
+{
+public:
+    RenderedCodeFile(std::filesystem::path filePath, std::string content);
+
+    std::filesystem::path m_file_path;
+    std::string m_content;
+};
 
 class CodeGenerator
 {
@@ -17,9 +28,13 @@ public:
 private:
     void SetupTemplates();
 
-    bool GenerateCodeForTemplate(const RenderingContext& context, ICodeTemplate* codeTemplate) const;
+    std::vector<RenderedCodeFile> RenderTemplate(const RenderingContext& context, ICodeTemplate* codeTemplate) const;
+    bool WriteRenderedFiles(const std::vector<RenderedCodeFile>& renderedFiles);
     static bool GetAssetWithName(IDataRepository* repository, const std::string& name, StructureInformation*& asset);
 
     const ZoneCodeGeneratorArguments* m_args;
     std::unordered_map<std::string, std::unique_ptr<ICodeTemplate>> m_template_mapping;
+
+    size_t m_written_file_count;
+    size_t m_unchanged_file_count;
 };
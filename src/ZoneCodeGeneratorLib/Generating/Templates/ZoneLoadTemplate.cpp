@@ -5,6 +5,7 @@
 #include "Internal/BaseTemplate.h"
 #include "Utils/StringUtils.h"
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 
@@ -37,6 +38,7 @@ namespace
                 LINEF("#include \"Game/{0}/XAssets/{1}/{1}_actions.h\"", m_env.m_game, Lower(m_env.m_asset->m_definition->m_name))
             }
             LINE("#include \"Loading/AssetLoader.h\"")
+            LINEF("#include \"{0}_mark_db.h\"", Lower(m_env.m_asset->m_definition->m_name))
             LINE("")
             LINE("#include <string>")
             LINE("")
@@ -90,6 +92,7 @@ namespace
             {
                 LINEF("Actions_{0} m_actions;", m_env.m_asset->m_definition->m_name)
             }
+            LINEF("{0} m_marker;", MarkerClassName(m_env.m_asset))
             LINE(VariableDecl(m_env.m_asset->m_definition))
             LINE(PointerVariableDecl(m_env.m_asset->m_definition))
             LINE("")
@@ -125,8 +128,6 @@ namespace
             LINE("// ====================================================================")
             LINE("")
             LINEF("#include \"{0}_load_db.h\"", Lower(m_env.m_asset->m_definition->m_name))
-            LINE("")
-            LINEF("#include \"{0}_mark_db.h\"", Lower(m_env.m_asset->m_definition->m_name))
 
             if (!m_env.m_referenced_assets.empty())
             {
@@ -212,6 +213,15 @@ namespace
             return std::format("{0}** var{1}Ptr;", def->GetFullName(), MakeSafeTypeName(def));
         }
 
+        void PrintCustomActionCall(const CustomAction* action)
+        {
+            // Custom actions only move data out of temp blocks or reset runtime fields, which is irrelevant when only scanning asset names
+            LINE("if (m_mode == ZoneLoadingMode::FULL)")
+            m_intendation++;
+            LINE(MakeCustomActionCall(action))
+            m_intendation--;
+        }
+
         void PrintHeaderPtrArrayLoadMethodDeclaration(const DataDefinition* def) const
         {
             LINEF("void LoadPtrArray_{0}(bool atStreamStart, size_t count);", MakeSafeTypeName(def))
@@ -244,7 +254,7 @@ namespace
 
         void PrintHeaderConstructor() const
         {
-            LINEF("{0}(Zone& zone, ZoneInputStream& stream);", LoaderClassName(m_env.m_asset))
+            LINEF("{0}(Zone& zone, ZoneInputStream& stream, ZoneLoadingMode mode);", LoaderClassName(m_env.m_asset))
         }
 
         void PrintVariableInitialization(const DataDefinition* def) const
@@ -259,14 +269,15 @@ namespace
 
         void PrintConstructorMethod()
         {
-            LINEF("{0}::{0}(Zone& zone, ZoneInputStream& stream)", LoaderClassName(m_env.m_asset))
+            LINEF("{0}::{0}(Zone& zone, ZoneInputStream& stream, const ZoneLoadingMode mode)", LoaderClassName(m_env.m_asset))
 
             m_intendation++;
-            LINE_STARTF(": AssetLoader({0}::EnumEntry, zone, stream)", m_env.m_asset->m_asset_name)
+            LINE_STARTF(": AssetLoader({0}::EnumEntry, zone, stream, mode)", m_env.m_asset->m_asset_name)
             if (m_env.m_has_actions)
             {
                 LINE_MIDDLE(", m_actions(zone)")
             }
+            LINE_MIDDLE(", m_marker(zone)")
             LINE_END("")
             m_intendation--;
 
@@ -320,8 +331,8 @@ namespace
 
             if (info && StructureComputations(info).IsAsset())
             {
-                LINEF("{0} loader(m_zone, *m_stream);", LoaderClassName(info))
-                LINEF("loader.Load({0});", MakeTypePtrVarName(def))
+                LINEF("{0} loader(m_zone, *m_stream, m_mode);", LoaderClassName(info))
+                LINEF("m_marker.AddDependency(loader.Load({0}));", MakeTypePtrVarName(def))
             }
             else
             {
@@ -341,6 +352,12 @@ namespace
 
                     LINEF("*{0} = m_stream->ConvertOffsetToPointer(*{0});", MakeTypePtrVarName(def))
 
+                    if (info && !info->m_is_leaf && info->m_requires_marking)
+                    {
+                        LINEF("m_marker.{0} = *{1};", MakeTypeVarName(info->m_definition), MakeTypePtrVarName(def))
+                        LINEF("m_marker.Mark_{0}();", MakeSafeTypeName(def))
+                    }
+
                     m_intendation--;
                     LINE("}")
                 }
@@ -385,6 +402,14 @@ namespace
             LINE("}")
         }
 
+        static bool CanInlineArrayElement(const StructureInformation* info)
+        {
+            const StructureComputations computations(info);
+
+            // Types with a dynamic member are loaded partially and must keep using their own load method
+            return !computations.IsAsset() && computations.GetDynamicMember() == nullptr;
+        }
+
         void PrintLoadArrayMethod(const DataDefinition* def, const StructureInformation* info)
         {
             LINEF("void {0}::LoadArray_{1}(const bool atStreamStart, const size_t count)", LoaderClassName(m_env.m_asset), MakeSafeTypeName(def))
@@ -398,6 +423,14 @@ namespace
             LINEF("m_stream->Load<{0}>({1}, count);", def->GetFullName(), MakeTypeVarName(def))
             m_intendation--;
 
+            // When no member needs any treatment the elements are completely loaded by the bulk load above
+            if (!LoadMembers_NeedTreatment(info))
+            {
+                m_intendation--;
+                LINE("}")
+                return;
+            }
+
             LINE("")
             LINEF("{0}* var = {1};", def->GetFullName(), MakeTypeVarName(def))
             LINE("for (size_t index = 0; index < count; index++)")
@@ -405,7 +438,16 @@ namespace
             m_intendation++;
 
             LINEF("{0} = var;", MakeTypeVarName(info->m_definition))
-            LINEF("Load_{0}(false);", info->m_definition->m_name)
+            if (CanInlineArrayElement(info))
+            {
+                // Only treat the members that need it inline instead of calling the load method of the element for every element
+                PrintLoadMembers(info);
+                LINE("")
+            }
+            else
+            {
+                LINEF("Load_{0}(false);", info->m_definition->m_name)
+            }
             LINE("var++;")
 
             m_intendation--;
@@ -422,8 +464,8 @@ namespace
         {
             if (loadType == MemberLoadType::SINGLE_POINTER)
             {
-                LINEF("{0} loader(m_zone, *m_stream);", LoaderClassName(member->m_type))
-                LINEF("loader.Load(&{0});", MakeMemberAccess(info, member, modifier))
+                LINEF("{0} loader(m_zone, *m_stream, m_mode);", LoaderClassName(member->m_type))
+                LINEF("m_marker.AddDependency(loader.Load(&{0}));", MakeMemberAccess(info, member, modifier))
             }
             else if (loadType == MemberLoadType::POINTER_ARRAY)
             {
@@ -472,7 +514,7 @@ namespace
             }
         }
 
-        void LoadMember_ArrayPointer(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        void LoadMember_ArrayPointer(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier)
         {
             const MemberComputations computations(member);
             if (member->m_type && !member->m_type->m_is_leaf && !computations.IsInRuntimeBlock())
@@ -485,13 +527,13 @@ namespace
                 if (member->m_type->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_type->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_type->m_post_load_action.get());
                 }
 
                 if (member->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_post_load_action.get());
                 }
             }
             else
@@ -519,7 +561,7 @@ namespace
             }
         }
 
-        void LoadMember_EmbeddedArray(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        void LoadMember_EmbeddedArray(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier)
         {
             const MemberComputations computations(member);
             std::string arraySizeStr;
@@ -529,7 +571,7 @@ namespace
             else
                 arraySizeStr = std::to_string(modifier.GetArraySize());
 
-            if (!member->m_is_leaf)
+            if (member->m_type && !member->m_is_leaf)
             {
                 LINEF("{0} = {1};", MakeTypeVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
 
@@ -545,13 +587,13 @@ namespace
                 if (member->m_type->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_type->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_type->m_post_load_action.get());
                 }
 
                 if (member->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_post_load_action.get());
                 }
             }
             else if (computations.IsAfterPartialLoad())
@@ -583,10 +625,10 @@ namespace
             }
         }
 
-        void LoadMember_Embedded(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        void LoadMember_Embedded(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier)
         {
             const MemberComputations computations(member);
-            if (!member->m_is_leaf)
+            if (member->m_type && !member->m_is_leaf)
             {
                 LINEF("{0} = &{1};", MakeTypeVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
 
@@ -602,13 +644,13 @@ namespace
                 if (member->m_type->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_type->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_type->m_post_load_action.get());
                 }
 
                 if (member->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_post_load_action.get());
                 }
             }
             else if (computations.IsAfterPartialLoad())
@@ -620,7 +662,7 @@ namespace
             }
         }
 
-        void LoadMember_SinglePointer(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier) const
+        void LoadMember_SinglePointer(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier)
         {
             const MemberComputations computations(member);
             if (member->m_type && !member->m_type->m_is_leaf && !computations.IsInRuntimeBlock())
@@ -631,13 +673,13 @@ namespace
                 if (member->m_type->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_type->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_type->m_post_load_action.get());
                 }
 
                 if (member->m_post_load_action)
                 {
                     LINE("")
-                    LINE(MakeCustomActionCall(member->m_post_load_action.get()))
+                    PrintCustomActionCall(member->m_post_load_action.get());
                 }
             }
             else
@@ -652,7 +694,7 @@ namespace
         void LoadMember_TypeCheck(const StructureInformation* info,
                                   const MemberInformation* member,
                                   const DeclarationModifierComputations& modifier,
-                                  const MemberLoadType loadType) const
+                                  const MemberLoadType loadType)
         {
             if (member->m_is_string)
             {
@@ -782,6 +824,117 @@ namespace
             }
         }
 
+        void LoadMember_MarkReferences(const StructureInformation* info,
+                                       const MemberInformation* member,
+                                       const DeclarationModifierComputations& modifier,
+                                       const MemberLoadType loadType)
+        {
+            const MemberComputations computations(member);
+            if (computations.IsInRuntimeBlock() || !member->m_is_script_string && !member->m_asset_ref)
+                return;
+
+            // References are not recorded when only scanning asset names
+            if (LoadMember_ShouldMakePointerCheck(member, modifier, loadType))
+            {
+                LINEF("if (m_mode == ZoneLoadingMode::FULL && {0})", MakeMemberAccess(info, member, modifier))
+            }
+            else
+            {
+                LINE("if (m_mode == ZoneLoadingMode::FULL)")
+            }
+            m_intendation++;
+
+            if (member->m_is_script_string)
+            {
+                if (loadType == MemberLoadType::ARRAY_POINTER)
+                {
+                    LINEF("m_marker.MarkArray_ScriptString({0}, {1});",
+                          MakeMemberAccess(info, member, modifier),
+                          MakeEvaluation(modifier.GetArrayPointerCountEvaluation()))
+                }
+                else if (loadType == MemberLoadType::EMBEDDED_ARRAY)
+                {
+                    LINEF("m_marker.MarkArray_ScriptString({0}, {1});",
+                          MakeMemberAccess(info, member, modifier),
+                          MakeArrayCount(dynamic_cast<ArrayDeclarationModifier*>(modifier.GetDeclarationModifier())))
+                }
+                else if (loadType == MemberLoadType::EMBEDDED)
+                {
+                    LINEF("m_marker.Mark_ScriptString({0});", MakeMemberAccess(info, member, modifier))
+                }
+                else
+                {
+                    assert(false);
+                    LINEF("#error unsupported loadType {0} for script string", static_cast<int>(loadType))
+                }
+            }
+            else
+            {
+                if (loadType == MemberLoadType::POINTER_ARRAY)
+                {
+                    LINEF("m_marker.MarkArray_IndirectAssetRef({0}, {1}, {2});",
+                          member->m_asset_ref->m_name,
+                          MakeMemberAccess(info, member, modifier),
+                          modifier.IsArray() ? std::to_string(modifier.GetArraySize()) : MakeEvaluation(modifier.GetPointerArrayCountEvaluation()))
+                }
+                else if (loadType == MemberLoadType::SINGLE_POINTER)
+                {
+                    LINEF("m_marker.Mark_IndirectAssetRef({0}, {1});", member->m_asset_ref->m_name, MakeMemberAccess(info, member, modifier))
+                }
+                else
+                {
+                    assert(false);
+                    LINEF("#error unsupported loadType {0} for asset ref", static_cast<int>(loadType))
+                }
+            }
+
+            m_intendation--;
+        }
+
+        void LoadMember_MarkReused(const StructureInformation* info,
+                                   const MemberInformation* member,
+                                   const DeclarationModifierComputations& modifier,
+                                   const MemberLoadType loadType)
+        {
+            // Reused data has been loaded before, possibly for a different asset, so it is the only data that still needs to be walked by the marker.
+            // Script strings and asset refs are already marked after the member has been loaded regardless of whether it was reused.
+            const MemberComputations computations(member);
+            if (member->m_is_script_string || member->m_asset_ref || !member->m_type || !member->m_type->m_requires_marking
+                || computations.IsInRuntimeBlock())
+                return;
+
+            LINE("if (m_mode == ZoneLoadingMode::FULL)")
+            LINE("{")
+            m_intendation++;
+
+            if (loadType == MemberLoadType::SINGLE_POINTER && StructureComputations(member->m_type).IsAsset())
+            {
+                LINEF("m_marker.AddDependency({0}(m_zone).GetAssetInfo({1}));", MarkerClassName(member->m_type), MakeMemberAccess(info, member, modifier))
+            }
+            else if (loadType == MemberLoadType::SINGLE_POINTER)
+            {
+                LINEF("m_marker.{0} = {1};", MakeTypeVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
+                LINEF("m_marker.Mark_{0}();", MakeSafeTypeName(member->m_type->m_definition))
+            }
+            else if (loadType == MemberLoadType::ARRAY_POINTER)
+            {
+                LINEF("m_marker.{0} = {1};", MakeTypeVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
+                LINEF("m_marker.MarkArray_{0}({1});",
+                      MakeSafeTypeName(member->m_member->m_type_declaration->m_type),
+                      MakeEvaluation(modifier.GetArrayPointerCountEvaluation()))
+            }
+            else if (loadType == MemberLoadType::POINTER_ARRAY)
+            {
+                LINEF("m_marker.{0} = {1};", MakeTypePtrVarName(member->m_member->m_type_declaration->m_type), MakeMemberAccess(info, member, modifier))
+                LINEF("m_marker.MarkPtrArray_{0}({1});",
+                      MakeSafeTypeName(member->m_member->m_type_declaration->m_type),
+                      MakeEvaluation(modifier.GetPointerArrayCountEvaluation()))
+            }
+
+            m_intendation--;
+            LINE("}")
+        }
+
         static bool LoadMember_ShouldMakeReuse(const DeclarationModifierComputations& modifier, const MemberLoadType loadType)
         {
             if (loadType != MemberLoadType::ARRAY_POINTER && loadType != MemberLoadType::SINGLE_POINTER && loadType != MemberLoadType::POINTER_ARRAY)
@@ -824,6 +977,7 @@ namespace
                 m_intendation++;
 
                 LINEF("{0} = m_stream->ConvertOffsetToAlias({0});", MakeMemberAccess(info, member, modifier))
+                LoadMember_MarkReused(info, member, modifier, loadType);
 
                 m_intendation--;
                 LINE("}")
@@ -843,6 +997,7 @@ namespace
                 m_intendation++;
 
                 LINEF("{0} = m_stream->ConvertOffsetToPointer({0});", MakeMemberAccess(info, member, modifier))
+                LoadMember_MarkReused(info, member, modifier, loadType);
 
                 m_intendation--;
                 LINE("}")
@@ -905,6 +1060,8 @@ namespace
             {
                 LINE("m_stream->PopBlock();")
             }
+
+            LoadMember_MarkReferences(info, member, modifier, loadType);
         }
 
         void LoadMember_ReferenceArray(const StructureInformation* info, const MemberInformation* member, const DeclarationModifierComputations& modifier)
@@ -1050,19 +1207,59 @@ namespace
             }
         }
 
-        void PrintLoadMemberIfNeedsTreatment(const StructureInformation* info, const MemberInformation* member)
+        static bool LoadMember_NeedsTreatment(const MemberInformation* member)
         {
             const MemberComputations computations(member);
             if (computations.ShouldIgnore())
+                return false;
+
+            return member->m_is_string || member->m_is_script_string && !computations.IsInRuntimeBlock() || computations.ContainsNonEmbeddedReference()
+                   || member->m_type && !member->m_type->m_is_leaf || computations.IsAfterPartialLoad();
+        }
+
+        static bool LoadMembers_NeedTreatment(const StructureInformation* info)
+        {
+            return std::ranges::any_of(info->m_ordered_members,
+                                       [](const std::unique_ptr<MemberInformation>& member)
+                                       {
+                                           return LoadMember_NeedsTreatment(member.get());
+                                       });
+        }
+
+        void PrintLoadMemberIfNeedsTreatment(const StructureInformation* info, const MemberInformation* member)
+        {
+            if (!LoadMember_NeedsTreatment(member))
                 return;
 
-            if (member->m_is_string || computations.ContainsNonEmbeddedReference() || member->m_type && !member->m_type->m_is_leaf
-                || computations.IsAfterPartialLoad())
+            if (info->m_definition->GetType() == DataDefinitionType::UNION)
+                LoadMember_Condition_Union(info, member);
+            else
+                LoadMember_Condition_Struct(info, member);
+        }
+
+        void PrintLoadMembers(const StructureInformation* info)
+        {
+            const StructureComputations computations(info);
+            if (computations.IsAsset())
             {
-                if (info->m_definition->GetType() == DataDefinitionType::UNION)
-                    LoadMember_Condition_Union(info, member);
-                else
-                    LoadMember_Condition_Struct(info, member);
+                LINE("")
+                LINEF("m_stream->PushBlock({0});", m_env.m_default_normal_block->m_name)
+            }
+            else if (info->m_block)
+            {
+                LINE("")
+                LINEF("m_stream->PushBlock({0});", info->m_block->m_name)
+            }
+
+            for (const auto& member : info->m_ordered_members)
+            {
+                PrintLoadMemberIfNeedsTreatment(info, member.get());
+            }
+
+            if (info->m_block || computations.IsAsset())
+            {
+                LINE("")
+                LINE("m_stream->PopBlock();")
             }
         }
 
@@ -1104,27 +1301,7 @@ namespace
                 LINE("assert(atStreamStart);")
             }
 
-            if (computations.IsAsset())
-            {
-                LINE("")
-                LINEF("m_stream->PushBlock({0});", m_env.m_default_normal_block->m_name)
-            }
-            else if (info->m_block)
-            {
-                LINE("")
-                LINEF("m_stream->PushBlock({0});", info->m_block->m_name)
-            }
-
-            for (const auto& member : info->m_ordered_members)
-            {
-                PrintLoadMemberIfNeedsTreatment(info, member.get());
-            }
-
-            if (info->m_block || computations.IsAsset())
-            {
-                LINE("")
-                LINE("m_stream->PopBlock();")
-            }
+            PrintLoadMembers(info);
 
             m_intendation--;
             LINE("}")
@@ -1206,7 +1383,7 @@ namespace
             if (info->m_post_load_action)
             {
                 LINE("")
-                LINE(MakeCustomActionCall(info->m_post_load_action.get()))
+                PrintCustomActionCall(info->m_post_load_action.get());
             }
 
             if (StructureComputations(info).IsAsset())
@@ -1270,16 +1447,27 @@ namespace
 
             LINE("assert(pAsset != nullptr);")
             LINE("")
-            LINEF("{0} marker(m_zone);", MarkerClassName(m_env.m_asset))
-            LINE("marker.Mark(*pAsset);")
-            LINE("")
             LINEF("auto* reallocatedAsset = m_zone.Memory().Alloc<{0}>();", info->m_definition->GetFullName())
             LINEF("std::memcpy(reallocatedAsset, *pAsset, sizeof({0}));", info->m_definition->GetFullName())
             LINE("")
-            LINEF("m_asset_info = reinterpret_cast<XAssetInfo<{0}>*>(LinkAsset(AssetNameAccessor<{1}>()(**pAsset), reallocatedAsset, marker.GetDependencies(), "
-                  "marker.GetUsedScriptStrings(), marker.GetIndirectAssetReferences()));",
+            LINE("if (m_mode == ZoneLoadingMode::HEADER_SCAN)")
+            LINE("{")
+            m_intendation++;
+            LINEF("m_asset_info = reinterpret_cast<XAssetInfo<{0}>*>(LinkAsset(AssetNameAccessor<{1}>()(**pAsset), reallocatedAsset, {{}}, {{}}, {{}}));",
                   info->m_definition->GetFullName(),
                   info->m_asset_name)
+            m_intendation--;
+            LINE("}")
+            LINE("else")
+            LINE("{")
+            m_intendation++;
+            LINEF("m_asset_info = reinterpret_cast<XAssetInfo<{0}>*>(LinkAsset(AssetNameAccessor<{1}>()(**pAsset), reallocatedAsset, "
+                  "m_marker.GetDependencies(), m_marker.GetUsedScriptStrings(), m_marker.GetIndirectAssetReferences()));",
+                  info->m_definition->GetFullName(),
+                  info->m_asset_name)
+            m_intendation--;
+            LINE("}")
+            LINE("")
             LINE("*pAsset = m_asset_info->Asset();")
 
             m_intendation--;
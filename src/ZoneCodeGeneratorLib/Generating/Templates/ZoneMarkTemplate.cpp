@@ -55,6 +55,10 @@ namespace
             LINE("private:")
             m_intendation++;
 
+            // The loader records references while loading and only falls back to marking for data that is reused
+            LINEF("friend class {0};", LoaderClassName(m_env.m_asset))
+            LINE("")
+
             // Method Declarations
             for (const auto* type : m_env.m_used_types)
             {
@@ -180,6 +184,11 @@ namespace
             SINGLE_POINTER
         };
 
+        static std::string LoaderClassName(const StructureInformation* asset)
+        {
+            return std::format("Loader_{0}", asset->m_definition->m_name);
+        }
+
         static std::string MarkerClassName(const StructureInformation* asset)
         {
             return std::format("Marker_{0}", asset->m_definition->m_name);
@@ -322,6 +331,14 @@ namespace
             LINE("}")
         }
 
+        static bool CanInlineArrayElement(const StructureInformation* info)
+        {
+            const StructureComputations computations(info);
+
+            // Types with a dynamic member are marked partially and must keep using their own mark method
+            return !computations.IsAsset() && computations.GetDynamicMember() == nullptr;
+        }
+
         void PrintMarkArrayMethod(const DataDefinition* def, const StructureInformation* info)
         {
             LINEF("void {0}::MarkArray_{1}(const size_t count)", MarkerClassName(m_env.m_asset), MakeSafeTypeName(def))
@@ -337,7 +354,16 @@ namespace
             m_intendation++;
 
             LINEF("{0} = var;", MakeTypeVarName(info->m_definition))
-            LINEF("Mark_{0}();", info->m_definition->m_name)
+            if (CanInlineArrayElement(info))
+            {
+                // Treat the members of each element inline instead of calling the mark method of the element for every element
+                PrintMarkMembers(info);
+                LINE("")
+            }
+            else
+            {
+                LINEF("Mark_{0}();", info->m_definition->m_name)
+            }
             LINE("var++;")
 
             m_intendation--;
@@ -735,6 +761,14 @@ namespace
             }
         }
 
+        void PrintMarkMembers(const StructureInformation* info)
+        {
+            for (const auto& member : info->m_ordered_members)
+            {
+                PrintMarkMemberIfNeedsTreatment(info, member.get());
+            }
+        }
+
         void PrintMarkMethod(const StructureInformation* info)
         {
             LINEF("void {0}::Mark_{1}()", MarkerClassName(m_env.m_asset), info->m_definition->m_name)
@@ -743,10 +777,7 @@ namespace
 
             LINEF("assert({0} != nullptr);", MakeTypeVarName(info->m_definition))
 
-            for (const auto& member : info->m_ordered_members)
-            {
-                PrintMarkMemberIfNeedsTreatment(info, member.get());
-            }
+            PrintMarkMembers(info);
 
             m_intendation--;
             LINE("}")
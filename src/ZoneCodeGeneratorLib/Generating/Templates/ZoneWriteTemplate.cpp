@@ -3,6 +3,7 @@
 #include "Domain/Computations/StructureComputations.h"
 #include "Internal/BaseTemplate.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <sstream>
@@ -938,19 +939,59 @@ namespace
             }
         }
 
-        void PrintWriteMemberIfNeedsTreatment(const StructureInformation* info, const MemberInformation* member)
+        static bool WriteMember_NeedsTreatment(const MemberInformation* member)
         {
             const MemberComputations computations(member);
             if (computations.ShouldIgnore())
+                return false;
+
+            return member->m_is_string || member->m_is_script_string || computations.ContainsNonEmbeddedReference()
+                   || member->m_type && !member->m_type->m_is_leaf || computations.IsAfterPartialLoad();
+        }
+
+        static bool WriteMembers_NeedTreatment(const StructureInformation* info)
+        {
+            return std::ranges::any_of(info->m_ordered_members,
+                                       [](const std::unique_ptr<MemberInformation>& member)
+                                       {
+                                           return WriteMember_NeedsTreatment(member.get());
+                                       });
+        }
+
+        void PrintWriteMemberIfNeedsTreatment(const StructureInformation* info, const MemberInformation* member)
+        {
+            if (!WriteMember_NeedsTreatment(member))
                 return;
 
-            if (member->m_is_string || member->m_is_script_string || computations.ContainsNonEmbeddedReference() || member->m_type && !member->m_type->m_is_leaf
-                || computations.IsAfterPartialLoad())
+            if (info->m_definition->GetType() == DataDefinitionType::UNION)
+                WriteMember_Condition_Union(info, member);
+            else
+                WriteMember_Condition_Struct(info, member);
+        }
+
+        void PrintWriteMembers(const StructureInformation* info)
+        {
+            const StructureComputations computations(info);
+            if (computations.IsAsset())
             {
-                if (info->m_definition->GetType() == DataDefinitionType::UNION)
-                    WriteMember_Condition_Union(info, member);
-                else
-                    WriteMember_Condition_Struct(info, member);
+                LINE("")
+                LINEF("m_stream->PushBlock({0});", m_env.m_default_normal_block->m_name)
+            }
+            else if (info->m_block)
+            {
+                LINE("")
+                LINEF("m_stream->PushBlock({0});", info->m_block->m_name)
+            }
+
+            for (const auto& member : info->m_ordered_members)
+            {
+                PrintWriteMemberIfNeedsTreatment(info, member.get());
+            }
+
+            if (info->m_block || computations.IsAsset())
+            {
+                LINE("")
+                LINE("m_stream->PopBlock();")
             }
         }
 
@@ -997,27 +1038,7 @@ namespace
                 LINE("assert(atStreamStart);")
             }
 
-            if (computations.IsAsset())
-            {
-                LINE("")
-                LINEF("m_stream->PushBlock({0});", m_env.m_default_normal_block->m_name)
-            }
-            else if (info->m_block)
-            {
-                LINE("")
-                LINEF("m_stream->PushBlock({0});", info->m_block->m_name)
-            }
-
-            for (const auto& member : info->m_ordered_members)
-            {
-                PrintWriteMemberIfNeedsTreatment(info, member.get());
-            }
-
-            if (info->m_block || computations.IsAsset())
-            {
-                LINE("")
-                LINE("m_stream->PopBlock();")
-            }
+            PrintWriteMembers(info);
 
             m_intendation--;
             LINE("}")
@@ -1195,6 +1216,14 @@ namespace
             LINE("}")
         }
 
+        static bool CanInlineArrayElement(const StructureInformation* info)
+        {
+            const StructureComputations computations(info);
+
+            // Types with a dynamic member are written partially and must keep using their own write method
+            return !computations.IsAsset() && computations.GetDynamicMember() == nullptr;
+        }
+
         void PrintWriteArrayMethod(const DataDefinition* def, const StructureInformation* info)
         {
             LINEF("void {0}::WriteArray_{1}(const bool atStreamStart, const size_t count)", WriterClassName(m_env.m_asset), MakeSafeTypeName(def))
@@ -1211,6 +1240,14 @@ namespace
             LINE("")
             LINEF("assert({0} != nullptr);", MakeTypeWrittenVarName(def))
 
+            // When no member needs any treatment the elements are completely written by the bulk write above
+            if (!WriteMembers_NeedTreatment(info))
+            {
+                m_intendation--;
+                LINE("}")
+                return;
+            }
+
             LINE("")
             LINEF("{0}* var = {1};", def->GetFullName(), MakeTypeVarName(def))
             LINEF("{0}* varWritten = {1};", def->GetFullName(), MakeTypeWrittenVarName(def))
@@ -1220,7 +1257,16 @@ namespace
 
             LINEF("{0} = var;", MakeTypeVarName(info->m_definition))
             LINEF("{0} = varWritten;", MakeTypeWrittenVarName(info->m_definition))
-            LINEF("Write_{0}(false);", info->m_definition->m_name)
+            if (CanInlineArrayElement(info))
+            {
+                // Only treat the members that need it inline instead of calling the write method of the element for every element
+                PrintWriteMembers(info);
+                LINE("")
+            }
+            else
+            {
+                LINEF("Write_{0}(false);", info->m_definition->m_name)
+            }
             LINE("var++;")
             LINE("varWritten++;")
 
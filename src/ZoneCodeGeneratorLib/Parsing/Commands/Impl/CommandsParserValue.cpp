@@ -214,3 +214,19 @@ const OperationType* CommandsParserValue::OpTypeValue() const
     assert(m_type == CommandsParserValueType::OPERATION_TYPE);
     return m_value.op_type_value;
 }
+
+int CommandsParserValue::FirstSetTokenType() const
+{
+    return static_cast<int>(m_type);
+}
+
+size_t CommandsParserValue::FirstSetValueHash() const
+{
+    if (m_type == CommandsParserValueType::CHARACTER)
+        return static_cast<unsigned char>(m_value.char_value);
+
+    if (m_type == CommandsParserValueType::IDENTIFIER)
+        return m_hash;
+
+    return 0u;
+}
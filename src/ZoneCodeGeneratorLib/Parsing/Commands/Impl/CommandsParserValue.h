@@ -97,6 +97,9 @@ public:
     [[nodiscard]] std::string& TypeNameValue() const;
     [[nodiscard]] const OperationType* OpTypeValue() const;
 
+    [[nodiscard]] int FirstSetTokenType() const;
+    [[nodiscard]] size_t FirstSetValueHash() const;
+
     TokenPos m_pos;
     CommandsParserValueType m_type;
     size_t m_hash;
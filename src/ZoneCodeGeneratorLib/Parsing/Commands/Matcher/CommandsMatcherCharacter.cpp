@@ -11,3 +11,9 @@ MatcherResult<CommandsParserValue> CommandsMatcherCharacter::CanMatch(ILexer<Com
     return token.m_type == CommandsParserValueType::CHARACTER && token.CharacterValue() == m_char ? MatcherResult<CommandsParserValue>::Match(1)
                                                                                                   : MatcherResult<CommandsParserValue>::NoMatch();
 }
+
+bool CommandsMatcherCharacter::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenValue(static_cast<int>(CommandsParserValueType::CHARACTER), static_cast<unsigned char>(m_char));
+    return false;
+}
@@ -14,3 +14,9 @@ MatcherResult<CommandsParserValue> CommandsMatcherKeyword::CanMatch(ILexer<Comma
                ? MatcherResult<CommandsParserValue>::Match(1)
                : MatcherResult<CommandsParserValue>::NoMatch();
 }
+
+bool CommandsMatcherKeyword::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenValue(static_cast<int>(CommandsParserValueType::IDENTIFIER), m_hash);
+    return false;
+}
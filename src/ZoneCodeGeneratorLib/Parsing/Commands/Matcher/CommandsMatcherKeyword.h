@@ -12,6 +12,7 @@ public:
 
 protected:
     MatcherResult<CommandsParserValue> CanMatch(ILexer<CommandsParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 private:
     size_t m_hash;
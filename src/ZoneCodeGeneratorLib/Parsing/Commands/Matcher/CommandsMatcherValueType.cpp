@@ -9,3 +9,9 @@ MatcherResult<CommandsParserValue> CommandsMatcherValueType::CanMatch(ILexer<Com
 {
     return lexer->GetToken(tokenOffset).m_type == m_type ? MatcherResult<CommandsParserValue>::Match(1) : MatcherResult<CommandsParserValue>::NoMatch();
 }
+
+bool CommandsMatcherValueType::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenType(static_cast<int>(m_type));
+    return false;
+}
@@ -10,6 +10,7 @@ public:
 
 protected:
     MatcherResult<CommandsParserValue> CanMatch(ILexer<CommandsParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 private:
     CommandsParserValueType m_type;
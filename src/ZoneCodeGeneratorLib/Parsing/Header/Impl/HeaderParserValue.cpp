@@ -196,3 +196,16 @@ std::string& HeaderParserValue::TypeNameValue() const
     assert(m_type == HeaderParserValueType::TYPE_NAME);
     return *m_value.string_value;
 }
+
+int HeaderParserValue::FirstSetTokenType() const
+{
+    return static_cast<int>(m_type);
+}
+
+size_t HeaderParserValue::FirstSetValueHash() const
+{
+    if (m_type == HeaderParserValueType::CHARACTER)
+        return static_cast<unsigned char>(m_value.char_value);
+
+    return 0u;
+}
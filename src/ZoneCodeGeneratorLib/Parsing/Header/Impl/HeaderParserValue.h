@@ -103,6 +103,9 @@ public:
     [[nodiscard]] std::string& IdentifierValue() const;
     [[nodiscard]] std::string& TypeNameValue() const;
 
+    [[nodiscard]] int FirstSetTokenType() const;
+    [[nodiscard]] size_t FirstSetValueHash() const;
+
     TokenPos m_pos;
     HeaderParserValueType m_type;
 
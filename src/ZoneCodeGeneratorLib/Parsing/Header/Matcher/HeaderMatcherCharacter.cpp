@@ -11,3 +11,9 @@ MatcherResult<HeaderParserValue> HeaderMatcherCharacter::CanMatch(ILexer<HeaderP
     return token.m_type == HeaderParserValueType::CHARACTER && token.CharacterValue() == m_char ? MatcherResult<HeaderParserValue>::Match(1)
                                                                                                 : MatcherResult<HeaderParserValue>::NoMatch();
 }
+
+bool HeaderMatcherCharacter::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenValue(static_cast<int>(HeaderParserValueType::CHARACTER), static_cast<unsigned char>(m_char));
+    return false;
+}
@@ -9,3 +9,9 @@ MatcherResult<HeaderParserValue> HeaderMatcherValueType::CanMatch(ILexer<HeaderP
 {
     return lexer->GetToken(tokenOffset).m_type == m_type ? MatcherResult<HeaderParserValue>::Match(1) : MatcherResult<HeaderParserValue>::NoMatch();
 }
+
+bool HeaderMatcherValueType::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenType(static_cast<int>(m_type));
+    return false;
+}
@@ -10,6 +10,7 @@ public:
 
 protected:
     MatcherResult<HeaderParserValue> CanMatch(ILexer<HeaderParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 private:
     HeaderParserValueType m_type;
@@ -10,6 +10,40 @@
 #include <unordered_map>
 #include <vector>
 
+/**
+ * \brief While an instance exists, asset pools that are linked on the current thread are only visible to the current thread.
+ * This allows building multiple zones concurrently without them seeing each other's assets.
+ * Asset pools that were linked outside of an isolation scope stay visible to all threads
+ * and must not be linked or unlinked while isolated threads are running.
+ */
+class GlobalAssetPoolThreadIsolation
+{
+public:
+    GlobalAssetPoolThreadIsolation()
+    {
+        assert(!m_is_isolated);
+        m_is_isolated = true;
+    }
+
+    ~GlobalAssetPoolThreadIsolation()
+    {
+        m_is_isolated = false;
+    }
+
+    GlobalAssetPoolThreadIsolation(const GlobalAssetPoolThreadIsolation& other) = delete;
+    GlobalAssetPoolThreadIsolation(GlobalAssetPoolThreadIsolation&& other) noexcept = delete;
+    GlobalAssetPoolThreadIsolation& operator=(const GlobalAssetPoolThreadIsolation& other) = delete;
+    GlobalAssetPoolThreadIsolation& operator=(GlobalAssetPoolThreadIsolation&& other) noexcept = delete;
+
+    static bool IsThreadIsolated()
+    {
+        return m_is_isolated;
+    }
+
+private:
+    static inline thread_local bool m_is_isolated = false;
+};
+
 template<typename T> class GlobalAssetPool
 {
     struct LinkedAssetPool
@@ -25,24 +59,35 @@ template<typename T> class GlobalAssetPool
         LinkedAssetPool* m_asset_pool;
     };
 
-    static std::vector<std::unique_ptr<LinkedAssetPool>> m_linked_asset_pools;
-    static std::unordered_map<std::string, GameAssetPoolEntry> m_assets;
+    struct Links
+    {
+        std::vector<std::unique_ptr<LinkedAssetPool>> m_linked_asset_pools;
+        std::unordered_map<std::string, GameAssetPoolEntry> m_assets;
+    };
+
+    static Links m_shared_links;
+    static thread_local Links m_isolated_links;
+
+    static Links& GetLinksOfThread()
+    {
+        return GlobalAssetPoolThreadIsolation::IsThreadIsolated() ? m_isolated_links : m_shared_links;
+    }
 
-    static void SortLinkedAssetPools()
+    static void SortLinkedAssetPools(Links& links)
     {
-        std::sort(m_linked_asset_pools.begin(),
-                  m_linked_asset_pools.end(),
+        std::sort(links.m_linked_asset_pools.begin(),
+                  links.m_linked_asset_pools.end(),
                   [](const std::unique_ptr<LinkedAssetPool>& a, const std::unique_ptr<LinkedAssetPool>& b) -> bool
                   {
                       return a->m_priority < b->m_priority;
                   });
     }
 
-    static bool ReplaceAssetPoolEntry(GameAssetPoolEntry& assetEntry)
+    static bool ReplaceAssetPoolEntry(const Links& links, GameAssetPoolEntry& assetEntry)
     {
         int occurrences = 0;
 
-        for (const auto& linkedAssetPool : m_linked_asset_pools)
+        for (const auto& linkedAssetPool : links.m_linked_asset_pools)
         {
             XAssetInfo<T>* foundAsset = linkedAssetPool->m_asset_pool->GetAsset(assetEntry.m_asset->m_name);
 
@@ -65,18 +110,18 @@ template<typename T> class GlobalAssetPool
         return occurrences > 0;
     }
 
-    static void LinkAsset(LinkedAssetPool* link, const std::string& normalizedAssetName, XAssetInfo<T>* asset)
+    static void LinkAsset(Links& links, LinkedAssetPool* link, const std::string& normalizedAssetName, XAssetInfo<T>* asset)
     {
-        auto existingAsset = m_assets.find(normalizedAssetName);
+        auto existingAsset = links.m_assets.find(normalizedAssetName);
 
-        if (existingAsset == m_assets.end())
+        if (existingAsset == links.m_assets.end())
         {
             GameAssetPoolEntry entry{};
             entry.m_asset = asset;
             entry.m_asset_pool = link;
             entry.m_duplicate = false;
 
-            m_assets[normalizedAssetName] = entry;
+            links.m_assets[normalizedAssetName] = entry;
         }
         else
         {
@@ -95,26 +140,29 @@ template<typename T> class GlobalAssetPool
 public:
     static void LinkAssetPool(AssetPool<T>* assetPool, const zone_priority_t priority)
     {
+        auto& links = GetLinksOfThread();
+
         auto newLink = std::make_unique<LinkedAssetPool>();
         newLink->m_asset_pool = assetPool;
         newLink->m_priority = priority;
 
         auto* newLinkPtr = newLink.get();
-        m_linked_asset_pools.emplace_back(std::move(newLink));
-        SortLinkedAssetPools();
+        links.m_linked_asset_pools.emplace_back(std::move(newLink));
+        SortLinkedAssetPools(links);
 
         for (auto asset : *assetPool)
         {
             const auto normalizedAssetName = XAssetInfo<T>::NormalizeAssetName(asset->m_name);
-            LinkAsset(newLinkPtr, normalizedAssetName, asset);
+            LinkAsset(links, newLinkPtr, normalizedAssetName, asset);
         }
     }
 
     static void LinkAsset(AssetPool<T>* assetPool, const std::string& normalizedAssetName, XAssetInfo<T>* asset)
     {
+        auto& links = GetLinksOfThread();
         LinkedAssetPool* link = nullptr;
 
-        for (const auto& existingLink : m_linked_asset_pools)
+        for (const auto& existingLink : links.m_linked_asset_pools)
         {
             if (existingLink->m_asset_pool == assetPool)
             {
@@ -127,14 +175,15 @@ public:
         if (link == nullptr)
             return;
 
-        LinkAsset(link, normalizedAssetName, asset);
+        LinkAsset(links, link, normalizedAssetName, asset);
     }
 
     static void UnlinkAssetPool(AssetPool<T>* assetPool)
     {
-        auto iLinkEntry = m_linked_asset_pools.begin();
+        auto& links = GetLinksOfThread();
+        auto iLinkEntry = links.m_linked_asset_pools.begin();
 
-        for (; iLinkEntry != m_linked_asset_pools.end(); ++iLinkEntry)
+        for (; iLinkEntry != links.m_linked_asset_pools.end(); ++iLinkEntry)
         {
             LinkedAssetPool* linkEntry = iLinkEntry->get();
             if (linkEntry->m_asset_pool == assetPool)
@@ -143,14 +192,14 @@ public:
             }
         }
 
-        assert(iLinkEntry != m_linked_asset_pools.end());
-        if (iLinkEntry == m_linked_asset_pools.end())
+        assert(iLinkEntry != links.m_linked_asset_pools.end());
+        if (iLinkEntry == links.m_linked_asset_pools.end())
             return;
 
         auto assetPoolToUnlink = std::move(*iLinkEntry);
-        m_linked_asset_pools.erase(iLinkEntry);
+        links.m_linked_asset_pools.erase(iLinkEntry);
 
-        for (auto iAssetEntry = m_assets.begin(); iAssetEntry != m_assets.end();)
+        for (auto iAssetEntry = links.m_assets.begin(); iAssetEntry != links.m_assets.end();)
         {
             auto& assetEntry = *iAssetEntry;
 
@@ -160,31 +209,38 @@ public:
                 continue;
             }
 
-            if (assetEntry.second.m_duplicate && ReplaceAssetPoolEntry(assetEntry.second))
+            if (assetEntry.second.m_duplicate && ReplaceAssetPoolEntry(links, assetEntry.second))
             {
                 ++iAssetEntry;
                 continue;
             }
 
-            iAssetEntry = m_assets.erase(iAssetEntry);
+            iAssetEntry = links.m_assets.erase(iAssetEntry);
         }
     }
 
     static XAssetInfo<T>* GetAssetByName(const std::string& name)
     {
         const auto normalizedName = XAssetInfo<T>::NormalizeAssetName(name);
-        const auto foundEntry = m_assets.find(normalizedName);
-        if (foundEntry == m_assets.end())
+        const auto foundEntry = m_shared_links.m_assets.find(normalizedName);
+        const auto* sharedEntry = foundEntry != m_shared_links.m_assets.end() ? &foundEntry->second : nullptr;
+
+        if (GlobalAssetPoolThreadIsolation::IsThreadIsolated())
+        {
+            // Isolated pools are always linked after the shared ones, so they only take precedence with a higher priority
+            const auto foundIsolatedEntry = m_isolated_links.m_assets.find(normalizedName);
+            if (foundIsolatedEntry != m_isolated_links.m_assets.end()
+                && (!sharedEntry || sharedEntry->m_asset_pool->m_priority < foundIsolatedEntry->second.m_asset_pool->m_priority))
+                return foundIsolatedEntry->second.m_asset;
+        }
+
+        if (!sharedEntry)
             return nullptr;
 
-        return foundEntry->second.m_asset;
+        return sharedEntry->m_asset;
     }
 };
 
-template<typename T>
-std::vector<std::unique_ptr<typename GlobalAssetPool<T>::LinkedAssetPool>> GlobalAssetPool<T>::m_linked_asset_pools =
-    std::vector<std::unique_ptr<LinkedAssetPool>>();
+template<typename T> typename GlobalAssetPool<T>::Links GlobalAssetPool<T>::m_shared_links = typename GlobalAssetPool<T>::Links();
 
-template<typename T>
-std::unordered_map<std::string, typename GlobalAssetPool<T>::GameAssetPoolEntry> GlobalAssetPool<T>::m_assets =
-    std::unordered_map<std::string, GameAssetPoolEntry>();
+template<typename T> thread_local typename GlobalAssetPool<T>::Links GlobalAssetPool<T>::m_isolated_links = typename GlobalAssetPool<T>::Links();
@@ -11,3 +11,9 @@ MatcherResult<ZoneDefinitionParserValue> ZoneDefinitionMatcherCharacter::CanMatc
     return token.m_type == ZoneDefinitionParserValueType::CHARACTER && token.CharacterValue() == m_char ? MatcherResult<ZoneDefinitionParserValue>::Match(1)
                                                                                                         : MatcherResult<ZoneDefinitionParserValue>::NoMatch();
 }
+
+bool ZoneDefinitionMatcherCharacter::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenValue(static_cast<int>(ZoneDefinitionParserValueType::CHARACTER), static_cast<unsigned char>(m_char));
+    return false;
+}
@@ -9,6 +9,7 @@ class ZoneDefinitionMatcherCharacter final : public AbstractMatcher<ZoneDefiniti
 
 protected:
     MatcherResult<ZoneDefinitionParserValue> CanMatch(ILexer<ZoneDefinitionParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit ZoneDefinitionMatcherCharacter(char c);
@@ -14,3 +14,9 @@ MatcherResult<ZoneDefinitionParserValue> ZoneDefinitionMatcherKeyword::CanMatch(
                ? MatcherResult<ZoneDefinitionParserValue>::Match(1)
                : MatcherResult<ZoneDefinitionParserValue>::NoMatch();
 }
+
+bool ZoneDefinitionMatcherKeyword::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenValue(static_cast<int>(ZoneDefinitionParserValueType::FIELD), m_hash);
+    return false;
+}
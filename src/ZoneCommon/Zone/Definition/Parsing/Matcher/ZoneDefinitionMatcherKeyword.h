@@ -12,6 +12,7 @@ class ZoneDefinitionMatcherKeyword final : public AbstractMatcher<ZoneDefinition
 
 protected:
     MatcherResult<ZoneDefinitionParserValue> CanMatch(ILexer<ZoneDefinitionParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit ZoneDefinitionMatcherKeyword(std::string value);
@@ -10,3 +10,9 @@ MatcherResult<ZoneDefinitionParserValue> ZoneDefinitionMatcherValueType::CanMatc
     return lexer->GetToken(tokenOffset).m_type == m_type ? MatcherResult<ZoneDefinitionParserValue>::Match(1)
                                                          : MatcherResult<ZoneDefinitionParserValue>::NoMatch();
 }
+
+bool ZoneDefinitionMatcherValueType::AddFirstTokens(MatcherFirstSet& firstSet) const
+{
+    firstSet.AddTokenType(static_cast<int>(m_type));
+    return false;
+}
@@ -9,6 +9,7 @@ class ZoneDefinitionMatcherValueType final : public AbstractMatcher<ZoneDefiniti
 
 protected:
     MatcherResult<ZoneDefinitionParserValue> CanMatch(ILexer<ZoneDefinitionParserValue>* lexer, unsigned tokenOffset) override;
+    bool AddFirstTokens(MatcherFirstSet& firstSet) const override;
 
 public:
     explicit ZoneDefinitionMatcherValueType(ZoneDefinitionParserValueType type);
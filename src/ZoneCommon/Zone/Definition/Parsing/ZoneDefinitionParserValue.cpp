@@ -113,3 +113,19 @@ size_t ZoneDefinitionParserValue::FieldHash() const
     assert(m_type == ZoneDefinitionParserValueType::FIELD);
     return m_hash;
 }
+
+int ZoneDefinitionParserValue::FirstSetTokenType() const
+{
+    return static_cast<int>(m_type);
+}
+
+size_t ZoneDefinitionParserValue::FirstSetValueHash() const
+{
+    if (m_type == ZoneDefinitionParserValueType::CHARACTER)
+        return static_cast<unsigned char>(m_value.char_value);
+
+    if (m_type == ZoneDefinitionParserValueType::FIELD)
+        return m_hash;
+
+    return 0u;
+}
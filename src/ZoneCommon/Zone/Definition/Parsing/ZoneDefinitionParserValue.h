@@ -56,4 +56,7 @@ public:
     _NODISCARD std::string& StringValue() const;
     _NODISCARD std::string& FieldValue() const;
     _NODISCARD size_t FieldHash() const;
+
+    _NODISCARD int FirstSetTokenType() const;
+    _NODISCARD size_t FirstSetValueHash() const;
 };
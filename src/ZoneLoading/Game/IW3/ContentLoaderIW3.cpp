@@ -32,10 +32,11 @@
 
 using namespace IW3;
 
-ContentLoader::ContentLoader(Zone& zone)
+ContentLoader::ContentLoader(Zone& zone, const ZoneLoadingMode mode)
     : ContentLoaderBase(zone),
       varXAsset(nullptr),
-      varScriptStringList(nullptr)
+      varScriptStringList(nullptr),
+      m_mode(mode)
 {
 }
 
@@ -68,7 +69,7 @@ void ContentLoader::LoadXAsset(const bool atStreamStart) const
 #define LOAD_ASSET(type_index, typeName, headerEntry)                                                                                                          \
     case type_index:                                                                                                                                           \
     {                                                                                                                                                          \
-        Loader_##typeName loader(m_zone, *m_stream);                                                                                                           \
+        Loader_##typeName loader(m_zone, *m_stream, m_mode);                                                                                                   \
         loader.Load(&varXAsset->header.headerEntry);                                                                                                           \
         break;                                                                                                                                                 \
     }
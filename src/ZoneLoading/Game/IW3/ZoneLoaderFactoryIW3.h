@@ -9,6 +9,6 @@ namespace IW3
     class ZoneLoaderFactory final : public IZoneLoaderFactory
     {
     public:
-        std::unique_ptr<ZoneLoader> CreateLoaderForHeader(ZoneHeader& header, std::string& fileName) const override;
+        std::unique_ptr<ZoneLoader> CreateLoaderForHeader(ZoneHeader& header, std::string& fileName, ZoneLoadingMode mode) const override;
     };
 } // namespace IW3
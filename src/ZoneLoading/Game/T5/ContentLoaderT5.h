@@ -3,13 +3,14 @@
 #include "Game/T5/T5.h"
 #include "Loading/ContentLoaderBase.h"
 #include "Loading/IContentLoadingEntryPoint.h"
+#include "Loading/ZoneLoadingMode.h"
 
 namespace T5
 {
     class ContentLoader final : public ContentLoaderBase, public IContentLoadingEntryPoint
     {
     public:
-        explicit ContentLoader(Zone& zone);
+        ContentLoader(Zone& zone, ZoneLoadingMode mode);
 
         void Load(ZoneInputStream& stream) override;
 
@@ -21,5 +22,7 @@ namespace T5
 
         XAsset* varXAsset;
         ScriptStringList* varScriptStringList;
+
+        ZoneLoadingMode m_mode;
     };
 } // namespace T5
@@ -3,9 +3,10 @@
 #include <algorithm>
 #include <cassert>
 
-AssetLoader::AssetLoader(const asset_type_t assetType, Zone& zone, ZoneInputStream& stream)
+AssetLoader::AssetLoader(const asset_type_t assetType, Zone& zone, ZoneInputStream& stream, const ZoneLoadingMode mode)
     : ContentLoaderBase(zone, stream),
       varScriptString(nullptr),
+      m_mode(mode),
       m_asset_type(assetType)
 {
 }
@@ -3,13 +3,14 @@
 #include "ContentLoaderBase.h"
 #include "Pool/XAssetInfo.h"
 #include "Zone/ZoneTypes.h"
+#include "ZoneLoadingMode.h"
 
 #include <vector>
 
 class AssetLoader : public ContentLoaderBase
 {
 protected:
-    AssetLoader(asset_type_t assetType, Zone& zone, ZoneInputStream& stream);
+    AssetLoader(asset_type_t assetType, Zone& zone, ZoneInputStream& stream, ZoneLoadingMode mode);
 
     XAssetInfoGeneric* LinkAsset(std::string name,
                                  void* asset,
@@ -20,6 +21,7 @@ protected:
     [[nodiscard]] XAssetInfoGeneric* GetAssetInfo(const std::string& name) const;
 
     scr_string_t* varScriptString;
+    ZoneLoadingMode m_mode;
 
 private:
     asset_type_t m_asset_type;
@@ -2,6 +2,7 @@
 
 #include "Zone/ZoneTypes.h"
 #include "ZoneLoader.h"
+#include "ZoneLoadingMode.h"
 
 #include <memory>
 
@@ -15,7 +16,7 @@ public:
     IZoneLoaderFactory& operator=(const IZoneLoaderFactory& other) = default;
     IZoneLoaderFactory& operator=(IZoneLoaderFactory&& other) noexcept = default;
 
-    virtual std::unique_ptr<ZoneLoader> CreateLoaderForHeader(ZoneHeader& header, std::string& fileName) const = 0;
+    virtual std::unique_ptr<ZoneLoader> CreateLoaderForHeader(ZoneHeader& header, std::string& fileName, ZoneLoadingMode mode) const = 0;
 
     static const IZoneLoaderFactory* GetZoneLoaderFactoryForGame(GameId game);
 };
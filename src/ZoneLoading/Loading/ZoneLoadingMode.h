@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+enum class ZoneLoadingMode : std::uint8_t
+{
+    // Loads every asset completely including its dependencies, used script strings and all data moved out of temp blocks.
+    FULL,
+
+    // Only registers the name and type of each asset.
+    // This does not avoid loading the assets: The fastfile format does not record asset sizes and asset names are stored inside of the asset data,
+    // so every asset is still decompressed, allocated and copied into its blocks.
+    // Only marking dependencies and script strings and custom loading actions are skipped, so the gain is limited to the time these take.
+    // The resulting asset data must not be used for anything other than listing.
+    HEADER_SCAN
+};
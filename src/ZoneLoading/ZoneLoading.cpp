@@ -11,7 +11,7 @@
 
 namespace fs = std::filesystem;
 
-std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path)
+std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path, const ZoneLoadingMode mode)
 {
     auto zoneName = fs::path(path).filename().replace_extension().string();
     std::ifstream file(path, std::fstream::in | std::fstream::binary);
@@ -34,7 +34,7 @@ std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path)
     for (auto game = 0u; game < static_cast<unsigned>(GameId::COUNT); game++)
     {
         const auto* factory = IZoneLoaderFactory::GetZoneLoaderFactoryForGame(static_cast<GameId>(game));
-        zoneLoader = factory->CreateLoaderForHeader(header, zoneName);
+        zoneLoader = factory->CreateLoaderForHeader(header, zoneName, mode);
 
         if (zoneLoader)
             break;
@@ -1,4 +1,5 @@
 #pragma once
+#include "Loading/ZoneLoadingMode.h"
 #include "Zone/Zone.h"
 
 #include <string>
@@ -6,5 +7,5 @@
 class ZoneLoading
 {
 public:
-    static std::unique_ptr<Zone> LoadZone(const std::string& path);
+    static std::unique_ptr<Zone> LoadZone(const std::string& path, ZoneLoadingMode mode = ZoneLoadingMode::FULL);
 };
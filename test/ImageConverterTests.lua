@@ -0,0 +1,67 @@
+ImageConverterTests = {}
+
+function ImageConverterTests:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "ImageConverterTests")
+		}
+	end
+end
+
+function ImageConverterTests:link(links)
+	
+end
+
+function ImageConverterTests:use()
+	
+end
+
+function ImageConverterTests:name()
+    return "ImageConverterTests"
+end
+
+function ImageConverterTests:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		-- ImageConverter is an executable, so everything but its entry point is compiled into the tests directly
+		files {
+			path.join(folder, "ImageConverterTests/**.h"), 
+			path.join(folder, "ImageConverterTests/**.cpp"),
+			path.join(ProjectFolder(), "ImageConverter/**.h"),
+			path.join(ProjectFolder(), "ImageConverter/**.cpp")
+		}
+		
+		removefiles {
+			path.join(ProjectFolder(), "ImageConverter/main.cpp")
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "ImageConverterTests")
+			},
+			["ImageConverter/*"] = {
+				path.join(ProjectFolder(), "ImageConverter")
+			}
+		}
+		
+		self:include(includes)
+		Catch2Common:include(includes)
+		ImageConverter:include(includes)
+		Utils:include(includes)
+		ObjImage:include(includes)
+		catch2:include(includes)
+
+		links:linkto(Utils)
+		links:linkto(ObjImage)
+		links:linkto(catch2)
+		links:linkto(Catch2Common)
+		links:linkall()
+end
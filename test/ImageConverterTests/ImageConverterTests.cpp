@@ -0,0 +1,152 @@
+#include "ImageConverter.h"
+
+#include "Image/DdsWriter.h"
+#include "Image/Texture.h"
+#include "OatTestPaths.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace test::image_converter
+{
+    class CapturedOutput
+    {
+    public:
+        CapturedOutput()
+            : m_previous_out(std::cout.rdbuf(m_out.rdbuf())),
+              m_previous_errors(std::cerr.rdbuf(m_errors.rdbuf()))
+        {
+        }
+
+        ~CapturedOutput()
+        {
+            std::cout.rdbuf(m_previous_out);
+            std::cerr.rdbuf(m_previous_errors);
+        }
+
+        CapturedOutput(const CapturedOutput& other) = delete;
+        CapturedOutput(CapturedOutput&& other) noexcept = delete;
+        CapturedOutput& operator=(const CapturedOutput& other) = delete;
+        CapturedOutput& operator=(CapturedOutput&& other) noexcept = delete;
+
+        std::ostringstream m_out;
+        std::ostringstream m_errors;
+
+    private:
+        std::streambuf* m_previous_out;
+        std::streambuf* m_previous_errors;
+    };
+
+    class BatchOutput
+    {
+    public:
+        bool m_success = false;
+        std::vector<std::string> m_out_lines;
+        std::string m_errors;
+    };
+
+    void WriteDds(const fs::path& path, const unsigned seed)
+    {
+        Texture2D texture(&ImageFormat::FORMAT_R8_G8_B8_A8, 8u, 8u, false);
+        texture.Allocate();
+
+        auto* buffer = texture.GetBufferForMipLevel(0, 0);
+        for (auto i = 0u; i < texture.GetSizeOfMipLevel(0); i++)
+            buffer[i] = static_cast<uint8_t>(i * 7u + seed);
+
+        std::ofstream file(path, std::ios::out | std::ios::binary);
+        DdsWriter().DumpImage(file, &texture);
+    }
+
+    BatchOutput ConvertBatch(const std::string& jobCount, const std::vector<fs::path>& files)
+    {
+        std::vector<std::string> args{"ImageConverter", "--t6", "--verbose", "--jobs", jobCount};
+        for (const auto& file : files)
+            args.emplace_back(file.string());
+
+        std::vector<const char*> argv;
+        for (const auto& arg : args)
+            argv.emplace_back(arg.c_str());
+
+        BatchOutput output;
+        std::string out;
+        {
+            const CapturedOutput capturedOutput;
+            const auto imageConverter = ImageConverter::Create();
+            output.m_success = imageConverter->Start(static_cast<int>(argv.size()), argv.data());
+
+            out = capturedOutput.m_out.str();
+            output.m_errors = capturedOutput.m_errors.str();
+        }
+
+        // The summary contains the duration of the conversion which differs between runs
+        std::istringstream outLines(out);
+        std::string line;
+        while (std::getline(outLines, line))
+        {
+            if (!line.starts_with("Read "))
+                output.m_out_lines.emplace_back(line);
+        }
+
+        return output;
+    }
+
+    TEST_CASE("ImageConverter: Ensure batch conversion reports images in input order", "[image]")
+    {
+        const auto directory = oat::paths::GetTempDirectory() / "image_converter_batch";
+        fs::remove_all(directory);
+        fs::create_directories(directory);
+
+        std::vector<fs::path> files;
+        for (auto i = 0u; i < 6u; i++)
+        {
+            const auto path = directory / std::format("image{}.dds", i);
+            if (i == 2u)
+            {
+                std::ofstream file(path, std::ios::out | std::ios::binary);
+                file << "not a dds file";
+            }
+            else
+                WriteDds(path, i);
+
+            files.emplace_back(path);
+        }
+
+        const auto serialOutput = ConvertBatch("1", files);
+        REQUIRE(!serialOutput.m_success);
+        REQUIRE(serialOutput.m_errors == "Invalid magic for dds\n");
+
+        std::vector<std::string> expectedOutLines;
+        for (auto i = 0u; i < files.size(); i++)
+        {
+            auto iwiPath = files[i];
+            iwiPath.replace_extension(".iwi");
+
+            if (i == 2u)
+            {
+                REQUIRE(!fs::exists(iwiPath));
+                continue;
+            }
+
+            REQUIRE(fs::exists(iwiPath));
+            expectedOutLines.emplace_back(std::format("Converted {} to {}", files[i].string(), iwiPath.string()));
+        }
+        expectedOutLines.emplace_back("Converted 5 images, skipped 0 up to date images, 1 failed");
+        REQUIRE(serialOutput.m_out_lines == expectedOutLines);
+
+        const auto concurrentOutput = ConvertBatch("4", files);
+        REQUIRE(!concurrentOutput.m_success);
+        REQUIRE(concurrentOutput.m_errors == serialOutput.m_errors);
+        REQUIRE(concurrentOutput.m_out_lines == serialOutput.m_out_lines);
+
+        fs::remove_all(directory);
+    }
+} // namespace test::image_converter
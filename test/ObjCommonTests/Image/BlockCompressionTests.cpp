@@ -0,0 +1,418 @@
+#include "Image/BlockCompression.h"
+#include "Image/TextureConverter.h"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <vector>
+
+using namespace bc;
+
+namespace image::block_compression
+{
+    constexpr std::uint8_t REPRESENTABLE_R = 165;
+    constexpr std::uint8_t REPRESENTABLE_G = 170;
+    constexpr std::uint8_t REPRESENTABLE_B = 82;
+
+    std::vector<std::uint8_t> CreateGradient(const unsigned width, const unsigned height)
+    {
+        std::vector<std::uint8_t> pixels(static_cast<size_t>(width) * height * 4u);
+        for (auto y = 0u; y < height; y++)
+        {
+            for (auto x = 0u; x < width; x++)
+            {
+                auto* pixel = &pixels[(y * width + x) * 4u];
+                pixel[0] = static_cast<std::uint8_t>(x * 255u / (width - 1u));
+                pixel[1] = static_cast<std::uint8_t>(y * 255u / (height - 1u));
+                pixel[2] = static_cast<std::uint8_t>(255u - pixel[0] / 2u);
+                pixel[3] = static_cast<std::uint8_t>((x + y) * 255u / (width + height - 2u));
+            }
+        }
+
+        return pixels;
+    }
+
+    double RootMeanSquareError(const std::vector<std::uint8_t>& expected, const std::vector<std::uint8_t>& actual, const unsigned channel)
+    {
+        auto sum = 0.0;
+        const auto pixelCount = expected.size() / 4u;
+        for (auto i = 0u; i < pixelCount; i++)
+        {
+            const auto difference = static_cast<double>(expected[i * 4u + channel]) - static_cast<double>(actual[i * 4u + channel]);
+            sum += difference * difference;
+        }
+
+        return std::sqrt(sum / static_cast<double>(pixelCount));
+    }
+
+    size_t GetBlocksSize(const ImageFormatId formatId, const unsigned width, const unsigned height)
+    {
+        return ImageFormat::ALL_FORMATS[static_cast<unsigned>(formatId)]->GetSizeOfMipLevel(0, width, height, 1);
+    }
+
+    TEST_CASE("BlockCompression: Decodes BC1 reference block in four color mode", "[image][bc]")
+    {
+        constexpr std::uint8_t block[]{0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4};
+        constexpr std::uint8_t expectedPalette[4][4]{
+            {255, 0, 0,   255},
+            {0,   0, 255, 255},
+            {170, 0, 85,  255},
+            {85,  0, 170, 255},
+        };
+
+        std::uint8_t pixels[PIXELS_PER_BLOCK * 4u];
+        DecodeBlockBC1(block, pixels);
+
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            for (auto channel = 0u; channel < 4u; channel++)
+                REQUIRE(pixels[i * 4u + channel] == expectedPalette[i % 4u][channel]);
+        }
+    }
+
+    TEST_CASE("BlockCompression: Decodes BC1 reference block in three color mode", "[image][bc]")
+    {
+        constexpr std::uint8_t block[]{0x1F, 0x00, 0x00, 0xF8, 0xE4, 0xE4, 0xE4, 0xE4};
+        constexpr std::uint8_t expectedPalette[4][4]{
+            {0,   0, 255, 255},
+            {255, 0, 0,   255},
+            {128, 0, 128, 255},
+            {0,   0, 0,   0  },
+        };
+
+        std::uint8_t pixels[PIXELS_PER_BLOCK * 4u];
+        DecodeBlockBC1(block, pixels);
+
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            for (auto channel = 0u; channel < 4u; channel++)
+                REQUIRE(pixels[i * 4u + channel] == expectedPalette[i % 4u][channel]);
+        }
+    }
+
+    TEST_CASE("BlockCompression: Decodes BC2 reference block", "[image][bc]")
+    {
+        constexpr std::uint8_t block[]{0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00};
+
+        std::uint8_t pixels[PIXELS_PER_BLOCK * 4u];
+        DecodeBlockBC2(block, pixels);
+
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            REQUIRE(pixels[i * 4u + 0u] == 255);
+            REQUIRE(pixels[i * 4u + 1u] == 0);
+            REQUIRE(pixels[i * 4u + 2u] == 0);
+            REQUIRE(pixels[i * 4u + 3u] == i * 17u);
+        }
+    }
+
+    TEST_CASE("BlockCompression: Decodes BC4 reference block in eight value mode", "[image][bc]")
+    {
+        constexpr std::uint8_t block[]{0xFF, 0x00, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49};
+
+        std::uint8_t pixels[PIXELS_PER_BLOCK * 4u];
+        DecodeBlockBC4(block, pixels);
+
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            REQUIRE(pixels[i * 4u + 0u] == 219);
+            REQUIRE(pixels[i * 4u + 1u] == 0);
+            REQUIRE(pixels[i * 4u + 2u] == 0);
+            REQUIRE(pixels[i * 4u + 3u] == 255);
+        }
+    }
+
+    TEST_CASE("BlockCompression: Decodes BC4 reference block in six value mode", "[image][bc]")
+    {
+        constexpr std::uint8_t block[]{0x20, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+        std::uint8_t pixels[PIXELS_PER_BLOCK * 4u];
+        DecodeBlockBC4(block, pixels);
+
+        REQUIRE(pixels[0] == 0);
+        REQUIRE(pixels[4] == 255);
+        for (auto i = 2u; i < PIXELS_PER_BLOCK; i++)
+            REQUIRE(pixels[i * 4u] == 0x20);
+    }
+
+    TEST_CASE("BlockCompression: Solid colors survive a round trip", "[image][bc]")
+    {
+        const auto formatId = GENERATE(ImageFormatId::BC1, ImageFormatId::BC2, ImageFormatId::BC3, ImageFormatId::BC4, ImageFormatId::BC5);
+        const auto quality = GENERATE(CompressionQuality::FAST, CompressionQuality::NORMAL, CompressionQuality::HIGH);
+
+        constexpr auto width = 8u;
+        constexpr auto height = 8u;
+        std::vector<std::uint8_t> pixels(width * height * 4u);
+        for (auto i = 0u; i < width * height; i++)
+        {
+            pixels[i * 4u + 0u] = REPRESENTABLE_R;
+            pixels[i * 4u + 1u] = REPRESENTABLE_G;
+            pixels[i * 4u + 2u] = REPRESENTABLE_B;
+            pixels[i * 4u + 3u] = 255;
+        }
+
+        std::vector<std::uint8_t> blocks(GetBlocksSize(formatId, width, height));
+        std::vector<std::uint8_t> decoded(pixels.size());
+        REQUIRE(Compress(formatId, pixels.data(), width, height, blocks.data(), quality));
+        REQUIRE(Decompress(formatId, blocks.data(), width, height, decoded.data()));
+
+        const auto channelCount = formatId == ImageFormatId::BC4 ? 1u : formatId == ImageFormatId::BC5 ? 2u : 4u;
+        for (auto i = 0u; i < width * height; i++)
+        {
+            for (auto channel = 0u; channel < channelCount; channel++)
+                REQUIRE(decoded[i * 4u + channel] == pixels[i * 4u + channel]);
+        }
+    }
+
+    TEST_CASE("BlockCompression: Gradients stay within error bounds", "[image][bc]")
+    {
+        const auto quality = GENERATE(CompressionQuality::FAST, CompressionQuality::NORMAL, CompressionQuality::HIGH);
+
+        constexpr auto width = 64u;
+        constexpr auto height = 64u;
+        const auto pixels = CreateGradient(width, height);
+
+        SECTION("BC1")
+        {
+            // BC1 would treat half of the gradient as transparent
+            auto opaquePixels = pixels;
+            for (auto i = 3u; i < opaquePixels.size(); i += 4u)
+                opaquePixels[i] = 255;
+
+            std::vector<std::uint8_t> blocks(GetBlocksSize(ImageFormatId::BC1, width, height));
+            std::vector<std::uint8_t> decoded(pixels.size());
+            REQUIRE(Compress(ImageFormatId::BC1, opaquePixels.data(), width, height, blocks.data(), quality));
+            REQUIRE(Decompress(ImageFormatId::BC1, blocks.data(), width, height, decoded.data()));
+
+            for (auto channel = 0u; channel < 3u; channel++)
+                REQUIRE(RootMeanSquareError(opaquePixels, decoded, channel) < 6.0);
+        }
+
+        SECTION("BC3")
+        {
+            std::vector<std::uint8_t> blocks(GetBlocksSize(ImageFormatId::BC3, width, height));
+            std::vector<std::uint8_t> decoded(pixels.size());
+            REQUIRE(Compress(ImageFormatId::BC3, pixels.data(), width, height, blocks.data(), quality));
+            REQUIRE(Decompress(ImageFormatId::BC3, blocks.data(), width, height, decoded.data()));
+
+            for (auto channel = 0u; channel < 3u; channel++)
+                REQUIRE(RootMeanSquareError(pixels, decoded, channel) < 6.0);
+            REQUIRE(RootMeanSquareError(pixels, decoded, 3u) < 2.0);
+        }
+
+        SECTION("BC5")
+        {
+            std::vector<std::uint8_t> blocks(GetBlocksSize(ImageFormatId::BC5, width, height));
+            std::vector<std::uint8_t> decoded(pixels.size());
+            REQUIRE(Compress(ImageFormatId::BC5, pixels.data(), width, height, blocks.data(), quality));
+            REQUIRE(Decompress(ImageFormatId::BC5, blocks.data(), width, height, decoded.data()));
+
+            REQUIRE(RootMeanSquareError(pixels, decoded, 0u) < 2.0);
+            REQUIRE(RootMeanSquareError(pixels, decoded, 1u) < 2.0);
+        }
+    }
+
+    TEST_CASE("BlockCompression: BC1 keeps punch through alpha", "[image][bc]")
+    {
+        std::uint8_t pixels[PIXELS_PER_BLOCK * 4u];
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+        {
+            pixels[i * 4u + 0u] = static_cast<std::uint8_t>(i * 16u);
+            pixels[i * 4u + 1u] = 64;
+            pixels[i * 4u + 2u] = 32;
+            pixels[i * 4u + 3u] = i % 2u == 0u ? 255 : 0;
+        }
+
+        std::uint8_t block[8];
+        std::uint8_t decoded[PIXELS_PER_BLOCK * 4u];
+        EncodeBlockBC1(pixels, block, CompressionQuality::NORMAL);
+        DecodeBlockBC1(block, decoded);
+
+        for (auto i = 0u; i < PIXELS_PER_BLOCK; i++)
+            REQUIRE(decoded[i * 4u + 3u] == pixels[i * 4u + 3u]);
+    }
+
+    TEST_CASE("BlockCompression: Handles images that are not a multiple of the block size", "[image][bc]")
+    {
+        const auto threadCount = GENERATE(1u, 4u);
+        ThreadPool threadPool(threadCount);
+
+        constexpr auto width = 6u;
+        constexpr auto height = 9u;
+        std::vector<std::uint8_t> pixels(width * height * 4u);
+        for (auto y = 0u; y < height; y++)
+        {
+            for (auto x = 0u; x < width; x++)
+            {
+                // Every block has its own color so that misplaced blocks would be noticed
+                const auto blockX = x / BLOCK_SIZE;
+                const auto blockY = y / BLOCK_SIZE;
+                auto* pixel = &pixels[(y * width + x) * 4u];
+                pixel[0] = static_cast<std::uint8_t>(blockX % 2u == 0u ? 255 : 0);
+                pixel[1] = static_cast<std::uint8_t>(blockY % 2u == 0u ? 255 : 0);
+                pixel[2] = static_cast<std::uint8_t>(blockY == 2u ? 255 : 0);
+                pixel[3] = 255;
+            }
+        }
+
+        std::vector<std::uint8_t> blocks(GetBlocksSize(ImageFormatId::BC3, width, height));
+        REQUIRE(blocks.size() == 2u * 3u * 16u);
+
+        std::vector<std::uint8_t> decoded(pixels.size());
+        REQUIRE(Compress(ImageFormatId::BC3, pixels.data(), width, height, blocks.data(), CompressionQuality::NORMAL, &threadPool));
+        REQUIRE(Decompress(ImageFormatId::BC3, blocks.data(), width, height, decoded.data(), &threadPool));
+
+        REQUIRE(decoded == pixels);
+    }
+
+    TEST_CASE("BlockCompression: Does not support uncompressed formats", "[image][bc]")
+    {
+        REQUIRE(IsSupportedFormat(ImageFormatId::BC1));
+        REQUIRE(IsSupportedFormat(ImageFormatId::BC5));
+        REQUIRE_FALSE(IsSupportedFormat(ImageFormatId::R8_G8_B8_A8));
+
+        std::uint8_t pixels[PIXELS_PER_BLOCK * 4u]{};
+        std::uint8_t blocks[16]{};
+        REQUIRE_FALSE(Compress(ImageFormatId::R8_G8_B8_A8, pixels, 4u, 4u, blocks, CompressionQuality::FAST));
+        REQUIRE_FALSE(Decompress(ImageFormatId::A8, blocks, 4u, 4u, pixels));
+    }
+
+    TEST_CASE("TextureConverter: Converts between unsigned and block compressed formats", "[image][bc]")
+    {
+        Texture2D texture(&ImageFormat::FORMAT_B8_G8_R8_A8, 16u, 8u, true);
+        texture.Allocate();
+
+        for (auto mipLevel = 0; mipLevel < texture.GetMipMapCount(); mipLevel++)
+        {
+            auto* buffer = texture.GetBufferForMipLevel(mipLevel, 0);
+            const auto pixelCount = texture.GetSizeOfMipLevel(mipLevel) / 4u;
+            for (auto i = 0u; i < pixelCount; i++)
+            {
+                buffer[i * 4u + 0u] = REPRESENTABLE_B;
+                buffer[i * 4u + 1u] = REPRESENTABLE_G;
+                buffer[i * 4u + 2u] = REPRESENTABLE_R;
+                buffer[i * 4u + 3u] = static_cast<std::uint8_t>(mipLevel * 17);
+            }
+        }
+
+        TextureConverter compressor(&texture, &ImageFormat::FORMAT_BC3, CompressionQuality::HIGH);
+        const auto compressed = compressor.Convert();
+        REQUIRE(compressed->GetFormat() == &ImageFormat::FORMAT_BC3);
+        REQUIRE(compressed->GetMipMapCount() == texture.GetMipMapCount());
+
+        TextureConverter decompressor(compressed.get(), &ImageFormat::FORMAT_R8_G8_B8_A8);
+        const auto decompressed = decompressor.Convert();
+
+        for (auto mipLevel = 0; mipLevel < texture.GetMipMapCount(); mipLevel++)
+        {
+            const auto* buffer = decompressed->GetBufferForMipLevel(mipLevel);
+            const auto pixelCount = decompressed->GetSizeOfMipLevel(mipLevel) / 4u;
+            for (auto i = 0u; i < pixelCount; i++)
+            {
+                REQUIRE(buffer[i * 4u + 0u] == REPRESENTABLE_R);
+                REQUIRE(buffer[i * 4u + 1u] == REPRESENTABLE_G);
+                REQUIRE(buffer[i * 4u + 2u] == REPRESENTABLE_B);
+                REQUIRE(buffer[i * 4u + 3u] == mipLevel * 17);
+            }
+        }
+    }
+
+    TEST_CASE("TextureConverter: Generates mip maps when compressing", "[image][bc]")
+    {
+        Texture2D texture(&ImageFormat::FORMAT_R8_G8_B8_A8, 16u, 8u, false);
+        texture.Allocate();
+
+        auto* buffer = texture.GetBufferForMipLevel(0, 0);
+        for (auto i = 0u; i < 16u * 8u; i++)
+        {
+            buffer[i * 4u + 0u] = REPRESENTABLE_R;
+            buffer[i * 4u + 1u] = REPRESENTABLE_G;
+            buffer[i * 4u + 2u] = REPRESENTABLE_B;
+            buffer[i * 4u + 3u] = 0xFF;
+        }
+
+        ThreadPool threadPool(2u);
+        TextureConverter compressor(&texture, &ImageFormat::FORMAT_BC1, CompressionQuality::NORMAL, &threadPool);
+        compressor.GenerateMipMaps(mip::MipFilter::BOX);
+        const auto compressed = compressor.Convert();
+        REQUIRE(compressed->HasMipMaps());
+        REQUIRE(compressed->GetMipMapCount() == 5);
+
+        TextureConverter decompressor(compressed.get(), &ImageFormat::FORMAT_R8_G8_B8_A8);
+        const auto decompressed = decompressor.Convert();
+
+        for (auto mipLevel = 0; mipLevel < decompressed->GetMipMapCount(); mipLevel++)
+        {
+            const auto* mipBuffer = decompressed->GetBufferForMipLevel(mipLevel);
+            const auto pixelCount = decompressed->GetSizeOfMipLevel(mipLevel) / 4u;
+            for (auto i = 0u; i < pixelCount; i++)
+            {
+                REQUIRE(mipBuffer[i * 4u + 0u] == REPRESENTABLE_R);
+                REQUIRE(mipBuffer[i * 4u + 1u] == REPRESENTABLE_G);
+                REQUIRE(mipBuffer[i * 4u + 2u] == REPRESENTABLE_B);
+                REQUIRE(mipBuffer[i * 4u + 3u] == 0xFF);
+            }
+        }
+    }
+
+    TEST_CASE("TextureConverter: Rejects compressing and generating mip maps for float textures", "[image][bc]")
+    {
+        Texture2D texture(&ImageFormat::FORMAT_R16_G16_B16_A16_FLOAT, 8u, 8u, false);
+        texture.Allocate();
+
+        REQUIRE_FALSE(TextureConverter::SupportsRgba8Conversion(&ImageFormat::FORMAT_R16_G16_B16_A16_FLOAT));
+
+        TextureConverter compressor(&texture, &ImageFormat::FORMAT_BC1);
+        REQUIRE(compressor.Convert() == nullptr);
+
+        TextureConverter mipMapGenerator(&texture, &ImageFormat::FORMAT_R16_G16_B16_A16_FLOAT);
+        mipMapGenerator.GenerateMipMaps(mip::MipFilter::BOX);
+        REQUIRE(mipMapGenerator.Convert() == nullptr);
+    }
+
+    TEST_CASE("BlockCompression: Throughput", "[.][benchmark][image][bc]")
+    {
+        constexpr auto width = 2048u;
+        constexpr auto height = 2048u;
+        constexpr auto megaPixels = static_cast<double>(width) * height / 1000000.0;
+
+        auto pixels = CreateGradient(width, height);
+        std::srand(0);
+        for (auto& value : pixels)
+            value = static_cast<std::uint8_t>(std::clamp(static_cast<int>(value) + std::rand() % 17 - 8, 0, 255));
+
+        ThreadPool threadPool;
+        std::vector<std::uint8_t> decoded(pixels.size());
+
+        for (const auto formatId : {ImageFormatId::BC1, ImageFormatId::BC2, ImageFormatId::BC3, ImageFormatId::BC4, ImageFormatId::BC5})
+        {
+            std::vector<std::uint8_t> blocks(GetBlocksSize(formatId, width, height));
+
+            for (const auto quality : {CompressionQuality::FAST, CompressionQuality::NORMAL, CompressionQuality::HIGH})
+            {
+                const auto start = std::chrono::steady_clock::now();
+                REQUIRE(Compress(formatId, pixels.data(), width, height, blocks.data(), quality, &threadPool));
+                const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+                std::cout << std::format("BC{} encode quality {}: {:.1f} MPixels/s\n",
+                                         static_cast<unsigned>(formatId) - static_cast<unsigned>(ImageFormatId::BC1) + 1u,
+                                         static_cast<unsigned>(quality),
+                                         megaPixels / duration.count());
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            REQUIRE(Decompress(formatId, blocks.data(), width, height, decoded.data(), &threadPool));
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+            std::cout << std::format("BC{} decode: {:.1f} MPixels/s\n",
+                                     static_cast<unsigned>(formatId) - static_cast<unsigned>(ImageFormatId::BC1) + 1u,
+                                     megaPixels / duration.count());
+        }
+    }
+} // namespace image::block_compression
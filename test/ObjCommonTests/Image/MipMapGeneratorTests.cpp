@@ -0,0 +1,130 @@
+#include "Image/MipMapGenerator.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cstdint>
+#include <cstring>
+
+using namespace mip;
+
+namespace image::mip_map_generator
+{
+    TEST_CASE("MipMapGenerator: Box filter averages texels", "[image][mip]")
+    {
+        Texture2D texture(&ImageFormat::FORMAT_R8, 4u, 4u, true);
+        texture.Allocate();
+
+        constexpr std::uint8_t pixels[]{
+            0,  40,  100, 100,
+            80, 120, 100, 100,
+            0,  0,   255, 255,
+            0,  0,   255, 255,
+        };
+        std::memcpy(texture.GetBufferForMipLevel(0, 0), pixels, sizeof(pixels));
+
+        REQUIRE(GenerateMipMaps(texture, MipFilter::BOX));
+        REQUIRE(texture.GetMipMapCount() == 3);
+
+        const auto* mip1 = texture.GetBufferForMipLevel(1, 0);
+        REQUIRE(mip1[0] == 60);
+        REQUIRE(mip1[1] == 100);
+        REQUIRE(mip1[2] == 0);
+        REQUIRE(mip1[3] == 255);
+
+        const auto* mip2 = texture.GetBufferForMipLevel(2, 0);
+        REQUIRE(mip2[0] == 104);
+    }
+
+    TEST_CASE("MipMapGenerator: Box filter handles dimensions that are not a power of two", "[image][mip]")
+    {
+        Texture2D texture(&ImageFormat::FORMAT_R8_A8, 3u, 1u, true);
+        texture.Allocate();
+
+        constexpr std::uint8_t pixels[]{30, 255, 60, 255, 90, 0};
+        std::memcpy(texture.GetBufferForMipLevel(0, 0), pixels, sizeof(pixels));
+
+        REQUIRE(GenerateMipMaps(texture, MipFilter::BOX));
+        REQUIRE(texture.GetMipMapCount() == 2);
+
+        // Each texel of the 3 texel wide source covers a third of the single target texel
+        const auto* mip1 = texture.GetBufferForMipLevel(1, 0);
+        REQUIRE(mip1[0] == 60);
+        REQUIRE(mip1[1] == 170);
+    }
+
+    TEST_CASE("MipMapGenerator: Keeps solid colors", "[image][mip]")
+    {
+        const auto filter = GENERATE(MipFilter::BOX, MipFilter::KAISER);
+
+        TextureCube texture(&ImageFormat::FORMAT_R8_G8_B8_A8, 16u, 16u, true);
+        texture.Allocate();
+
+        for (auto face = 0; face < texture.GetFaceCount(); face++)
+        {
+            auto* buffer = texture.GetBufferForMipLevel(0, face);
+            for (auto i = 0u; i < texture.GetSizeOfMipLevel(0); i += 4u)
+            {
+                buffer[i + 0u] = static_cast<std::uint8_t>(face * 40);
+                buffer[i + 1u] = 128;
+                buffer[i + 2u] = 255;
+                buffer[i + 3u] = 7;
+            }
+        }
+
+        REQUIRE(GenerateMipMaps(texture, filter));
+
+        for (auto mipLevel = 1; mipLevel < texture.GetMipMapCount(); mipLevel++)
+        {
+            for (auto face = 0; face < texture.GetFaceCount(); face++)
+            {
+                const auto* buffer = texture.GetBufferForMipLevel(mipLevel, face);
+                for (auto i = 0u; i < texture.GetSizeOfMipLevel(mipLevel); i += 4u)
+                {
+                    REQUIRE(buffer[i + 0u] == face * 40);
+                    REQUIRE(buffer[i + 1u] == 128);
+                    REQUIRE(buffer[i + 2u] == 255);
+                    REQUIRE(buffer[i + 3u] == 7);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("MipMapGenerator: Kaiser filter keeps gradients monotonic", "[image][mip]")
+    {
+        Texture2D texture(&ImageFormat::FORMAT_R8, 32u, 1u, true);
+        texture.Allocate();
+
+        auto* buffer = texture.GetBufferForMipLevel(0, 0);
+        for (auto x = 0u; x < 32u; x++)
+            buffer[x] = static_cast<std::uint8_t>(x * 8u);
+
+        REQUIRE(GenerateMipMaps(texture, MipFilter::KAISER));
+
+        const auto* mip1 = texture.GetBufferForMipLevel(1, 0);
+        for (auto x = 1u; x < 16u; x++)
+            REQUIRE(mip1[x] > mip1[x - 1u]);
+    }
+
+    TEST_CASE("MipMapGenerator: Filters depth of 3D textures", "[image][mip]")
+    {
+        Texture3D texture(&ImageFormat::FORMAT_R8, 2u, 2u, 2u, true);
+        texture.Allocate();
+
+        constexpr std::uint8_t pixels[]{0, 0, 0, 0, 200, 200, 200, 200};
+        std::memcpy(texture.GetBufferForMipLevel(0, 0), pixels, sizeof(pixels));
+
+        REQUIRE(GenerateMipMaps(texture, MipFilter::BOX));
+        REQUIRE(texture.GetBufferForMipLevel(1, 0)[0] == 100);
+    }
+
+    TEST_CASE("MipMapGenerator: Does not support block compressed formats", "[image][mip]")
+    {
+        Texture2D texture(&ImageFormat::FORMAT_BC1, 4u, 4u, true);
+        texture.Allocate();
+
+        REQUIRE_FALSE(SupportsImageFormat(&ImageFormat::FORMAT_BC1));
+        REQUIRE_FALSE(SupportsImageFormat(&ImageFormat::FORMAT_R16_G16_B16_A16_FLOAT));
+        REQUIRE(SupportsImageFormat(&ImageFormat::FORMAT_B8_G8_R8_X8));
+        REQUIRE_FALSE(GenerateMipMaps(texture, MipFilter::BOX));
+    }
+} // namespace image::mip_map_generator
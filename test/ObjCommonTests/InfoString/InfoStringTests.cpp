@@ -0,0 +1,60 @@
+#include "InfoString/InfoString.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+
+using namespace std::literals;
+
+namespace test::info_string
+{
+    TEST_CASE("InfoString: Can read values from stream", "[infostring]")
+    {
+        std::istringstream ss("WEAPONFILE\\displayName\\Cool gun\\fireTime\\0.1\\ammoName\\cool_ammo");
+
+        InfoString infoString;
+        REQUIRE(infoString.FromStream("WEAPONFILE", ss));
+
+        REQUIRE(infoString.HasKey("displayName"));
+        REQUIRE(infoString.GetValueForKey("displayName") == "Cool gun"s);
+        REQUIRE(infoString.GetValueForKey("fireTime") == "0.1"s);
+        REQUIRE(infoString.GetValueForKey("ammoName") == "cool_ammo"s);
+
+        auto foundValue = true;
+        REQUIRE(infoString.GetValueForKey("clipSize", &foundValue).empty());
+        REQUIRE(!foundValue);
+        REQUIRE(!infoString.HasKey("clipSize"));
+    }
+
+    TEST_CASE("InfoString: Later values override earlier values and keep their position", "[infostring]")
+    {
+        std::istringstream ss("WEAPONFILE\\b\\1\\a\\2\\b\\3\\c\\4");
+
+        InfoString infoString;
+        REQUIRE(infoString.FromStream("WEAPONFILE", ss));
+
+        REQUIRE(infoString.GetValueForKey("b") == "3"s);
+        REQUIRE(infoString.ToString("WEAPONFILE") == "WEAPONFILE\\b\\3\\a\\2\\c\\4"s);
+    }
+
+    TEST_CASE("InfoString: Keeps insertion order when setting and removing keys", "[infostring]")
+    {
+        InfoString infoString;
+        infoString.SetValueForKey("zeta", "1");
+        infoString.SetValueForKey("alpha", "2");
+        infoString.SetValueForKey("mu", "3");
+        infoString.SetValueForKey("beta", "4");
+
+        infoString.RemoveKey("alpha");
+        infoString.RemoveKey("unknown");
+
+        REQUIRE(!infoString.HasKey("alpha"));
+        REQUIRE(infoString.GetValueForKey("zeta") == "1"s);
+        REQUIRE(infoString.GetValueForKey("mu") == "3"s);
+        REQUIRE(infoString.GetValueForKey("beta") == "4"s);
+        REQUIRE(infoString.ToString() == "zeta\\1\\mu\\3\\beta\\4"s);
+
+        infoString.SetValueForKey("alpha", "5");
+        REQUIRE(infoString.ToString() == "zeta\\1\\mu\\3\\beta\\4\\alpha\\5"s);
+    }
+} // namespace test::info_string
@@ -0,0 +1,185 @@
+#include "OatTestPaths.h"
+#include "Obj/Gdt/Gdt.h"
+#include "Obj/Gdt/GdtCache.h"
+#include "Obj/Gdt/GdtStream.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace obj::gdt_cache_test
+{
+    fs::path WriteGdtFile(const std::string& fileName, const Gdt& gdt)
+    {
+        const auto gdtPath = oat::paths::GetTempDirectory() / fileName;
+        std::ofstream file(gdtPath, std::ios::out | std::ios::binary);
+        GdtOutputStream::WriteGdt(gdt, file);
+
+        fs::remove(gdt_cache::GetCachePath(gdtPath));
+
+        return gdtPath;
+    }
+
+    bool ParseGdtFile(const fs::path& gdtPath, Gdt& gdt)
+    {
+        std::ifstream file(gdtPath, std::ios::in | std::ios::binary);
+        GdtReader reader(file);
+
+        return reader.Read(gdt);
+    }
+
+    TEST_CASE("GdtCache: Ensure can load cached gdt", "[gdt]")
+    {
+        Gdt gdt(GdtVersion("t6", 1));
+        {
+            auto parent = std::make_unique<GdtEntry>("parent_entry", "weapon.gdf");
+            parent->m_properties["damage"] = "50";
+            parent->m_properties["displayName"] = "very\nkewl\\stuff";
+            auto child = std::make_unique<GdtEntry>("child_entry", parent.get());
+            child->m_properties["damage"] = "70";
+
+            gdt.m_entries.emplace_back(std::move(parent));
+            gdt.m_entries.emplace_back(std::move(child));
+        }
+
+        const auto gdtPath = WriteGdtFile("cache_test.gdt", gdt);
+
+        Gdt parsedGdt;
+        REQUIRE(ParseGdtFile(gdtPath, parsedGdt));
+        REQUIRE(gdt_cache::Save(gdtPath, parsedGdt));
+
+        Gdt cachedGdt;
+        REQUIRE(gdt_cache::Load(gdtPath, cachedGdt));
+
+        REQUIRE(cachedGdt.m_version.m_game == "t6");
+        REQUIRE(cachedGdt.m_version.m_version == 1);
+        REQUIRE(cachedGdt.m_entries.size() == 2);
+
+        {
+            const auto& entry = *cachedGdt.m_entries[0];
+            REQUIRE(entry.m_name == "parent_entry");
+            REQUIRE(entry.m_gdf_name == "weapon.gdf");
+            REQUIRE(entry.m_parent == nullptr);
+            REQUIRE(entry.m_properties.size() == 2);
+            REQUIRE(entry.m_properties.at("damage") == "50");
+            REQUIRE(entry.m_properties.at("displayName") == "very\nkewl\\stuff");
+        }
+
+        {
+            const auto& entry = *cachedGdt.m_entries[1];
+            REQUIRE(entry.m_name == "child_entry");
+            REQUIRE(entry.m_gdf_name == "weapon.gdf");
+            REQUIRE(entry.m_parent == cachedGdt.m_entries[0].get());
+            REQUIRE(entry.m_properties.size() == 1);
+            REQUIRE(entry.m_properties.at("damage") == "70");
+        }
+    }
+
+    TEST_CASE("GdtCache: Ensure cache is not used when gdt changed", "[gdt]")
+    {
+        Gdt gdt(GdtVersion("t6", 1));
+        gdt.m_entries.emplace_back(std::make_unique<GdtEntry>("entry", "weapon.gdf"));
+
+        const auto gdtPath = WriteGdtFile("stale_cache_test.gdt", gdt);
+
+        REQUIRE(gdt_cache::Save(gdtPath, gdt));
+
+        gdt.m_entries[0]->m_properties["changed"] = "1";
+        {
+            std::ofstream file(gdtPath, std::ios::out | std::ios::binary);
+            GdtOutputStream::WriteGdt(gdt, file);
+        }
+
+        Gdt cachedGdt;
+        REQUIRE(!gdt_cache::Load(gdtPath, cachedGdt));
+        REQUIRE(cachedGdt.m_entries.empty());
+    }
+
+    TEST_CASE("GdtCache: Ensure failed save keeps previous cache", "[gdt]")
+    {
+        Gdt gdt(GdtVersion("t6", 1));
+        gdt.m_entries.emplace_back(std::make_unique<GdtEntry>("entry", "weapon.gdf"));
+
+        const auto gdtPath = WriteGdtFile("failed_save_test.gdt", gdt);
+
+        REQUIRE(gdt_cache::Save(gdtPath, gdt));
+
+        // The parent of the entry is not part of the gdt so the cache cannot be written
+        GdtEntry missingParent("missing_parent", "weapon.gdf");
+        Gdt brokenGdt(GdtVersion("t6", 1));
+        brokenGdt.m_entries.emplace_back(std::make_unique<GdtEntry>("child_entry", &missingParent));
+
+        REQUIRE(!gdt_cache::Save(gdtPath, brokenGdt));
+
+        Gdt cachedGdt;
+        REQUIRE(gdt_cache::Load(gdtPath, cachedGdt));
+        REQUIRE(cachedGdt.m_entries.size() == 1);
+        REQUIRE(cachedGdt.m_entries[0]->m_name == "entry");
+    }
+
+    TEST_CASE("GdtCache: Ensure no cache is loaded when none exists", "[gdt]")
+    {
+        Gdt gdt(GdtVersion("t6", 1));
+        const auto gdtPath = WriteGdtFile("no_cache_test.gdt", gdt);
+
+        Gdt cachedGdt;
+        REQUIRE(!gdt_cache::Load(gdtPath, cachedGdt));
+    }
+
+    TEST_CASE("GdtCache: Parse time of large gdt", "[.][benchmark][gdt]")
+    {
+        constexpr auto targetSize = 50u * 1024u * 1024u;
+
+        // Synthetic weapon gdt with every second entry inheriting from the previous one
+        std::ostringstream ss;
+        ss << "{\n";
+        auto entryIndex = 0u;
+        while (static_cast<size_t>(ss.tellp()) < targetSize)
+        {
+            if (entryIndex % 2u == 0u)
+                ss << std::format("\t\"weapon_{}\" ( \"weapon.gdf\" )\n\t{{\n", entryIndex);
+            else
+                ss << std::format("\t\"weapon_{}\" [ \"weapon_{}\" ]\n\t{{\n", entryIndex, entryIndex - 1u);
+
+            for (auto propertyIndex = 0u; propertyIndex < 100u; propertyIndex++)
+                ss << std::format("\t\t\"property_{:03}\" \"{}\"\n", propertyIndex, entryIndex * propertyIndex);
+
+            ss << "\t}\n";
+            entryIndex++;
+        }
+        ss << "}";
+
+        const auto gdtPath = oat::paths::GetTempDirectory() / "benchmark.gdt";
+        {
+            std::ofstream file(gdtPath, std::ios::out | std::ios::binary);
+            file << ss.str();
+        }
+        fs::remove(gdt_cache::GetCachePath(gdtPath));
+
+        Gdt parsedGdt;
+        const auto parseStart = std::chrono::steady_clock::now();
+        REQUIRE(ParseGdtFile(gdtPath, parsedGdt));
+        const std::chrono::duration<double> parseDuration = std::chrono::steady_clock::now() - parseStart;
+
+        REQUIRE(gdt_cache::Save(gdtPath, parsedGdt));
+
+        Gdt cachedGdt;
+        const auto cacheStart = std::chrono::steady_clock::now();
+        REQUIRE(gdt_cache::Load(gdtPath, cachedGdt));
+        const std::chrono::duration<double> cacheDuration = std::chrono::steady_clock::now() - cacheStart;
+
+        REQUIRE(cachedGdt.m_entries.size() == parsedGdt.m_entries.size());
+
+        std::cout << std::format("Parsed {} entries from {} MB gdt in {:.3f}s, loaded cache in {:.3f}s\n",
+                                 parsedGdt.m_entries.size(),
+                                 fs::file_size(gdtPath) / (1024u * 1024u),
+                                 parseDuration.count(),
+                                 cacheDuration.count());
+    }
+} // namespace obj::gdt_cache_test
@@ -3,6 +3,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
+#include <format>
 #include <sstream>
 
 namespace obj::gdt
@@ -337,4 +338,53 @@ namespace obj::gdt
             REQUIRE(entry.m_properties.at("hello") == "very\nkewl\\stuff");
         }
     }
+
+    TEST_CASE("Gdt: Ensure properties added out of order can be found after adding more properties", "[gdt]")
+    {
+        GdtEntry entry("sickentry", "verycool.gdf");
+
+        entry.m_properties["zebra"] = "last";
+        entry.m_properties["apple"] = "first";
+        REQUIRE(entry.m_properties.emplace("mango", "middle").second);
+
+        // Fill enough properties to make the container grow
+        for (auto i = 0; i < 100; i++)
+            entry.m_properties[std::format("key{}", 99 - i)] = std::to_string(i);
+
+        REQUIRE(!entry.m_properties.emplace("mango", "other").second);
+        entry.m_properties["apple"] = "still first";
+
+        REQUIRE(entry.m_properties.size() == 103);
+        REQUIRE(entry.m_properties.at("zebra") == "last");
+        REQUIRE(entry.m_properties.at("apple") == "still first");
+        REQUIRE(entry.m_properties.at("mango") == "middle");
+        REQUIRE(entry.m_properties.at("key0") == "99");
+        REQUIRE(entry.m_properties.at("key99") == "0");
+        REQUIRE(entry.m_properties.find("key100") == entry.m_properties.end());
+
+        const GdtEntry& constEntry = entry;
+        REQUIRE(constEntry.m_properties.at("key42") == "57");
+
+        std::string previousKey;
+        for (const auto& [key, value] : entry.m_properties)
+        {
+            REQUIRE(previousKey < key);
+            previousKey = key;
+        }
+
+        Gdt gdt;
+        gdt.m_entries.emplace_back(std::make_unique<GdtEntry>(std::move(entry)));
+
+        std::stringstream ss;
+        GdtOutputStream::WriteGdt(gdt, ss);
+
+        Gdt gdt2;
+        GdtReader reader(ss);
+        REQUIRE(reader.Read(gdt2));
+
+        REQUIRE(gdt2.m_entries.size() == 1);
+        REQUIRE(gdt2.m_entries[0]->m_properties.size() == 103);
+        REQUIRE(gdt2.m_entries[0]->m_properties.at("apple") == "still first");
+        REQUIRE(gdt2.m_entries[0]->m_properties.at("key42") == "57");
+    }
 } // namespace obj::gdt
@@ -0,0 +1,196 @@
+#include "Utils/BufferedTextWriter.h"
+
+#include <bit>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace utils::buffered_text_writer
+{
+    std::vector<float> CreateTestFloats()
+    {
+        std::vector<float> values{
+            0.0f,
+            -0.0f,
+            1.0f,
+            -1.0f,
+            0.5f,
+            0.1f,
+            1e-8f,
+            -1e-8f,
+            0.0000005f,
+            0.0000015f,
+            123456.5f,
+            1234567.0f,
+            1e30f,
+            -1e30f,
+            std::numeric_limits<float>::min(),
+            std::numeric_limits<float>::denorm_min(),
+            std::numeric_limits<float>::max(),
+            std::numeric_limits<float>::lowest(),
+            std::numeric_limits<float>::infinity(),
+            -std::numeric_limits<float>::infinity(),
+            std::numeric_limits<float>::quiet_NaN(),
+        };
+
+        std::mt19937 random(0);
+        std::uniform_real_distribution smallDistribution(-2.0f, 2.0f);
+        std::uniform_real_distribution largeDistribution(-100000.0f, 100000.0f);
+        for (auto i = 0u; i < 5000u; i++)
+        {
+            values.emplace_back(smallDistribution(random));
+            values.emplace_back(largeDistribution(random));
+            values.emplace_back(std::bit_cast<float>(static_cast<uint32_t>(random())));
+        }
+
+        return values;
+    }
+
+    TEST_CASE("BufferedTextWriter: Formats floats like std::ostream", "[utils][text]")
+    {
+        std::ostringstream expected;
+        std::ostringstream actual;
+
+        {
+            BufferedTextWriter writer(actual);
+            for (const auto value : CreateTestFloats())
+            {
+                expected << value << ' ';
+                writer << value << ' ';
+            }
+        }
+
+        REQUIRE(actual.str() == expected.str());
+    }
+
+    TEST_CASE("BufferedTextWriter: Formats fixed and shortest floats like std::format", "[utils][text]")
+    {
+        std::string expected;
+        std::ostringstream actual;
+
+        {
+            BufferedTextWriter writer(actual);
+            for (const auto value : CreateTestFloats())
+            {
+                expected += std::format("{:.6f} {:.2f} {}\n", value, value, value);
+                writer << BufferedTextWriter::Fixed{value} << " " << BufferedTextWriter::Fixed{value, 2} << " " << BufferedTextWriter::Shortest{value} << "\n";
+            }
+        }
+
+        REQUIRE(actual.str() == expected);
+    }
+
+    TEST_CASE("BufferedTextWriter: Formats integers like std::ostream", "[utils][text]")
+    {
+        std::ostringstream expected;
+        std::ostringstream actual;
+
+        {
+            BufferedTextWriter writer(actual);
+            const auto writeValue = [&](const auto value)
+            {
+                expected << value << ' ';
+                writer << value << ' ';
+            };
+
+            writeValue(0);
+            writeValue(-1);
+            writeValue(std::numeric_limits<int>::min());
+            writeValue(std::numeric_limits<int>::max());
+            writeValue(std::numeric_limits<unsigned>::max());
+            writeValue(std::numeric_limits<long long>::min());
+            writeValue(std::numeric_limits<size_t>::max());
+            writeValue(static_cast<short>(-1234));
+
+            std::mt19937_64 random(0);
+            for (auto i = 0u; i < 1000u; i++)
+            {
+                writeValue(static_cast<int>(random()));
+                writeValue(static_cast<size_t>(random()));
+            }
+        }
+
+        REQUIRE(actual.str() == expected.str());
+    }
+
+    TEST_CASE("BufferedTextWriter: Writes text larger than the buffer", "[utils][text]")
+    {
+        const std::string smallText("abc");
+        const std::string largeText(0x30000, 'x');
+        std::ostringstream actual;
+
+        {
+            BufferedTextWriter writer(actual);
+            writer << smallText << largeText << smallText << 'd';
+
+            // Nothing is written until the buffer is full or flushed
+            writer.Flush();
+            REQUIRE(actual.str() == smallText + largeText + smallText + "d");
+
+            writer << 42;
+        }
+
+        REQUIRE(actual.str() == smallText + largeText + smallText + "d42");
+    }
+
+    TEST_CASE("BufferedTextWriter: Float throughput", "[.][benchmark][utils][text]")
+    {
+        constexpr auto valueCount = 2000000u;
+
+        std::mt19937 random(0);
+        std::uniform_real_distribution distribution(-1000.0f, 1000.0f);
+        std::vector<float> values(valueCount);
+        for (auto& value : values)
+            value = distribution(random);
+
+        const auto printThroughput = [](const char* name, const std::chrono::duration<double> duration, const size_t byteCount)
+        {
+            std::cout << std::format("{}: {:.2f} MB/s\n", name, static_cast<double>(byteCount) / 1000000.0 / duration.count());
+        };
+
+        {
+            std::ostringstream out;
+            const auto start = std::chrono::steady_clock::now();
+            for (const auto value : values)
+                out << std::format("{:.6f}\n", value);
+            printThroughput("std::format fixed", std::chrono::steady_clock::now() - start, out.view().size());
+        }
+
+        {
+            std::ostringstream out;
+            const auto start = std::chrono::steady_clock::now();
+            {
+                BufferedTextWriter writer(out);
+                for (const auto value : values)
+                    writer << BufferedTextWriter::Fixed{value} << '\n';
+            }
+            printThroughput("BufferedTextWriter fixed", std::chrono::steady_clock::now() - start, out.view().size());
+        }
+
+        {
+            std::ostringstream out;
+            const auto start = std::chrono::steady_clock::now();
+            for (const auto value : values)
+                out << value << '\n';
+            printThroughput("std::ostream general", std::chrono::steady_clock::now() - start, out.view().size());
+        }
+
+        {
+            std::ostringstream out;
+            const auto start = std::chrono::steady_clock::now();
+            {
+                BufferedTextWriter writer(out);
+                for (const auto value : values)
+                    writer << value << '\n';
+            }
+            printThroughput("BufferedTextWriter general", std::chrono::steady_clock::now() - start, out.view().size());
+        }
+    }
+} // namespace utils::buffered_text_writer
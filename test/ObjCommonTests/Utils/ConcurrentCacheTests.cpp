@@ -0,0 +1,100 @@
+#include "Utils/ConcurrentCache.h"
+#include "Utils/ThreadPool.h"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace utils::concurrent_cache
+{
+    TEST_CASE("ConcurrentCache: Ensure value is only created once per key", "[utils]")
+    {
+        ConcurrentCache<std::string, int> cache(false);
+        std::atomic_int createCount = 0;
+
+        ThreadPool threadPool(4u);
+        std::vector<std::future<const int*>> results;
+        for (auto i = 0u; i < 16u; i++)
+        {
+            results.emplace_back(threadPool.Submit(
+                [&cache, &createCount]
+                {
+                    return cache.GetOrCreate("key",
+                                             [&createCount]
+                                             {
+                                                 ++createCount;
+                                                 std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                                                 return std::make_unique<int>(42);
+                                             });
+                }));
+        }
+
+        const auto* firstResult = results[0].get();
+        REQUIRE(firstResult != nullptr);
+        REQUIRE(*firstResult == 42);
+
+        for (auto i = 1u; i < results.size(); i++)
+            REQUIRE(results[i].get() == firstResult);
+
+        REQUIRE(createCount == 1);
+    }
+
+    TEST_CASE("ConcurrentCache: Ensure values of different keys are created concurrently", "[utils]")
+    {
+        ConcurrentCache<int, int> cache(false);
+        std::promise<void> firstCreationStarted;
+        std::promise<void> secondCreated;
+
+        ThreadPool threadPool(2u);
+
+        // The first creation only finishes after the second one, which would deadlock if creations were serialized
+        auto firstResult = threadPool.Submit(
+            [&cache, &firstCreationStarted, &secondCreated]
+            {
+                return cache.GetOrCreate(1,
+                                         [&firstCreationStarted, &secondCreated]
+                                         {
+                                             firstCreationStarted.set_value();
+                                             secondCreated.get_future().wait();
+                                             return std::make_unique<int>(1);
+                                         });
+            });
+
+        firstCreationStarted.get_future().wait();
+        const auto* secondValue = cache.GetOrCreate(2,
+                                                    []
+                                                    {
+                                                        return std::make_unique<int>(2);
+                                                    });
+        secondCreated.set_value();
+
+        REQUIRE(*secondValue == 2);
+        REQUIRE(*firstResult.get() == 1);
+    }
+
+    TEST_CASE("ConcurrentCache: Ensure failures are only cached when requested", "[utils]")
+    {
+        auto createCount = 0;
+        const auto createFailure = [&createCount]
+        {
+            ++createCount;
+            return std::unique_ptr<int>();
+        };
+
+        ConcurrentCache<int, int> retryingCache(false);
+        REQUIRE(retryingCache.GetOrCreate(1, createFailure) == nullptr);
+        REQUIRE(retryingCache.GetOrCreate(1, createFailure) == nullptr);
+        REQUIRE(createCount == 2);
+
+        createCount = 0;
+        ConcurrentCache<int, int> failureCachingCache(true);
+        REQUIRE(failureCachingCache.GetOrCreate(1, createFailure) == nullptr);
+        REQUIRE(failureCachingCache.GetOrCreate(1, createFailure) == nullptr);
+        REQUIRE(createCount == 1);
+    }
+} // namespace utils::concurrent_cache
@@ -0,0 +1,263 @@
+#include "Utils/CpuFeatures.h"
+#include "Utils/HalfFloat.h"
+#include "Utils/Pack.h"
+
+#include <algorithm>
+#include <bit>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace utils::pack
+{
+    // Not a multiple of any vector width to also cover the scalar remainder
+    constexpr auto VALUE_COUNT = 1037u;
+
+    std::vector<float> CreateRandomFloats(const size_t count, const float min, const float max)
+    {
+        std::mt19937 random(0);
+        std::uniform_real_distribution distribution(min, max);
+
+        std::vector<float> values(count);
+        for (auto& value : values)
+            value = distribution(random);
+
+        // Include values that need special treatment.
+        // Non-finite values are left out since the scalar unit vec packing converts nan to integers which is undefined.
+        const float specialValues[]{
+            0.0f,
+            -0.0f,
+            1.0f,
+            -1.0f,
+            0.5f,
+            2.0f,
+            1e-8f,
+            -1e-8f,
+            65504.0f,
+            1e30f,
+            -1e30f,
+        };
+        for (auto i = 0u; i < std::extent_v<decltype(specialValues)> && i < count; i++)
+            values[i] = specialValues[i];
+
+        return values;
+    }
+
+    std::vector<uint32_t> CreateRandomPackedValues(const size_t count)
+    {
+        std::mt19937 random(0);
+
+        std::vector<uint32_t> values(count);
+        for (auto& value : values)
+            value = static_cast<uint32_t>(random());
+
+        return values;
+    }
+
+    template<size_t ComponentCount>
+    void RequireSamePacking(const std::vector<float>& in,
+                            void (*packBatch)(std::span<const float>, std::span<uint32_t>),
+                            uint32_t (*pack)(const float (&)[ComponentCount]))
+    {
+        const auto count = in.size() / ComponentCount;
+        std::vector<uint32_t> out(count);
+        packBatch(in, out);
+
+        for (auto i = 0u; i < count; i++)
+        {
+            float value[ComponentCount];
+            for (auto component = 0u; component < ComponentCount; component++)
+                value[component] = in[i * ComponentCount + component];
+
+            REQUIRE(out[i] == pack(value));
+        }
+    }
+
+    template<size_t ComponentCount>
+    void RequireSameUnpacking(const std::vector<uint32_t>& in,
+                              void (*unpackBatch)(std::span<const uint32_t>, std::span<float>),
+                              void (*unpack)(uint32_t, float (&)[ComponentCount]))
+    {
+        std::vector<float> out(in.size() * ComponentCount);
+        unpackBatch(in, out);
+
+        for (auto i = 0u; i < in.size(); i++)
+        {
+            float value[ComponentCount];
+            unpack(in[i], value);
+
+            // Compare the bits to also cover nan and negative zero
+            for (auto component = 0u; component < ComponentCount; component++)
+                REQUIRE(std::bit_cast<uint32_t>(out[i * ComponentCount + component]) == std::bit_cast<uint32_t>(value[component]));
+        }
+    }
+
+    class Avx2Disabled
+    {
+    public:
+        Avx2Disabled()
+        {
+            CpuFeatures::SetAvx2Disabled(true);
+        }
+
+        ~Avx2Disabled()
+        {
+            CpuFeatures::SetAvx2Disabled(false);
+        }
+
+        Avx2Disabled(const Avx2Disabled& other) = delete;
+        Avx2Disabled(Avx2Disabled&& other) noexcept = delete;
+        Avx2Disabled& operator=(const Avx2Disabled& other) = delete;
+        Avx2Disabled& operator=(Avx2Disabled&& other) noexcept = delete;
+    };
+
+    void RequireSameHalfFloatConversion()
+    {
+        std::vector<half_float_t> allHalfs(std::numeric_limits<half_float_t>::max() + 1u);
+        for (auto i = 0u; i < allHalfs.size(); i++)
+            allHalfs[i] = static_cast<half_float_t>(i);
+
+        std::vector<float> floats(allHalfs.size());
+        HalfFloat::ToFloat(allHalfs, floats);
+        for (auto i = 0u; i < allHalfs.size(); i++)
+            REQUIRE(std::bit_cast<uint32_t>(floats[i]) == std::bit_cast<uint32_t>(HalfFloat::ToFloat(allHalfs[i])));
+
+        auto randomFloats = CreateRandomFloats(VALUE_COUNT, -70000.0f, 70000.0f);
+        randomFloats.emplace_back(std::numeric_limits<float>::infinity());
+        randomFloats.emplace_back(-std::numeric_limits<float>::infinity());
+        randomFloats.emplace_back(std::numeric_limits<float>::quiet_NaN());
+        std::vector<half_float_t> halfs(randomFloats.size());
+        HalfFloat::ToHalf(randomFloats, halfs);
+        for (auto i = 0u; i < randomFloats.size(); i++)
+            REQUIRE(halfs[i] == HalfFloat::ToHalf(randomFloats[i]));
+    }
+
+    void RequireSameBatchPacking()
+    {
+        RequireSamePacking<2>(CreateRandomFloats(VALUE_COUNT * 2u, -4.0f, 4.0f), pack32::Vec2PackTexCoordsUV, pack32::Vec2PackTexCoordsUV);
+        RequireSamePacking<2>(CreateRandomFloats(VALUE_COUNT * 2u, -4.0f, 4.0f), pack32::Vec2PackTexCoordsVU, pack32::Vec2PackTexCoordsVU);
+        RequireSamePacking<3>(CreateRandomFloats(VALUE_COUNT * 3u, -1.0f, 1.0f), pack32::Vec3PackUnitVecScaleBased, pack32::Vec3PackUnitVecScaleBased);
+        RequireSamePacking<3>(CreateRandomFloats(VALUE_COUNT * 3u, -1.0f, 1.0f), pack32::Vec3PackUnitVecThirdBased, pack32::Vec3PackUnitVecThirdBased);
+        RequireSamePacking<4>(CreateRandomFloats(VALUE_COUNT * 4u, -0.5f, 1.5f), pack32::Vec4PackGfxColor, pack32::Vec4PackGfxColor);
+    }
+
+    void RequireSameBatchUnpacking()
+    {
+        const auto packedValues = CreateRandomPackedValues(VALUE_COUNT);
+
+        RequireSameUnpacking<2>(packedValues, pack32::Vec2UnpackTexCoordsUV, pack32::Vec2UnpackTexCoordsUV);
+        RequireSameUnpacking<2>(packedValues, pack32::Vec2UnpackTexCoordsVU, pack32::Vec2UnpackTexCoordsVU);
+        RequireSameUnpacking<3>(packedValues, pack32::Vec3UnpackUnitVecScaleBased, pack32::Vec3UnpackUnitVecScaleBased);
+        RequireSameUnpacking<3>(packedValues, pack32::Vec3UnpackUnitVecThirdBased, pack32::Vec3UnpackUnitVecThirdBased);
+        RequireSameUnpacking<4>(packedValues, pack32::Vec4UnpackGfxColor, pack32::Vec4UnpackGfxColor);
+    }
+
+    TEST_CASE("HalfFloat: Batch conversion matches single value conversion", "[utils][pack]")
+    {
+        RequireSameHalfFloatConversion();
+    }
+
+    TEST_CASE("Pack: Batch packing matches single value packing", "[utils][pack]")
+    {
+        RequireSameBatchPacking();
+    }
+
+    TEST_CASE("Pack: Batch unpacking matches single value unpacking", "[utils][pack]")
+    {
+        RequireSameBatchUnpacking();
+    }
+
+    // The SSE2 kernels are only used on cpus without AVX2 so they need to be forced to be covered on most hosts
+    TEST_CASE("Pack: SSE2 batch conversions match single value conversions", "[utils][pack]")
+    {
+        const Avx2Disabled avx2Disabled;
+        REQUIRE(!CpuFeatures::HasAvx2());
+
+        RequireSameHalfFloatConversion();
+        RequireSameBatchPacking();
+        RequireSameBatchUnpacking();
+    }
+
+    TEST_CASE("Pack: Vertex throughput", "[.][benchmark][utils][pack]")
+    {
+        constexpr auto vertexCount = 200000u;
+        constexpr auto megaVertices = static_cast<double>(vertexCount) / 1000000.0;
+
+        const auto normals = CreateRandomFloats(vertexCount * 3u, -1.0f, 1.0f);
+        const auto colors = CreateRandomFloats(vertexCount * 4u, 0.0f, 1.0f);
+        const auto texCoords = CreateRandomFloats(vertexCount * 2u, 0.0f, 1.0f);
+
+        std::vector<uint32_t> packedNormals(vertexCount);
+        std::vector<uint32_t> packedColors(vertexCount);
+        std::vector<uint32_t> packedTexCoords(vertexCount);
+
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (auto i = 0u; i < vertexCount; i++)
+            {
+                const float normal[]{normals[i * 3u + 0u], normals[i * 3u + 1u], normals[i * 3u + 2u]};
+                packedNormals[i] = pack32::Vec3PackUnitVecScaleBased(normal);
+            }
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+            std::cout << std::format("Scale based unit vec pack single: {:.2f} MVertices/s\n", megaVertices / duration.count());
+        }
+
+        {
+            const auto start = std::chrono::steady_clock::now();
+            pack32::Vec3PackUnitVecScaleBased(normals, packedNormals);
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+            std::cout << std::format("Scale based unit vec pack batch: {:.2f} MVertices/s\n", megaVertices / duration.count());
+        }
+
+        {
+            const auto start = std::chrono::steady_clock::now();
+            pack32::Vec3PackUnitVecThirdBased(normals, packedNormals);
+            pack32::Vec4PackGfxColor(colors, packedColors);
+            pack32::Vec2PackTexCoordsUV(texCoords, packedTexCoords);
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+            std::cout << std::format("Third based vertex pack batch: {:.2f} MVertices/s\n", megaVertices / duration.count());
+        }
+
+        std::vector<float> unpackedNormals(vertexCount * 3u);
+        std::vector<float> unpackedColors(vertexCount * 4u);
+        std::vector<float> unpackedTexCoords(vertexCount * 2u);
+
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (auto i = 0u; i < vertexCount; i++)
+            {
+                float normal[3];
+                float color[4];
+                float texCoord[2];
+                pack32::Vec3UnpackUnitVecThirdBased(packedNormals[i], normal);
+                pack32::Vec4UnpackGfxColor(packedColors[i], color);
+                pack32::Vec2UnpackTexCoordsUV(packedTexCoords[i], texCoord);
+                std::copy_n(normal, 3u, &unpackedNormals[i * 3u]);
+                std::copy_n(color, 4u, &unpackedColors[i * 4u]);
+                std::copy_n(texCoord, 2u, &unpackedTexCoords[i * 2u]);
+            }
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+            std::cout << std::format("Third based vertex unpack single: {:.2f} MVertices/s\n", megaVertices / duration.count());
+        }
+
+        {
+            const auto start = std::chrono::steady_clock::now();
+            pack32::Vec3UnpackUnitVecThirdBased(packedNormals, unpackedNormals);
+            pack32::Vec4UnpackGfxColor(packedColors, unpackedColors);
+            pack32::Vec2UnpackTexCoordsUV(packedTexCoords, unpackedTexCoords);
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+            std::cout << std::format("Third based vertex unpack batch: {:.2f} MVertices/s\n", megaVertices / duration.count());
+        }
+    }
+} // namespace utils::pack
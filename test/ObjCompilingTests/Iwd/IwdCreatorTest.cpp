@@ -11,6 +11,7 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <cstring>
 #include <filesystem>
+#include <format>
 #include <memory>
 #include <unzip.h>
 
@@ -91,4 +92,64 @@ namespace test::iwd
         REQUIRE(unzReadCurrentFile(zip, readBuffer, sizeof(readBuffer)) == std::char_traits<char>::length(iwiData));
         REQUIRE(std::strncmp(iwiData, readBuffer, std::char_traits<char>::length(iwiData)) == 0);
     }
+
+    TEST_CASE("IwdCreator: Writes entries of multiple Iwd files in order", "[image]")
+    {
+        TestContext testContext;
+        auto& sut = testContext.CreateSut();
+
+        constexpr auto IWD_COUNT = 3u;
+        constexpr auto FILE_COUNT_PER_IWD = 20u;
+
+        for (auto iwdIndex = 0u; iwdIndex < IWD_COUNT; iwdIndex++)
+        {
+            auto* iwd = sut.GetOrAddIwd(std::format("iwd{}", iwdIndex));
+            for (auto fileIndex = 0u; fileIndex < FILE_COUNT_PER_IWD; fileIndex++)
+            {
+                const auto fileName = std::format("images/file{}_{}.iwi", iwdIndex, fileIndex);
+                iwd->AddFile(fileName);
+                testContext.m_search_path.AddFileData(fileName, std::string(fileIndex * 100u, static_cast<char>('a' + fileIndex)));
+            }
+        }
+
+        sut.Finalize(testContext.m_search_path, testContext.m_out_dir);
+        REQUIRE(testContext.m_out_dir.GetMockedFileList().size() == IWD_COUNT);
+
+        for (auto iwdIndex = 0u; iwdIndex < IWD_COUNT; iwdIndex++)
+        {
+            const auto iwdFileName = std::format("iwd{}.iwd", iwdIndex);
+            const auto* file = testContext.m_out_dir.GetMockedFile(iwdFileName);
+            REQUIRE(file);
+
+            std::istringstream ss(file->AsString());
+            auto zlibFunctions = FileToZlibWrapper::CreateFunctions32ForFile(&ss);
+            auto zip = unzOpen2(iwdFileName.c_str(), &zlibFunctions);
+            REQUIRE(zip);
+
+            REQUIRE(unzGoToFirstFile(zip) == UNZ_OK);
+            for (auto fileIndex = 0u; fileIndex < FILE_COUNT_PER_IWD; fileIndex++)
+            {
+                if (fileIndex > 0)
+                    REQUIRE(unzGoToNextFile(zip) == UNZ_OK);
+
+                unz_file_info fileInfo;
+                char fileNameBuffer[64];
+                REQUIRE(unzGetCurrentFileInfo(zip, &fileInfo, fileNameBuffer, sizeof(fileNameBuffer), nullptr, 0, nullptr, 0) == UNZ_OK);
+
+                const auto expectedData = std::string(fileIndex * 100u, static_cast<char>('a' + fileIndex));
+                REQUIRE(std::format("images/file{}_{}.iwi", iwdIndex, fileIndex) == fileNameBuffer);
+                REQUIRE(fileInfo.uncompressed_size == expectedData.size());
+
+                std::string readBuffer(expectedData.size() + 10u, '\0');
+                REQUIRE(unzOpenCurrentFile(zip) == UNZ_OK);
+                REQUIRE(unzReadCurrentFile(zip, readBuffer.data(), static_cast<unsigned>(readBuffer.size())) == static_cast<int>(expectedData.size()));
+                REQUIRE(unzCloseCurrentFile(zip) == UNZ_OK);
+                readBuffer.resize(expectedData.size());
+                REQUIRE(readBuffer == expectedData);
+            }
+            REQUIRE(unzGoToNextFile(zip) == UNZ_END_OF_LIST_OF_FILE);
+
+            unzClose(zip);
+        }
+    }
 } // namespace test::iwd
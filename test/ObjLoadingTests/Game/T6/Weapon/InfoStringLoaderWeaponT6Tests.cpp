@@ -0,0 +1,149 @@
+#include "Game/T6/Weapon/InfoStringLoaderWeaponT6.h"
+
+#include "Game/T6/GameT6.h"
+#include "Game/T6/Weapon/WeaponFields.h"
+#include "SearchPath/MockSearchPath.h"
+#include "Utils/MemoryManager.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace T6;
+
+namespace
+{
+    InfoString CreateSyntheticWeaponInfoString(const unsigned weaponIndex)
+    {
+        InfoString infoString;
+
+        for (const auto& field : weapon_fields)
+        {
+            switch (static_cast<csParseFieldType_t>(field.iFieldType))
+            {
+            case CSPFT_INT:
+            case CSPFT_UINT:
+                infoString.SetValueForKey(field.szName, std::to_string(weaponIndex % 100u));
+                break;
+
+            case CSPFT_BOOL:
+            case CSPFT_QBOOLEAN:
+                infoString.SetValueForKey(field.szName, weaponIndex % 2u == 0u ? "1" : "0");
+                break;
+
+            case CSPFT_FLOAT:
+            case CSPFT_MILLISECONDS:
+                infoString.SetValueForKey(field.szName, std::to_string(static_cast<float>(weaponIndex % 100u) * 0.25f));
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        return infoString;
+    }
+
+    TEST_CASE("InfoStringLoaderWeapon(T6): Parses float notations like strtof", "[t6][weapon][infostring]")
+    {
+        auto infoString = CreateSyntheticWeaponInfoString(0u);
+        infoString.SetValueForKey("viewFlashOffsetF", "0x10");
+        infoString.SetValueForKey("viewFlashOffsetR", "-0x1p3");
+        infoString.SetValueForKey("viewFlashOffsetU", "1e50");
+        infoString.SetValueForKey("worldFlashOffsetF", "1e-50");
+        infoString.SetValueForKey("worldFlashOffsetR", " +2.5");
+
+        MockSearchPath searchPath;
+        Zone zone("MockZone", 0, IGame::GetGameById(GameId::T6));
+
+        MemoryManager memory;
+        AssetCreatorCollection creatorCollection(zone);
+        IgnoredAssetLookup ignoredAssetLookup;
+        AssetCreationContext context(zone, &creatorCollection, &ignoredAssetLookup);
+
+        InfoStringLoaderWeapon loader(memory, searchPath, zone);
+
+        const auto result = loader.CreateAsset("float_weapon", infoString, context);
+        REQUIRE(result.HasBeenSuccessful());
+
+        const auto* assetInfo = reinterpret_cast<XAssetInfo<WeaponVariantDef>*>(result.GetAssetInfo());
+        const auto* weapDef = assetInfo->Asset()->weapDef;
+        REQUIRE(weapDef->vViewFlashOffset.x == 16.0f);
+        REQUIRE(weapDef->vViewFlashOffset.y == -8.0f);
+        REQUIRE(weapDef->vViewFlashOffset.z == std::numeric_limits<float>::infinity());
+        REQUIRE(weapDef->vWorldFlashOffset.x == 0.0f);
+        REQUIRE(weapDef->vWorldFlashOffset.y == 2.5f);
+
+        infoString.SetValueForKey("viewFlashOffsetF", "0x");
+        REQUIRE(loader.CreateAsset("invalid_float_weapon", infoString, context).HasFailed());
+    }
+
+    TEST_CASE("InfoStringLoaderWeapon(T6): Parses integer notations like strtol", "[t6][weapon][infostring]")
+    {
+        auto infoString = CreateSyntheticWeaponInfoString(0u);
+        infoString.SetValueForKey("startAmmo", "0x10");
+        infoString.SetValueForKey("shotCount", " 010");
+        infoString.SetValueForKey("clipSize", "99999999999999999999");
+        infoString.SetValueForKey("maxAmmo", "-99999999999999999999");
+        infoString.SetValueForKey("unlimitedAmmo", "18446744073709551616");
+
+        MockSearchPath searchPath;
+        Zone zone("MockZone", 0, IGame::GetGameById(GameId::T6));
+
+        MemoryManager memory;
+        AssetCreatorCollection creatorCollection(zone);
+        IgnoredAssetLookup ignoredAssetLookup;
+        AssetCreationContext context(zone, &creatorCollection, &ignoredAssetLookup);
+
+        InfoStringLoaderWeapon loader(memory, searchPath, zone);
+
+        const auto result = loader.CreateAsset("integer_weapon", infoString, context);
+        REQUIRE(result.HasBeenSuccessful());
+
+        // Values that are out of range saturate instead of failing
+        const auto* assetInfo = reinterpret_cast<XAssetInfo<WeaponVariantDef>*>(result.GetAssetInfo());
+        const auto* variantDef = assetInfo->Asset();
+        REQUIRE(variantDef->weapDef->iStartAmmo == 16);
+        REQUIRE(variantDef->weapDef->shotCount == 8);
+        REQUIRE(variantDef->iClipSize == std::numeric_limits<int>::max());
+        REQUIRE(variantDef->weapDef->iMaxAmmo == std::numeric_limits<int>::min());
+        REQUIRE(variantDef->weapDef->unlimitedAmmo);
+
+        infoString.SetValueForKey("clipSize", "12a");
+        REQUIRE(loader.CreateAsset("invalid_integer_weapon", infoString, context).HasFailed());
+    }
+
+    TEST_CASE("InfoStringLoaderWeapon(T6): Conversion time of many weapons", "[.][benchmark][t6][weapon][infostring]")
+    {
+        constexpr auto weaponCount = 1000u;
+
+        std::vector<InfoString> infoStrings;
+        infoStrings.reserve(weaponCount);
+        for (auto weaponIndex = 0u; weaponIndex < weaponCount; weaponIndex++)
+            infoStrings.emplace_back(CreateSyntheticWeaponInfoString(weaponIndex));
+
+        MockSearchPath searchPath;
+        Zone zone("MockZone", 0, IGame::GetGameById(GameId::T6));
+
+        MemoryManager memory;
+        AssetCreatorCollection creatorCollection(zone);
+        IgnoredAssetLookup ignoredAssetLookup;
+        AssetCreationContext context(zone, &creatorCollection, &ignoredAssetLookup);
+
+        InfoStringLoaderWeapon loader(memory, searchPath, zone);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (auto weaponIndex = 0u; weaponIndex < weaponCount; weaponIndex++)
+        {
+            const auto result = loader.CreateAsset(std::format("benchmark_weapon_{}", weaponIndex), infoStrings[weaponIndex], context);
+            REQUIRE(result.HasBeenSuccessful());
+        }
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::format("Converted {} weapons with {} fields in {:.3f}s\n", weaponCount, std::extent_v<decltype(weapon_fields)>, duration.count());
+    }
+} // namespace
@@ -0,0 +1,51 @@
+#include "Gdt/GdtLookup.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+
+namespace test::gdt::lookup
+{
+    GdtEntry* AddEntry(Gdt& gdt, std::string name, std::string gdfName)
+    {
+        return gdt.m_entries.emplace_back(std::make_unique<GdtEntry>(std::move(name), std::move(gdfName))).get();
+    }
+
+    TEST_CASE("GdtLookup: Later gdt files override entries of earlier ones", "[gdt]")
+    {
+        Gdt firstGdt;
+        auto* firstWeapon = AddEntry(firstGdt, "ak47", "weapon.gdf");
+        auto* firstMaterial = AddEntry(firstGdt, "mtl_ak47", "material.gdf");
+
+        Gdt secondGdt;
+        auto* secondWeapon = AddEntry(secondGdt, "ak47", "weapon.gdf");
+
+        GdtLookup lookup;
+        lookup.Initialize({&firstGdt, &secondGdt});
+
+        REQUIRE(lookup.GetGdtEntryByGdfAndName("weapon.gdf", "ak47") == secondWeapon);
+        REQUIRE(lookup.GetGdtEntryByGdfAndName("material.gdf", "mtl_ak47") == firstMaterial);
+        REQUIRE(lookup.GetGdtEntryByGdfAndName("material.gdf", "ak47") == nullptr);
+        REQUIRE(firstWeapon != secondWeapon);
+    }
+
+    TEST_CASE("GdtLookup: Gdt files are only requested when the first entry is queried", "[gdt]")
+    {
+        Gdt gdt;
+        auto* weapon = AddEntry(gdt, "ak47", "weapon.gdf");
+
+        auto providerCallCount = 0u;
+        GdtLookup lookup;
+        lookup.InitializeOnFirstQuery(
+            [&gdt, &providerCallCount]
+            {
+                providerCallCount++;
+                return std::vector<const Gdt*>{&gdt};
+            });
+
+        REQUIRE(providerCallCount == 0u);
+        REQUIRE(lookup.GetGdtEntryByGdfAndName("weapon.gdf", "ak47") == weapon);
+        REQUIRE(lookup.GetGdtEntryByGdfAndName("weapon.gdf", "m4") == nullptr);
+        REQUIRE(providerCallCount == 1u);
+    }
+} // namespace test::gdt::lookup
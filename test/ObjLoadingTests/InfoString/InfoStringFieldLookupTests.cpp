@@ -0,0 +1,57 @@
+#include "InfoString/InfoStringFieldLookup.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+namespace test::info_string::field_lookup
+{
+    TEST_CASE("InfoStringFieldLookup: Resolves all field names", "[infostring]")
+    {
+        std::vector<std::string> nameStorage;
+        for (auto i = 0u; i < 700u; i++)
+            nameStorage.emplace_back("field" + std::to_string(i));
+
+        std::vector<std::string_view> fieldNames(nameStorage.begin(), nameStorage.end());
+        const InfoStringFieldLookup lookup(fieldNames);
+
+        for (auto i = 0u; i < nameStorage.size(); i++)
+        {
+            const auto nameIndex = lookup.GetFieldNameIndex(nameStorage[i]);
+            REQUIRE(nameIndex);
+            REQUIRE(*nameIndex == i);
+        }
+
+        REQUIRE(!lookup.GetFieldNameIndex("field700"));
+        REQUIRE(!lookup.GetFieldNameIndex("Field0"));
+        REQUIRE(!lookup.GetFieldNameIndex(""));
+    }
+
+    TEST_CASE("InfoStringFieldLookup: Returns values in field order", "[infostring]")
+    {
+        const std::vector<std::string_view> fieldNames{"displayName", "fireTime", "ammoName", "fireTime"};
+        const InfoStringFieldLookup lookup(fieldNames);
+
+        InfoString infoString;
+        infoString.SetValueForKey("ammoName", "cool_ammo");
+        infoString.SetValueForKey("unknownField", "5");
+        infoString.SetValueForKey("fireTime", "0.1");
+
+        const auto values = lookup.GetFieldValues(infoString);
+        REQUIRE(values.size() == 4u);
+        REQUIRE(values[0] == nullptr);
+        REQUIRE(values[1] != nullptr);
+        REQUIRE(*values[1] == "0.1");
+        REQUIRE(values[2] != nullptr);
+        REQUIRE(*values[2] == "cool_ammo");
+        REQUIRE(values[3] == values[1]);
+    }
+
+    TEST_CASE("InfoStringFieldLookup: Can be created without fields", "[infostring]")
+    {
+        const InfoStringFieldLookup lookup(std::vector<std::string_view>{});
+
+        REQUIRE(!lookup.GetFieldNameIndex("displayName"));
+        REQUIRE(lookup.GetFieldValues(InfoString()).empty());
+    }
+} // namespace test::info_string::field_lookup
@@ -0,0 +1,100 @@
+#include "Parsing/Menu/MenuFileBatchReader.h"
+#include "SearchPath/MockSearchPath.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace menu;
+
+namespace test::parsing::menu::file_batch_reader
+{
+    class MenuFileBatchReaderTestsHelper
+    {
+    public:
+        MockSearchPath m_search_path;
+        MenuAssetZoneState m_zone_state;
+        MenuFileBatchReader m_reader;
+
+        MenuFileBatchReaderTestsHelper()
+            : m_reader(FeatureLevel::IW4, false, m_search_path, 0u)
+        {
+        }
+
+        // Adds the result to the zone state like the menu list loader does before taking the next result
+        MenuFileBatchReader::FileResult TakeResult(const std::string& fileName)
+        {
+            auto result = m_reader.TakeResult(fileName, m_zone_state);
+
+            if (result.m_parsing_result)
+            {
+                for (auto& function : result.m_parsing_result->m_functions)
+                    m_zone_state.AddFunction(std::move(function));
+                for (auto& menu : result.m_parsing_result->m_menus)
+                    m_zone_state.AddMenu(std::move(menu));
+            }
+
+            return result;
+        }
+    };
+
+    TEST_CASE("MenuFileBatchReader: Ensure can read multiple menu files", "[parsing][menu]")
+    {
+        MenuFileBatchReaderTestsHelper helper;
+        helper.m_search_path.AddFileData("ui/a.menu", "{ menuDef { name \"menu_a\" } }");
+        helper.m_search_path.AddFileData("ui/b.menu", "{ menuDef { name \"menu_b\" } menuDef { name \"menu_c\" } }");
+
+        helper.m_reader.ReadMenuFiles({"ui/a.menu", "ui/missing.menu", "ui/b.menu"}, helper.m_zone_state);
+
+        const auto resultA = helper.TakeResult("ui/a.menu");
+        REQUIRE(resultA.m_opened);
+        REQUIRE(resultA.m_parsing_result);
+
+        const auto resultMissing = helper.TakeResult("ui/missing.menu");
+        REQUIRE(!resultMissing.m_opened);
+        REQUIRE(!resultMissing.m_parsing_result);
+
+        const auto resultB = helper.TakeResult("ui/b.menu");
+        REQUIRE(resultB.m_opened);
+        REQUIRE(resultB.m_parsing_result);
+
+        REQUIRE(helper.m_zone_state.m_menus.size() == 3u);
+        REQUIRE(helper.m_zone_state.m_menus[0]->m_name == "menu_a");
+        REQUIRE(helper.m_zone_state.m_menus[1]->m_name == "menu_b");
+        REQUIRE(helper.m_zone_state.m_menus[2]->m_name == "menu_c");
+    }
+
+    TEST_CASE("MenuFileBatchReader: Ensure menu files can use functions of previous menu files", "[parsing][menu]")
+    {
+        MenuFileBatchReaderTestsHelper helper;
+        helper.m_search_path.AddFileData("ui/functions.menu", "{ functionDef { name \"isCool\" value ( dvarBool( \"cool\" ) ) } }");
+        helper.m_search_path.AddFileData("ui/a.menu", "{ menuDef { name \"menu_a\" visible when( isCool() ) } }");
+
+        helper.m_reader.ReadMenuFiles({"ui/functions.menu", "ui/a.menu"}, helper.m_zone_state);
+
+        const auto resultFunctions = helper.TakeResult("ui/functions.menu");
+        REQUIRE(resultFunctions.m_parsing_result);
+        REQUIRE(helper.m_zone_state.m_functions.size() == 1u);
+
+        // The concurrent attempt failed to find the function, its errors must not be kept
+        const auto resultA = helper.TakeResult("ui/a.menu");
+        REQUIRE(resultA.m_opened);
+        REQUIRE(resultA.m_parsing_result);
+        REQUIRE(resultA.m_errors.empty());
+    }
+
+    TEST_CASE("MenuFileBatchReader: Ensure menus with the name of a menu of a previous menu file fail", "[parsing][menu]")
+    {
+        MenuFileBatchReaderTestsHelper helper;
+        helper.m_search_path.AddFileData("ui/a.menu", "{ menuDef { name \"menu_a\" } }");
+        helper.m_search_path.AddFileData("ui/b.menu", "{ menuDef { name \"menu_a\" } }");
+
+        helper.m_reader.ReadMenuFiles({"ui/a.menu", "ui/b.menu"}, helper.m_zone_state);
+
+        const auto resultA = helper.TakeResult("ui/a.menu");
+        REQUIRE(resultA.m_parsing_result);
+
+        const auto resultB = helper.TakeResult("ui/b.menu");
+        REQUIRE(resultB.m_opened);
+        REQUIRE(!resultB.m_parsing_result);
+        REQUIRE(!resultB.m_errors.empty());
+    }
+} // namespace test::parsing::menu::file_batch_reader
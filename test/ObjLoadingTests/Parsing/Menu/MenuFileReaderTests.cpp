@@ -0,0 +1,98 @@
+#include "Parsing/Menu/MenuFileReader.h"
+#include "SearchPath/MockSearchPath.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <sstream>
+
+using namespace menu;
+
+namespace test::parsing::menu::file_reader
+{
+    std::string CreateSyntheticMenuFile(const unsigned menuCount, const unsigned itemsPerMenu)
+    {
+        std::ostringstream ss;
+        ss << "#define COOL_STYLE 5\n"
+              "{\n";
+
+        for (auto menuIndex = 0u; menuIndex < menuCount; menuIndex++)
+        {
+            ss << std::format("\tmenuDef\n"
+                              "\t{{\n"
+                              "\t\tname \"menu_{}\"\n"
+                              "\t\tfullScreen 1\n"
+                              "\t\trect 0 0 640 480 0 0\n"
+                              "\t\tstyle COOL_STYLE\n"
+                              "\t\tvisible when( dvarBool( \"ui_menu_{}\" ) && !inkillcam() )\n"
+                              "\t\tonOpen\n"
+                              "\t\t{{\n"
+                              "\t\t\tfocusFirst;\n"
+                              "\t\t\tsetDvar \"ui_open\" \"{}\";\n"
+                              "\t\t}}\n",
+                              menuIndex,
+                              menuIndex,
+                              menuIndex);
+
+            for (auto itemIndex = 0u; itemIndex < itemsPerMenu; itemIndex++)
+            {
+                ss << std::format("\t\titemDef\n"
+                                  "\t\t{{\n"
+                                  "\t\t\tname \"item_{}\"\n"
+                                  "\t\t\ttype 1\n"
+                                  "\t\t\trect {} {} 200 20 1 1\n"
+                                  "\t\t\tforecolor 1 1 1 0.75\n"
+                                  "\t\t\ttextfont 3\n"
+                                  "\t\t\ttextscale 0.375\n"
+                                  "\t\t\ttext \"@MENU_ITEM_{}\"\n"
+                                  "\t\t\tvisible when( dvarInt( \"ui_item\" ) == {} )\n"
+                                  "\t\t\taction\n"
+                                  "\t\t\t{{\n"
+                                  "\t\t\t\tplay \"mouse_click\";\n"
+                                  "\t\t\t\tif( dvarBool( \"ui_close\" ) )\n"
+                                  "\t\t\t\t{{\n"
+                                  "\t\t\t\t\tclose self;\n"
+                                  "\t\t\t\t}}\n"
+                                  "\t\t\t}}\n"
+                                  "\t\t}}\n",
+                                  itemIndex,
+                                  itemIndex * 2u,
+                                  itemIndex * 20u,
+                                  itemIndex,
+                                  itemIndex);
+            }
+
+            ss << "\t}\n";
+        }
+
+        ss << "}\n";
+
+        return ss.str();
+    }
+
+    TEST_CASE("MenuFileReader: Parse time of large menu file", "[.][benchmark][parsing][menu]")
+    {
+        constexpr auto menuCount = 200u;
+        constexpr auto itemsPerMenu = 50u;
+
+        const auto menuFile = CreateSyntheticMenuFile(menuCount, itemsPerMenu);
+
+        MockSearchPath searchPath;
+        std::istringstream stream(menuFile);
+        MenuFileReader reader(stream, "benchmark.menu", FeatureLevel::IW4, searchPath);
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto result = reader.ReadMenuFile();
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+        REQUIRE(result);
+        REQUIRE(result->m_menus.size() == menuCount);
+
+        std::cout << std::format("Parsed {} menus with {} items from {} KB in {:.3f}s\n",
+                                 menuCount,
+                                 menuCount * itemsPerMenu,
+                                 menuFile.size() / 1024u,
+                                 duration.count());
+    }
+} // namespace test::parsing::menu::file_reader
@@ -0,0 +1,101 @@
+#include "StringTable/StringTableLoader.h"
+
+#include "Game/T6/CommonT6.h"
+#include "Game/T6/T6.h"
+#include "Utils/MemoryManager.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace T6;
+using namespace std::literals;
+
+namespace test::string_table::loader
+{
+    TEST_CASE("StringTableLoader: Cells with the same content share their string", "[stringtable]")
+    {
+        std::istringstream stream("test,data,lol\n"
+                                  "lol,,test\n"
+                                  "data");
+
+        MemoryManager memory;
+        ::string_table::StringTableLoaderV3<StringTable, Common::Com_HashString> loader;
+        const auto* stringTable = loader.LoadFromStream("mp/cooltable.csv", memory, stream);
+
+        REQUIRE(stringTable->name == "mp/cooltable.csv"s);
+        REQUIRE(stringTable->columnCount == 3);
+        REQUIRE(stringTable->rowCount == 3);
+
+        const auto* values = stringTable->values;
+        REQUIRE(values[0].string == "test"s);
+        REQUIRE(values[1].string == "data"s);
+        REQUIRE(values[2].string == "lol"s);
+        REQUIRE(values[3].string == "lol"s);
+        REQUIRE(values[4].string == ""s);
+        REQUIRE(values[5].string == "test"s);
+        REQUIRE(values[6].string == "data"s);
+        REQUIRE(values[7].string == ""s);
+        REQUIRE(values[8].string == ""s);
+
+        REQUIRE(values[0].string == values[5].string);
+        REQUIRE(values[1].string == values[6].string);
+        REQUIRE(values[2].string == values[3].string);
+
+        for (auto i = 0; i < stringTable->rowCount * stringTable->columnCount; i++)
+            REQUIRE(values[i].hash == Common::Com_HashString(values[i].string));
+
+        for (auto i = 1; i < stringTable->rowCount * stringTable->columnCount; i++)
+        {
+            const auto& previous = values[stringTable->cellIndex[i - 1]];
+            const auto& current = values[stringTable->cellIndex[i]];
+            REQUIRE(previous.hash <= current.hash);
+        }
+    }
+
+    TEST_CASE("StringTableLoader: Empty string tables have no cells", "[stringtable]")
+    {
+        std::istringstream stream("");
+
+        MemoryManager memory;
+        ::string_table::StringTableLoaderV3<StringTable, Common::Com_HashString> loader;
+        const auto* stringTable = loader.LoadFromStream("mp/empty.csv", memory, stream);
+
+        REQUIRE(stringTable->columnCount == 0);
+        REQUIRE(stringTable->rowCount == 0);
+        REQUIRE(stringTable->values == nullptr);
+        REQUIRE(stringTable->cellIndex == nullptr);
+    }
+
+    TEST_CASE("StringTableLoader: Load time of large string table", "[.][benchmark][stringtable]")
+    {
+        constexpr auto rowCount = 50000u;
+        constexpr auto columnCount = 10u;
+
+        std::ostringstream ss;
+        for (auto row = 0u; row < rowCount; row++)
+        {
+            ss << "row_" << row;
+            for (auto column = 1u; column < columnCount; column++)
+                ss << ",value_" << (row * column) % 1000u;
+            ss << '\n';
+        }
+        const auto csv = ss.str();
+
+        MemoryManager memory;
+        ::string_table::StringTableLoaderV3<StringTable, Common::Com_HashString> loader;
+        std::istringstream stream(csv);
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto* stringTable = loader.LoadFromStream("mp/benchmark.csv", memory, stream);
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+        REQUIRE(stringTable->rowCount == static_cast<int>(rowCount));
+        REQUIRE(stringTable->columnCount == static_cast<int>(columnCount));
+
+        std::cout << std::format("Loaded string table with {} cells from {} KB in {:.3f}s\n", rowCount * columnCount, csv.size() / 1024u, duration.count());
+    }
+} // namespace test::string_table::loader
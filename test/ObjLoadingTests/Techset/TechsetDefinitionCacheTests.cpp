@@ -0,0 +1,58 @@
+#include "Techset/TechsetDefinitionCache.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+
+using namespace techset;
+
+namespace test::techset::definition_cache
+{
+    const char* techniqueTypeNames[]{
+        "depth prepass",
+        "lit",
+    };
+
+    const TechsetDefinition* ReadTechset(const std::string& content)
+    {
+        std::istringstream stream(content);
+        return TechsetDefinitionCache::ReadTechsetDefinition(stream, "test.techset", techniqueTypeNames, std::extent_v<decltype(techniqueTypeNames)>);
+    }
+
+    TEST_CASE("TechsetDefinitionCache: Techset files with the same content share their definition", "[techset]")
+    {
+        const auto* definition = ReadTechset("\"depth prepass\":\n  zprepass;\n\"lit\":\n  lit_omni;\n");
+        REQUIRE(definition != nullptr);
+
+        std::string techniqueName;
+        REQUIRE(definition->GetTechniqueByIndex(1, techniqueName));
+        REQUIRE(techniqueName == "lit_omni");
+
+        REQUIRE(ReadTechset("\"depth prepass\":\n  zprepass;\n\"lit\":\n  lit_omni;\n") == definition);
+    }
+
+    TEST_CASE("TechsetDefinitionCache: Techset files with different content have their own definition", "[techset]")
+    {
+        const auto* definition = ReadTechset("\"lit\":\n  lit_sun;\n");
+        const auto* otherDefinition = ReadTechset("\"lit\":\n  lit_spot;\n");
+        REQUIRE(definition != nullptr);
+        REQUIRE(otherDefinition != nullptr);
+        REQUIRE(definition != otherDefinition);
+
+        std::string techniqueName;
+        REQUIRE(otherDefinition->GetTechniqueByIndex(1, techniqueName));
+        REQUIRE(techniqueName == "lit_spot");
+    }
+
+    TEST_CASE("TechsetDefinitionCache: Zone caches return the definitions added to them", "[techset]")
+    {
+        const auto* definition = ReadTechset("\"depth prepass\":\n  zprepass;\n");
+        REQUIRE(definition != nullptr);
+
+        TechsetDefinitionCache zoneCache;
+        REQUIRE(zoneCache.GetCachedTechsetDefinition("test") == nullptr);
+
+        zoneCache.AddTechsetDefinitionToCache("test", definition);
+        REQUIRE(zoneCache.GetCachedTechsetDefinition("test") == definition);
+    }
+} // namespace test::techset::definition_cache
@@ -0,0 +1,158 @@
+#include "Techset/TechniqueFileReader.h"
+#include "Techset/TechsetFileReader.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace techset;
+
+namespace test::techset::file_reader
+{
+    class NullTechniqueDefinitionAcceptor final : public ITechniqueDefinitionAcceptor
+    {
+    public:
+        unsigned m_pass_count = 0u;
+
+        void AcceptNextPass() override
+        {
+            m_pass_count++;
+        }
+
+        bool AcceptEndPass(std::string& errorMessage) override
+        {
+            return true;
+        }
+
+        bool AcceptStateMap(const std::string& stateMapName, std::string& errorMessage) override
+        {
+            return true;
+        }
+
+        bool AcceptVertexShader(const std::string& vertexShaderName, std::string& errorMessage) override
+        {
+            return true;
+        }
+
+        bool AcceptPixelShader(const std::string& pixelShaderName, std::string& errorMessage) override
+        {
+            return true;
+        }
+
+        bool AcceptShaderConstantArgument(ShaderSelector shader,
+                                          ShaderArgument shaderArgument,
+                                          ShaderArgumentCodeSource source,
+                                          std::string& errorMessage) override
+        {
+            return true;
+        }
+
+        bool AcceptShaderSamplerArgument(ShaderSelector shader,
+                                         ShaderArgument shaderArgument,
+                                         ShaderArgumentCodeSource source,
+                                         std::string& errorMessage) override
+        {
+            return true;
+        }
+
+        bool AcceptShaderLiteralArgument(ShaderSelector shader,
+                                         ShaderArgument shaderArgument,
+                                         ShaderArgumentLiteralSource source,
+                                         std::string& errorMessage) override
+        {
+            return true;
+        }
+
+        bool AcceptShaderMaterialArgument(ShaderSelector shader,
+                                          ShaderArgument shaderArgument,
+                                          ShaderArgumentMaterialSource source,
+                                          std::string& errorMessage) override
+        {
+            return true;
+        }
+
+        bool AcceptVertexStreamRouting(const std::string& destination, const std::string& source, std::string& errorMessage) override
+        {
+            return true;
+        }
+    };
+
+    std::string CreateSyntheticTechnique(const unsigned index)
+    {
+        return std::format(R"technique({{
+  stateMap "default_{0}";
+
+  vertexShader 3.0 "shader_{0}.hlsl"
+  {{
+    worldMatrix = constant.transposeWorldMatrix;
+    viewProjectionMatrix = constant.transposeViewProjectionMatrix;
+    fogConsts = constant.fogConsts;
+  }}
+
+  pixelShader 3.0 "shader_{0}.hlsl"
+  {{
+    colorMapSampler = material.colorMap;
+    normalMapSampler = material.normalMap;
+    colorTint = float4( 1, 0.5, 0.25, 1 );
+  }}
+
+  vertex.position = code.position;
+  vertex.color[0] = code.color;
+  vertex.texcoord[0] = code.texcoord[0];
+  vertex.normal = code.normal;
+}}
+)technique",
+                           index);
+    }
+
+    TEST_CASE("TechsetFileReader: Parse time of large techset corpus", "[.][benchmark][parsing][techset]")
+    {
+        constexpr auto fileCount = 5000u;
+        constexpr auto techniqueTypeCount = 32u;
+
+        std::vector<std::string> techniqueTypeNameStorage;
+        std::vector<const char*> techniqueTypeNames;
+        for (auto i = 0u; i < techniqueTypeCount; i++)
+            techniqueTypeNameStorage.emplace_back(std::format("type_{}", i));
+        for (const auto& name : techniqueTypeNameStorage)
+            techniqueTypeNames.emplace_back(name.c_str());
+
+        std::vector<std::string> techsetFiles;
+        std::vector<std::string> techniqueFiles;
+        auto totalSize = 0u;
+        for (auto fileIndex = 0u; fileIndex < fileCount; fileIndex++)
+        {
+            std::ostringstream ss;
+            for (auto typeIndex = 0u; typeIndex < techniqueTypeCount; typeIndex++)
+                ss << std::format("\"type_{}\":\n  technique_{}_{};\n\n", typeIndex, fileIndex, typeIndex % 4u);
+
+            techsetFiles.emplace_back(ss.str());
+            techniqueFiles.emplace_back(CreateSyntheticTechnique(fileIndex));
+            totalSize += static_cast<unsigned>(techsetFiles.back().size() + techniqueFiles.back().size());
+        }
+
+        NullTechniqueDefinitionAcceptor acceptor;
+        const auto start = std::chrono::steady_clock::now();
+
+        for (auto fileIndex = 0u; fileIndex < fileCount; fileIndex++)
+        {
+            std::istringstream techsetStream(techsetFiles[fileIndex]);
+            const TechsetFileReader techsetReader(techsetStream, "benchmark.techset", techniqueTypeNames.data(), techniqueTypeNames.size());
+            REQUIRE(techsetReader.ReadTechsetDefinition());
+
+            std::istringstream techniqueStream(techniqueFiles[fileIndex]);
+            const TechniqueFileReader techniqueReader(techniqueStream, "benchmark.tech", &acceptor);
+            REQUIRE(techniqueReader.ReadTechniqueDefinition());
+        }
+
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+        REQUIRE(acceptor.m_pass_count == fileCount);
+
+        std::cout << std::format("Parsed {} techsets and {} techniques from {} KB in {:.3f}s\n", fileCount, fileCount, totalSize / 1024u, duration.count());
+    }
+} // namespace test::techset::file_reader
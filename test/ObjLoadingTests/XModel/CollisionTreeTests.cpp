@@ -0,0 +1,263 @@
+#include "XModel/CollisionTree.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace collision_tree;
+
+namespace test::xmodel::collision_tree
+{
+    struct TestMesh
+    {
+        std::vector<float> positions;
+        std::vector<uint16_t> tris;
+
+        [[nodiscard]] size_t VertexCount() const
+        {
+            return positions.size() / 3u;
+        }
+
+        [[nodiscard]] size_t TriCount() const
+        {
+            return tris.size() / 3u;
+        }
+
+        [[nodiscard]] VertexData GetVertexData() const
+        {
+            return VertexData{
+                .positionData = positions.data(),
+                .positionDataStride = sizeof(float) * 3u,
+                .triData = tris.data(),
+            };
+        }
+    };
+
+    TestMesh CreateRandomMesh(const size_t vertexCount, const size_t triCount, const unsigned seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution positionDistribution(-100.0f, 250.0f);
+        std::uniform_int_distribution<size_t> indexDistribution(0u, vertexCount - 1u);
+
+        TestMesh mesh;
+        mesh.positions.resize(vertexCount * 3u);
+        for (auto& position : mesh.positions)
+            position = positionDistribution(random);
+
+        mesh.tris.resize(triCount * 3u);
+        for (auto& index : mesh.tris)
+            index = static_cast<uint16_t>(indexDistribution(random));
+
+        return mesh;
+    }
+
+    // A grid where many triangles share the same centers on two axes which is flat unless a height seed is specified
+    TestMesh CreateGridMesh(const size_t size, const std::optional<unsigned> heightSeed = std::nullopt)
+    {
+        std::mt19937 random(heightSeed.value_or(0u));
+        std::uniform_real_distribution heightDistribution(-2.0f, 2.0f);
+
+        TestMesh mesh;
+        for (auto y = 0u; y <= size; y++)
+        {
+            for (auto x = 0u; x <= size; x++)
+            {
+                mesh.positions.emplace_back(static_cast<float>(x));
+                mesh.positions.emplace_back(static_cast<float>(y));
+                mesh.positions.emplace_back(heightSeed ? heightDistribution(random) : 0.0f);
+            }
+        }
+
+        for (auto y = 0u; y < size; y++)
+        {
+            for (auto x = 0u; x < size; x++)
+            {
+                const auto i0 = static_cast<uint16_t>(y * (size + 1u) + x);
+                const auto i1 = static_cast<uint16_t>(i0 + 1u);
+                const auto i2 = static_cast<uint16_t>(i0 + size + 1u);
+                const auto i3 = static_cast<uint16_t>(i2 + 1u);
+                mesh.tris.insert(mesh.tris.end(), {i0, i1, i2, i1, i3, i2});
+            }
+        }
+
+        return mesh;
+    }
+
+    bool Contains(const Aabb& outer, const Aabb& inner)
+    {
+        for (auto axis = 0u; axis < 3u; axis++)
+        {
+            if (inner.mins[axis] < outer.mins[axis] || inner.maxs[axis] > outer.maxs[axis])
+                return false;
+        }
+
+        return true;
+    }
+
+    void RequireValidTree(const CollisionTree& tree, const TestMesh& mesh)
+    {
+        const auto triCount = mesh.TriCount();
+        REQUIRE(tree.leafs.size() == triCount);
+        REQUIRE(!tree.nodes.empty());
+
+        std::vector<unsigned> triVisitCount(triCount, 0u);
+        std::vector<unsigned> nodeVisitCount(tree.nodes.size(), 0u);
+
+        std::vector<size_t> nodesToVisit{0u};
+        while (!nodesToVisit.empty())
+        {
+            const auto nodeIndex = nodesToVisit.back();
+            nodesToVisit.pop_back();
+
+            REQUIRE(nodeIndex < tree.nodes.size());
+            nodeVisitCount[nodeIndex]++;
+
+            const auto& node = tree.nodes[nodeIndex];
+            for (auto axis = 0u; axis < 3u; axis++)
+                REQUIRE(node.aabb.mins[axis] <= node.aabb.maxs[axis]);
+
+            if (node.childCount & LEAF_CHILDREN_FLAG)
+            {
+                const auto leafCount = static_cast<size_t>(node.childCount & ~LEAF_CHILDREN_FLAG);
+                REQUIRE(leafCount > 0u);
+                REQUIRE(leafCount <= MAX_LEAF_TRIANGLES);
+                REQUIRE(node.childBeginIndex + leafCount <= tree.leafs.size());
+
+                for (auto leafIndex = node.childBeginIndex; leafIndex < node.childBeginIndex + leafCount; leafIndex++)
+                {
+                    const auto triIndex = tree.leafs[leafIndex];
+                    REQUIRE(triIndex < triCount);
+                    triVisitCount[triIndex]++;
+
+                    // The quantised bounds of every vertex of the triangle must lie within the node
+                    for (auto triVertex = 0u; triVertex < 3u; triVertex++)
+                    {
+                        const auto* position = &mesh.positions[mesh.tris[triIndex * 3u + triVertex] * 3u];
+
+                        Aabb vertexBounds{};
+                        for (auto axis = 0u; axis < 3u; axis++)
+                        {
+                            vertexBounds.mins[axis] = QuantizeMin(position[axis], tree.trans[axis], tree.scale[axis]);
+                            vertexBounds.maxs[axis] = QuantizeMax(position[axis], tree.trans[axis], tree.scale[axis]);
+                        }
+
+                        REQUIRE(Contains(node.aabb, vertexBounds));
+                    }
+                }
+            }
+            else
+            {
+                REQUIRE(node.childCount > 0u);
+                REQUIRE(node.childBeginIndex + node.childCount <= tree.nodes.size());
+
+                for (auto childIndex = node.childBeginIndex; childIndex < node.childBeginIndex + node.childCount; childIndex++)
+                {
+                    REQUIRE(childIndex > nodeIndex);
+                    REQUIRE(Contains(node.aabb, tree.nodes[childIndex].aabb));
+                    nodesToVisit.emplace_back(childIndex);
+                }
+            }
+        }
+
+        for (const auto visitCount : nodeVisitCount)
+            REQUIRE(visitCount == 1u);
+        for (const auto visitCount : triVisitCount)
+            REQUIRE(visitCount == 1u);
+    }
+
+    TEST_CASE("CollisionTree: Tree bounds contain all triangles", "[xmodel][collision]")
+    {
+        SECTION("Random triangles")
+        {
+            const auto mesh = CreateRandomMesh(2000u, 5000u, 0u);
+            const auto tree = BuildCollisionTree(mesh.GetVertexData(), mesh.TriCount(), mesh.VertexCount());
+
+            RequireValidTree(tree, mesh);
+        }
+
+        SECTION("Flat grid")
+        {
+            const auto mesh = CreateGridMesh(40u);
+            const auto tree = BuildCollisionTree(mesh.GetVertexData(), mesh.TriCount(), mesh.VertexCount());
+
+            RequireValidTree(tree, mesh);
+
+            // Flat axis cannot be scaled and the others must use the full range
+            REQUIRE(tree.scale[2] == 1.0f);
+            REQUIRE(tree.nodes[0].aabb.mins[0] == 0u);
+            REQUIRE(tree.nodes[0].aabb.maxs[0] == UINT16_MAX);
+            REQUIRE(tree.nodes[0].aabb.mins[1] == 0u);
+            REQUIRE(tree.nodes[0].aabb.maxs[1] == UINT16_MAX);
+        }
+
+        SECTION("Uneven grid")
+        {
+            const auto mesh = CreateGridMesh(60u, 3u);
+            const auto tree = BuildCollisionTree(mesh.GetVertexData(), mesh.TriCount(), mesh.VertexCount());
+
+            RequireValidTree(tree, mesh);
+        }
+
+        SECTION("Single triangle")
+        {
+            const auto mesh = CreateRandomMesh(3u, 1u, 1u);
+            const auto tree = BuildCollisionTree(mesh.GetVertexData(), mesh.TriCount(), mesh.VertexCount());
+
+            REQUIRE(tree.nodes.size() == 1u);
+            RequireValidTree(tree, mesh);
+        }
+
+        SECTION("Maximum triangle count")
+        {
+            const auto mesh = CreateRandomMesh(30000u, MAX_TRIANGLE_COUNT, 2u);
+            const auto tree = BuildCollisionTree(mesh.GetVertexData(), mesh.TriCount(), mesh.VertexCount());
+
+            RequireValidTree(tree, mesh);
+        }
+    }
+
+    TEST_CASE("CollisionTree: Building is deterministic", "[xmodel][collision]")
+    {
+        const auto mesh = CreateGridMesh(30u);
+        const auto tree0 = BuildCollisionTree(mesh.GetVertexData(), mesh.TriCount(), mesh.VertexCount());
+        const auto tree1 = BuildCollisionTree(mesh.GetVertexData(), mesh.TriCount(), mesh.VertexCount());
+
+        REQUIRE(tree0.leafs == tree1.leafs);
+        REQUIRE(tree0.nodes.size() == tree1.nodes.size());
+        for (auto nodeIndex = 0u; nodeIndex < tree0.nodes.size(); nodeIndex++)
+        {
+            const auto& node0 = tree0.nodes[nodeIndex];
+            const auto& node1 = tree1.nodes[nodeIndex];
+
+            REQUIRE(node0.childBeginIndex == node1.childBeginIndex);
+            REQUIRE(node0.childCount == node1.childCount);
+            REQUIRE(Contains(node0.aabb, node1.aabb));
+            REQUIRE(Contains(node1.aabb, node0.aabb));
+        }
+    }
+
+    TEST_CASE("CollisionTree: Build throughput", "[.][benchmark][xmodel][collision]")
+    {
+        // Grids of 125 * 125 quads which makes one million triangles in total
+        constexpr auto treeCount = 32u;
+        constexpr auto gridSize = 125u;
+        constexpr auto megaTris = static_cast<double>(treeCount * gridSize * gridSize * 2u) / 1000000.0;
+
+        std::vector<TestMesh> meshes;
+        for (auto i = 0u; i < treeCount; i++)
+            meshes.emplace_back(CreateGridMesh(gridSize, i));
+
+        size_t nodeCount = 0u;
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& mesh : meshes)
+            nodeCount += BuildCollisionTree(mesh.GetVertexData(), mesh.TriCount(), mesh.VertexCount()).nodes.size();
+        const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::format("Collision tree build: {:.2f} ms per million triangles ({} nodes)\n", duration.count() / megaTris, nodeCount);
+    }
+} // namespace test::xmodel::collision_tree
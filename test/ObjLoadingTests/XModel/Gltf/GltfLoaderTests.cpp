@@ -0,0 +1,372 @@
+#include "XModel/Gltf/GltfBinInput.h"
+#include "XModel/Gltf/GltfConstants.h"
+#include "XModel/Gltf/GltfLoader.h"
+#include "XModel/Gltf/Internal/GltfAccessor.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <vector>
+
+using namespace gltf;
+
+namespace test::xmodel::gltf_loader
+{
+    std::vector<uint8_t> CreateTestData(const size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        for (auto i = 0u; i < size; i++)
+            data[i] = static_cast<uint8_t>(i * 7u + 3u);
+
+        return data;
+    }
+
+    TEST_CASE("GltfAccessor: Bulk reads match single element reads", "[gltf][xmodel]")
+    {
+        constexpr auto elementCount = 37u;
+        const auto data = CreateTestData(2048u);
+        const EmbeddedBuffer buffer(data.data(), data.size());
+
+        SECTION("Tightly packed floats")
+        {
+            std::vector<float> floats(elementCount * 3u);
+            for (auto i = 0u; i < floats.size(); i++)
+                floats[i] = static_cast<float>(i) * 0.25f - 3.0f;
+            const EmbeddedBuffer floatBuffer(floats.data(), floats.size() * sizeof(float));
+            const BufferView bufferView(&floatBuffer, 0u, floats.size() * sizeof(float), 0u);
+            const FloatAccessor accessor(&bufferView, JsonAccessorType::VEC3, 0u, elementCount);
+
+            std::vector<float> bulk(elementCount * 3u);
+            REQUIRE(accessor.GetFloatVecs(0u, 3u, bulk));
+            REQUIRE(bulk == floats);
+
+            std::vector<unsigned> unsignedBulk(elementCount);
+            REQUIRE(!accessor.GetUnsignedVecs(0u, 1u, unsignedBulk));
+        }
+
+        SECTION("Strided unsigned bytes")
+        {
+            const BufferView bufferView(&buffer, 16u, 1024u, 12u);
+            const UnsignedByteAccessor accessor(&bufferView, JsonAccessorType::VEC4, 4u, elementCount);
+
+            std::vector<float> bulkFloats(elementCount * 4u);
+            std::vector<unsigned> bulkUnsigned(elementCount * 4u);
+            REQUIRE(accessor.GetFloatVecs(0u, 4u, bulkFloats));
+            REQUIRE(accessor.GetUnsignedVecs(0u, 4u, bulkUnsigned));
+
+            for (auto i = 0u; i < elementCount; i++)
+            {
+                float floatValue[4];
+                unsigned unsignedValue[4];
+                REQUIRE(accessor.GetFloatVec4(i, floatValue));
+                REQUIRE(accessor.GetUnsignedVec4(i, unsignedValue));
+
+                for (auto component = 0u; component < 4u; component++)
+                {
+                    REQUIRE(bulkFloats[i * 4u + component] == floatValue[component]);
+                    REQUIRE(bulkUnsigned[i * 4u + component] == unsignedValue[component]);
+                }
+            }
+        }
+
+        SECTION("Tightly packed unsigned shorts with offset")
+        {
+            const BufferView bufferView(&buffer, 8u, 1024u, 0u);
+            const UnsignedShortAccessor accessor(&bufferView, JsonAccessorType::VEC2, 20u, elementCount);
+
+            std::vector<float> bulk((elementCount - 5u) * 2u);
+            REQUIRE(accessor.GetFloatVecs(5u, 2u, bulk));
+
+            for (auto i = 5u; i < elementCount; i++)
+            {
+                float value[2];
+                REQUIRE(accessor.GetFloatVec2(i, value));
+                REQUIRE(bulk[(i - 5u) * 2u + 0u] == value[0]);
+                REQUIRE(bulk[(i - 5u) * 2u + 1u] == value[1]);
+            }
+        }
+
+        SECTION("Scalar indices")
+        {
+            const BufferView bufferView(&buffer, 0u, 1024u, 0u);
+            const UnsignedIntAccessor accessor(&bufferView, JsonAccessorType::SCALAR, 0u, elementCount);
+
+            std::vector<unsigned> bulk(elementCount);
+            REQUIRE(accessor.GetUnsignedVecs(0u, 1u, bulk));
+
+            for (auto i = 0u; i < elementCount; i++)
+            {
+                unsigned value;
+                REQUIRE(accessor.GetUnsigned(i, value));
+                REQUIRE(bulk[i] == value);
+            }
+        }
+    }
+
+    TEST_CASE("GltfAccessor: Bulk reads fill components the accessor does not have", "[gltf][xmodel]")
+    {
+        const auto data = CreateTestData(64u);
+        const EmbeddedBuffer buffer(data.data(), data.size());
+        const BufferView bufferView(&buffer, 0u, data.size(), 0u);
+        const UnsignedByteAccessor accessor(&bufferView, JsonAccessorType::VEC3, 0u, 4u);
+
+        std::vector<float> colors(4u * 4u);
+        REQUIRE(accessor.GetFloatVecs(0u, 4u, colors));
+
+        for (auto i = 0u; i < 4u; i++)
+        {
+            for (auto component = 0u; component < 3u; component++)
+                REQUIRE(colors[i * 4u + component] == static_cast<float>(data[i * 3u + component]) / 255.0f);
+            REQUIRE(colors[i * 4u + 3u] == 1.0f);
+        }
+    }
+
+    TEST_CASE("GltfAccessor: Bulk reads fail outside of bounds", "[gltf][xmodel]")
+    {
+        const auto data = CreateTestData(64u);
+        const EmbeddedBuffer buffer(data.data(), data.size());
+        const BufferView bufferView(&buffer, 0u, 48u, 0u);
+
+        std::vector<float> out(4u * 3u);
+
+        const FloatAccessor accessor(&bufferView, JsonAccessorType::VEC3, 0u, 4u);
+        REQUIRE(accessor.GetFloatVecs(0u, 3u, out));
+        REQUIRE(!accessor.GetFloatVecs(1u, 3u, out));
+        REQUIRE(!accessor.GetFloatVecs(5u, 3u, std::span(out).first(0u)));
+
+        const FloatAccessor accessorLargerThanView(&bufferView, JsonAccessorType::VEC3, 4u, 4u);
+        REQUIRE(accessorLargerThanView.GetFloatVecs(0u, 3u, std::span(out).first(9u)));
+        REQUIRE(!accessorLargerThanView.GetFloatVecs(0u, 3u, out));
+
+        const NullAccessor nullAccessor(4u);
+        REQUIRE(nullAccessor.GetFloatVecs(0u, 3u, out));
+        REQUIRE(!nullAccessor.GetFloatVecs(2u, 3u, out));
+    }
+
+    std::string CreateGlb(const unsigned vertexCount)
+    {
+        const auto positionsSize = vertexCount * sizeof(float[3]);
+        const auto normalsSize = vertexCount * sizeof(float[3]);
+        const auto uvsSize = vertexCount * sizeof(uint16_t[2]);
+        const auto jointsSize = vertexCount * sizeof(uint8_t[4]);
+        const auto weightsSize = vertexCount * sizeof(uint8_t[4]);
+        const auto indicesSize = vertexCount * sizeof(uint32_t);
+        const auto bufferSize = positionsSize + normalsSize + uvsSize + jointsSize + weightsSize + indicesSize;
+
+        std::vector<uint8_t> buffer(bufferSize);
+        auto* positions = reinterpret_cast<float*>(buffer.data());
+        auto* normals = reinterpret_cast<float*>(&buffer[positionsSize]);
+        auto* uvs = reinterpret_cast<uint16_t*>(&buffer[positionsSize + normalsSize]);
+        auto* joints = &buffer[positionsSize + normalsSize + uvsSize];
+        auto* weights = &buffer[positionsSize + normalsSize + uvsSize + jointsSize];
+        auto* indices = reinterpret_cast<uint32_t*>(&buffer[positionsSize + normalsSize + uvsSize + jointsSize + weightsSize]);
+
+        for (auto i = 0u; i < vertexCount; i++)
+        {
+            positions[i * 3u + 0u] = static_cast<float>(i % 1000u);
+            positions[i * 3u + 1u] = static_cast<float>(i / 1000u);
+            positions[i * 3u + 2u] = 0.0f;
+            normals[i * 3u + 0u] = 0.0f;
+            normals[i * 3u + 1u] = 0.0f;
+            normals[i * 3u + 2u] = 1.0f;
+            uvs[i * 2u + 0u] = static_cast<uint16_t>(i);
+            uvs[i * 2u + 1u] = static_cast<uint16_t>(i * 3u);
+            joints[i * 4u + 0u] = 0u;
+            joints[i * 4u + 1u] = 0u;
+            joints[i * 4u + 2u] = 0u;
+            joints[i * 4u + 3u] = 0u;
+            weights[i * 4u + 0u] = UINT8_MAX;
+            weights[i * 4u + 1u] = 0u;
+            weights[i * 4u + 2u] = 0u;
+            weights[i * 4u + 3u] = 0u;
+            indices[i] = i;
+        }
+
+        nlohmann::json json;
+        json["asset"]["version"] = GLTF_VERSION_STRING;
+        json["nodes"] = nlohmann::json::array({{{"mesh", 0u}}});
+        json["materials"] = nlohmann::json::array({{{"name", "material"}}});
+        json["buffers"] = nlohmann::json::array({{{"byteLength", bufferSize}}});
+
+        auto& primitives = json["meshes"][0]["primitives"][0];
+        primitives["material"] = 0u;
+
+        auto bufferOffset = 0u;
+        const auto addAccessor = [&](nlohmann::json& accessorIndex, const size_t size, const char* type, const JsonAccessorComponentType componentType)
+        {
+            accessorIndex = json["accessors"].size();
+
+            auto& accessor = json["accessors"].emplace_back();
+            accessor["bufferView"] = json["bufferViews"].size();
+            accessor["componentType"] = static_cast<unsigned>(componentType);
+            accessor["count"] = vertexCount;
+            accessor["type"] = type;
+
+            auto& bufferView = json["bufferViews"].emplace_back();
+            bufferView["buffer"] = 0u;
+            bufferView["byteOffset"] = bufferOffset;
+            bufferView["byteLength"] = size;
+
+            bufferOffset += static_cast<unsigned>(size);
+        };
+
+        addAccessor(primitives["attributes"][GLTF_ATTRIBUTE_POSITION], positionsSize, "VEC3", JsonAccessorComponentType::FLOAT);
+        addAccessor(primitives["attributes"][GLTF_ATTRIBUTE_NORMAL], normalsSize, "VEC3", JsonAccessorComponentType::FLOAT);
+        addAccessor(primitives["attributes"][GLTF_ATTRIBUTE_TEXCOORD_0], uvsSize, "VEC2", JsonAccessorComponentType::UNSIGNED_SHORT);
+        addAccessor(primitives["attributes"][GLTF_ATTRIBUTE_JOINTS_0], jointsSize, "VEC4", JsonAccessorComponentType::UNSIGNED_BYTE);
+        addAccessor(primitives["attributes"][GLTF_ATTRIBUTE_WEIGHTS_0], weightsSize, "VEC4", JsonAccessorComponentType::UNSIGNED_BYTE);
+        addAccessor(primitives["indices"], indicesSize, "SCALAR", JsonAccessorComponentType::UNSIGNED_INT);
+
+        auto jsonData = json.dump();
+        while (jsonData.size() % 4u > 0u)
+            jsonData += ' ';
+
+        std::ostringstream ss;
+        const auto writeUInt32 = [&ss](const uint32_t value)
+        {
+            ss.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+
+        writeUInt32(GLTF_MAGIC);
+        writeUInt32(GLTF_VERSION);
+        writeUInt32(static_cast<uint32_t>(12u + 8u + jsonData.size() + 8u + buffer.size()));
+        writeUInt32(static_cast<uint32_t>(jsonData.size()));
+        writeUInt32(CHUNK_MAGIC_JSON);
+        ss.write(jsonData.data(), static_cast<std::streamsize>(jsonData.size()));
+        writeUInt32(static_cast<uint32_t>(buffer.size()));
+        writeUInt32(CHUNK_MAGIC_BIN);
+        ss.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+        return ss.str();
+    }
+
+    void RequireLoadedModel(const Input& input, const unsigned vertexCount)
+    {
+        const auto loader = Loader::CreateLoader(&input);
+        const auto common = loader->Load();
+        REQUIRE(common);
+        REQUIRE(common->m_vertices.size() == vertexCount);
+        REQUIRE(common->m_objects.size() == 1u);
+        REQUIRE(common->m_objects[0].m_faces.size() == vertexCount / 3u);
+        REQUIRE(common->m_bone_weight_data.weights.size() == vertexCount);
+
+        const auto& vertex = common->m_vertices[1234u];
+        REQUIRE(vertex.coordinates[0] == 234.0f);
+        REQUIRE(vertex.coordinates[1] == -0.0f);
+        REQUIRE(vertex.coordinates[2] == 1.0f);
+        REQUIRE(vertex.normal[1] == -1.0f);
+        REQUIRE(vertex.uv[0] == 1234.0f / 65535.0f);
+        REQUIRE(vertex.uv[1] == 3702.0f / 65535.0f);
+        REQUIRE(vertex.color[3] == 1.0f);
+    }
+
+    TEST_CASE("GltfLoader: Loads vertices from binary model", "[gltf][xmodel]")
+    {
+        constexpr auto vertexCount = 3000u;
+        const auto glb = CreateGlb(vertexCount);
+
+        SECTION("From stream")
+        {
+            std::istringstream ss(glb);
+            BinInput input;
+            REQUIRE(input.ReadGltfData(ss));
+
+            RequireLoadedModel(input, vertexCount);
+        }
+
+        SECTION("In place")
+        {
+            BinInput input;
+            REQUIRE(input.ReadGltfData(glb.data(), glb.size()));
+
+            const void* buffer;
+            size_t bufferSize;
+            REQUIRE(input.GetEmbeddedBuffer(buffer, bufferSize));
+            REQUIRE(buffer >= glb.data());
+            REQUIRE(static_cast<const char*>(buffer) + bufferSize <= glb.data() + glb.size());
+
+            RequireLoadedModel(input, vertexCount);
+        }
+
+        SECTION("From mapped file")
+        {
+            const auto filePath = std::filesystem::temp_directory_path() / "oat_gltf_loader_test.glb";
+            {
+                std::ofstream file(filePath, std::ios::binary);
+                file.write(glb.data(), static_cast<std::streamsize>(glb.size()));
+            }
+
+            {
+                BinInput input;
+                REQUIRE(input.ReadGltfFile(filePath));
+
+                RequireLoadedModel(input, vertexCount);
+            }
+
+            std::filesystem::remove(filePath);
+        }
+    }
+
+    TEST_CASE("GltfLoader: Rejects truncated binary model", "[gltf][xmodel]")
+    {
+        const auto glb = CreateGlb(30u);
+
+        BinInput input;
+        REQUIRE(!input.ReadGltfData(glb.data(), glb.size() - 1u));
+        REQUIRE(!input.ReadGltfData(glb.data(), 10u));
+    }
+
+    TEST_CASE("GltfLoader: Binary model load time", "[.][benchmark][gltf][xmodel]")
+    {
+        // Roughly 500MB of binary data
+        constexpr auto vertexCount = 12500001u;
+        const auto filePath = std::filesystem::temp_directory_path() / "oat_gltf_loader_benchmark.glb";
+        {
+            const auto glb = CreateGlb(vertexCount);
+            std::ofstream file(filePath, std::ios::binary);
+            file.write(glb.data(), static_cast<std::streamsize>(glb.size()));
+        }
+
+        const auto measureLoad = [vertexCount](const char* name, const std::function<bool(BinInput& input)>& readInput)
+        {
+            const auto start = std::chrono::steady_clock::now();
+
+            BinInput input;
+            REQUIRE(readInput(input));
+            const auto readEnd = std::chrono::steady_clock::now();
+
+            const auto loader = Loader::CreateLoader(&input);
+            const auto common = loader->Load();
+            REQUIRE(common);
+            REQUIRE(common->m_vertices.size() == vertexCount);
+
+            const auto end = std::chrono::steady_clock::now();
+            const std::chrono::duration<double, std::milli> readDuration = readEnd - start;
+            const std::chrono::duration<double, std::milli> totalDuration = end - start;
+            std::cout << std::format(
+                "{}: Read input in {:.1f}ms, loaded {} vertices in {:.1f}ms\n", name, readDuration.count(), vertexCount, totalDuration.count());
+        };
+
+        measureLoad("Stream",
+                    [&filePath](BinInput& input)
+                    {
+                        std::ifstream file(filePath, std::ios::binary);
+                        return input.ReadGltfData(file);
+                    });
+        measureLoad("Mapped file",
+                    [&filePath](BinInput& input)
+                    {
+                        return input.ReadGltfFile(filePath);
+                    });
+
+        std::filesystem::remove(filePath);
+    }
+} // namespace test::xmodel::gltf_loader
@@ -0,0 +1,171 @@
+#include "XModel/VertexCacheOptimization.h"
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace vertex_cache;
+
+namespace test::xmodel::vertex_cache_optimization
+{
+    std::vector<uint16_t> CreateGridIndices(const size_t width, const size_t height)
+    {
+        std::vector<uint16_t> indices;
+        for (auto y = 0u; y < height; y++)
+        {
+            for (auto x = 0u; x < width; x++)
+            {
+                const auto i0 = static_cast<uint16_t>(y * (width + 1u) + x);
+                const auto i1 = static_cast<uint16_t>(i0 + 1u);
+                const auto i2 = static_cast<uint16_t>(i0 + width + 1u);
+                const auto i3 = static_cast<uint16_t>(i2 + 1u);
+                indices.insert(indices.end(), {i0, i1, i2, i1, i3, i2});
+            }
+        }
+
+        return indices;
+    }
+
+    // Simulates an unoptimized export by ordering triangles randomly
+    void ShuffleTriangles(std::vector<uint16_t>& indices, const unsigned seed)
+    {
+        std::vector<std::array<uint16_t, 3>> tris(indices.size() / 3u);
+        for (auto triIndex = 0u; triIndex < tris.size(); triIndex++)
+            tris[triIndex] = {indices[triIndex * 3u], indices[triIndex * 3u + 1u], indices[triIndex * 3u + 2u]};
+
+        std::mt19937 random(seed);
+        std::ranges::shuffle(tris, random);
+
+        for (auto triIndex = 0u; triIndex < tris.size(); triIndex++)
+            std::ranges::copy(tris[triIndex], &indices[triIndex * 3u]);
+    }
+
+    std::vector<std::array<uint16_t, 3>> GetSortedTriangles(const std::vector<uint16_t>& indices)
+    {
+        std::vector<std::array<uint16_t, 3>> tris(indices.size() / 3u);
+        for (auto triIndex = 0u; triIndex < tris.size(); triIndex++)
+            tris[triIndex] = {indices[triIndex * 3u], indices[triIndex * 3u + 1u], indices[triIndex * 3u + 2u]};
+
+        std::ranges::sort(tris);
+        return tris;
+    }
+
+    TEST_CASE("VertexCacheOptimization: Calculates cache statistics", "[xmodel][vertexcache]")
+    {
+        SECTION("Shared vertices are only transformed once")
+        {
+            const std::vector<uint16_t> indices{0, 1, 2, 1, 3, 2};
+            const auto statistics = CalculateStatistics(indices, 4u);
+
+            REQUIRE(statistics.acmr == 2.0f);
+            REQUIRE(statistics.atvr == 1.0f);
+        }
+
+        SECTION("Evicted vertices are transformed again")
+        {
+            const std::vector<uint16_t> indices{0, 1, 2, 3, 4, 5, 0, 1, 2};
+            const auto statistics = CalculateStatistics(indices, 6u, 3u);
+
+            REQUIRE(statistics.acmr == 3.0f);
+            REQUIRE(statistics.atvr == 1.5f);
+        }
+
+        SECTION("A full cache still contains its oldest vertex")
+        {
+            const std::vector<uint16_t> indices{0, 1, 2, 2, 1, 0};
+            const auto statistics = CalculateStatistics(indices, 3u, 3u);
+
+            REQUIRE(statistics.acmr == 1.5f);
+        }
+
+        SECTION("Vertices hit in the cache are not moved to the front")
+        {
+            // A fifo cache evicts vertex 0 when vertex 3 is added even though it was used in between
+            const std::vector<uint16_t> indices{0, 1, 2, 0, 2, 3, 0, 3, 1};
+            const auto statistics = CalculateStatistics(indices, 4u, 3u);
+
+            REQUIRE(statistics.acmr == 2.0f);
+        }
+    }
+
+    TEST_CASE("VertexCacheOptimization: Optimizes triangle order", "[xmodel][vertexcache]")
+    {
+        constexpr auto gridSize = 40u;
+        constexpr auto vertexCount = (gridSize + 1u) * (gridSize + 1u);
+
+        auto indices = CreateGridIndices(gridSize, gridSize);
+        ShuffleTriangles(indices, 0u);
+        const auto trisBefore = GetSortedTriangles(indices);
+        const auto statisticsBefore = CalculateStatistics(indices, vertexCount);
+
+        OptimizeTriangleOrder(indices, vertexCount);
+        const auto statisticsAfter = CalculateStatistics(indices, vertexCount);
+
+        INFO(std::format("ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}",
+                         statisticsBefore.acmr,
+                         statisticsAfter.acmr,
+                         statisticsBefore.atvr,
+                         statisticsAfter.atvr));
+
+        // The same triangles must remain with the same winding
+        REQUIRE(GetSortedTriangles(indices) == trisBefore);
+
+        // A grid has about one vertex for every two triangles so the optimum is close to 0.5
+        REQUIRE(statisticsBefore.acmr > 2.0f);
+        REQUIRE(statisticsAfter.acmr < 0.8f);
+        REQUIRE(statisticsAfter.atvr < 1.6f);
+    }
+
+    TEST_CASE("VertexCacheOptimization: Optimizes degenerate and disconnected triangles", "[xmodel][vertexcache]")
+    {
+        std::vector<uint16_t> indices{0, 0, 1, 2, 3, 4, 5, 6, 7, 1, 1, 1, 8, 9, 10, 2, 4, 3};
+        const auto trisBefore = GetSortedTriangles(indices);
+
+        OptimizeTriangleOrder(indices, 11u);
+
+        REQUIRE(GetSortedTriangles(indices) == trisBefore);
+    }
+
+    TEST_CASE("VertexCacheOptimization: Reorders vertices by first use within partitions", "[xmodel][vertexcache]")
+    {
+        std::vector<uint16_t> indices{5, 4, 0, 3, 1, 2};
+        const std::vector<size_t> partitions{0, 0, 0, 1, 1, 1};
+
+        const auto newToOld = ReorderVerticesByFirstUse(indices, partitions);
+
+        REQUIRE(newToOld == std::vector<size_t>{0, 1, 2, 5, 4, 3});
+        REQUIRE(indices == std::vector<uint16_t>{3, 4, 0, 5, 1, 2});
+    }
+
+    TEST_CASE("VertexCacheOptimization: Optimization throughput", "[.][benchmark][xmodel][vertexcache]")
+    {
+        constexpr auto gridSize = 180u;
+        constexpr auto vertexCount = (gridSize + 1u) * (gridSize + 1u);
+
+        auto indices = CreateGridIndices(gridSize, gridSize);
+        ShuffleTriangles(indices, 0u);
+        const auto triCount = indices.size() / 3u;
+        const auto statisticsBefore = CalculateStatistics(indices, vertexCount);
+
+        const auto start = std::chrono::steady_clock::now();
+        OptimizeTriangleOrder(indices, vertexCount);
+        std::vector<size_t> partitions(vertexCount, 0u);
+        ReorderVerticesByFirstUse(indices, partitions);
+        const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+        const auto statisticsAfter = CalculateStatistics(indices, vertexCount);
+
+        std::cout << std::format("Vertex cache optimization of {} triangles: {:.2f} ms\n", triCount, duration.count());
+        std::cout << std::format("ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}\n",
+                                 statisticsBefore.acmr,
+                                 statisticsAfter.acmr,
+                                 statisticsBefore.atvr,
+                                 statisticsAfter.atvr);
+    }
+} // namespace test::xmodel::vertex_cache_optimization
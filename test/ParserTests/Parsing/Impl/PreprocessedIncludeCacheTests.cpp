@@ -0,0 +1,115 @@
+#include "Parsing/Impl/DefinesStreamProxy.h"
+#include "Parsing/Impl/IncludingStreamProxy.h"
+#include "Parsing/Impl/PreprocessedIncludeCache.h"
+#include "Parsing/Mock/MockParserLineStream.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+namespace test::parsing::impl::preprocessed_include_cache
+{
+    class PreprocessorChain
+    {
+    public:
+        MockParserLineStream m_stream;
+        IncludingStreamProxy m_including_proxy;
+        DefinesStreamProxy m_defines_proxy;
+
+        PreprocessorChain(const std::vector<std::string>& lines, PreprocessedIncludeCache& cache)
+            : m_stream(lines),
+              m_including_proxy(&m_stream),
+              m_defines_proxy(&m_including_proxy)
+        {
+            m_including_proxy.SetIncludeCacheHandler(&m_defines_proxy);
+            m_defines_proxy.SetIncludeCache(&cache);
+        }
+
+        std::vector<std::string> ReadAllLines()
+        {
+            std::vector<std::string> result;
+            while (true)
+            {
+                auto line = m_defines_proxy.NextLine();
+                if (line.IsEof())
+                    break;
+
+                result.emplace_back(line.m_line);
+            }
+
+            return result;
+        }
+    };
+
+    const std::vector<std::string> HEADER_LINES{
+        "#ifndef HEADER_H",
+        "#define HEADER_H",
+        "#define VALUE 42",
+        "#ifdef DOUBLE",
+        "#define SCALE 2",
+        "#else",
+        "#define SCALE 1",
+        "#endif",
+        "header text",
+        "#endif",
+    };
+
+    TEST_CASE("PreprocessedIncludeCache: Ensure replayed include restores lines and defines", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines{"#include \"header.h\"", "VALUE * SCALE"};
+        PreprocessedIncludeCache cache;
+
+        PreprocessorChain first(lines, cache);
+        first.m_stream.AddIncludeLines("header.h", HEADER_LINES);
+        const auto firstResult = first.ReadAllLines();
+        REQUIRE(cache.GetEntryCount() == 1u);
+
+        // The second chain does not know the header so it can only get it from the cache
+        PreprocessorChain second(lines, cache);
+        const auto secondResult = second.ReadAllLines();
+
+        REQUIRE(firstResult == secondResult);
+        REQUIRE(secondResult.size() == 11u);
+        REQUIRE(secondResult[8] == "header text");
+        REQUIRE(secondResult[10] == "42 * 1");
+    }
+
+    TEST_CASE("PreprocessedIncludeCache: Ensure includes are not replayed with different defines", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> singleLines{"#include \"header.h\"", "SCALE"};
+        const std::vector<std::string> doubleLines{"#define DOUBLE", "#include \"header.h\"", "SCALE"};
+        PreprocessedIncludeCache cache;
+
+        PreprocessorChain first(singleLines, cache);
+        first.m_stream.AddIncludeLines("header.h", HEADER_LINES);
+        REQUIRE(first.ReadAllLines().back() == "1");
+
+        PreprocessorChain second(doubleLines, cache);
+        second.m_stream.AddIncludeLines("header.h", HEADER_LINES);
+        REQUIRE(second.ReadAllLines().back() == "2");
+        REQUIRE(cache.GetEntryCount() == 2u);
+
+        PreprocessorChain third(doubleLines, cache);
+        REQUIRE(third.ReadAllLines().back() == "2");
+    }
+
+    TEST_CASE("PreprocessedIncludeCache: Ensure consecutive includes are replayed in order", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines{"#include \"a.h\"", "#include \"b.h\"", "A B"};
+        const std::vector<std::string> aLines{"#define A first"};
+        const std::vector<std::string> bLines{"#define B A second", "b text"};
+        PreprocessedIncludeCache cache;
+
+        PreprocessorChain first(lines, cache);
+        first.m_stream.AddIncludeLines("a.h", aLines);
+        first.m_stream.AddIncludeLines("b.h", bLines);
+        const auto firstResult = first.ReadAllLines();
+        REQUIRE(cache.GetEntryCount() == 2u);
+
+        PreprocessorChain second(lines, cache);
+        const auto secondResult = second.ReadAllLines();
+
+        REQUIRE(firstResult == secondResult);
+        REQUIRE(secondResult == std::vector<std::string>{"", "", "b text", "first first second"});
+    }
+} // namespace test::parsing::impl::preprocessed_include_cache
@@ -0,0 +1,213 @@
+#include "Parsing/Impl/AbstractParser.h"
+#include "Parsing/Impl/ParserSingleInputStream.h"
+#include "Parsing/Mock/MockSequence.h"
+#include "Parsing/Sequence/SequenceDispatchTable.h"
+#include "Parsing/Simple/Matcher/SimpleMatcherFactory.h"
+#include "Parsing/Simple/SimpleLexer.h"
+#include "Parsing/Simple/SimpleParserValue.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace test::parsing::sequence::dispatch_table
+{
+    typedef MockSequence<SimpleParserValue> sequence_t;
+    typedef SequenceDispatchTable<SimpleParserValue, MockSequenceState> table_t;
+
+    class DispatchTableTestsHelper
+    {
+    public:
+        std::vector<std::unique_ptr<sequence_t>> m_sequences;
+
+        sequence_t& AddSequence()
+        {
+            return *m_sequences.emplace_back(std::make_unique<sequence_t>());
+        }
+
+        [[nodiscard]] std::vector<table_t::sequence_t*> GetSequences() const
+        {
+            std::vector<table_t::sequence_t*> result;
+            for (const auto& sequence : m_sequences)
+                result.emplace_back(sequence.get());
+
+            return result;
+        }
+
+        [[nodiscard]] table_t::sequence_t* Sequence(const size_t index) const
+        {
+            return m_sequences[index].get();
+        }
+    };
+
+    class DispatchTableTestsParser final : public AbstractParser<SimpleParserValue, MockSequenceState>
+    {
+    public:
+        std::vector<sequence_t*> m_tests;
+
+        explicit DispatchTableTestsParser(ILexer<SimpleParserValue>* lexer)
+            : AbstractParser(lexer, std::make_unique<MockSequenceState>())
+        {
+        }
+
+    protected:
+        const std::vector<sequence_t*>& GetTestsForState() override
+        {
+            return m_tests;
+        }
+    };
+
+    SimpleParserValue Identifier(const std::string& value)
+    {
+        return SimpleParserValue::Identifier(TokenPos(), new std::string(value));
+    }
+
+    TEST_CASE("SequenceDispatchTable: Keyword sequences only start with their keyword", "[parsing][sequence]")
+    {
+        DispatchTableTestsHelper helper;
+        auto& sequence = helper.AddSequence();
+        const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+
+        sequence.AddMockMatchers({
+            create.KeywordIgnoreCase("menuDef"),
+            create.Char('{'),
+        });
+
+        const auto firstSet = sequence.GetFirstSet();
+        REQUIRE(!firstSet.ContainsAnyToken());
+        REQUIRE(firstSet.GetTokenTypes().empty());
+        REQUIRE(firstSet.ContainsTokenValue(static_cast<int>(SimpleParserValueType::IDENTIFIER), MatcherFirstSet::HashIgnoreCase("menudef")));
+        REQUIRE(!firstSet.ContainsTokenValue(static_cast<int>(SimpleParserValueType::CHARACTER), static_cast<unsigned char>('{')));
+    }
+
+    TEST_CASE("SequenceDispatchTable: Optional matchers include the first tokens of the following matchers", "[parsing][sequence]")
+    {
+        DispatchTableTestsHelper helper;
+        auto& sequence = helper.AddSequence();
+        const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+
+        sequence.AddMockMatchers({
+            create.Optional(create.Char('-')),
+            create.Integer(),
+        });
+
+        const auto firstSet = sequence.GetFirstSet();
+        REQUIRE(!firstSet.ContainsAnyToken());
+        REQUIRE(firstSet.ContainsTokenValue(static_cast<int>(SimpleParserValueType::CHARACTER), static_cast<unsigned char>('-')));
+        REQUIRE(firstSet.ContainsTokenType(static_cast<int>(SimpleParserValueType::INTEGER)));
+    }
+
+    TEST_CASE("SequenceDispatchTable: Sequences that can match nothing can start with any token", "[parsing][sequence]")
+    {
+        DispatchTableTestsHelper helper;
+        auto& sequence = helper.AddSequence();
+        const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+
+        sequence.AddMockMatchers({
+            create.OptionalLoop(create.Type(SimpleParserValueType::NEW_LINE)),
+        });
+
+        REQUIRE(sequence.GetFirstSet().ContainsAnyToken());
+    }
+
+    TEST_CASE("SequenceDispatchTable: Left recursive labels can start with any token", "[parsing][sequence]")
+    {
+        static constexpr auto LABEL_RECURSIVE = 1;
+
+        DispatchTableTestsHelper helper;
+        auto& sequence = helper.AddSequence();
+        const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+
+        sequence.AddMockMatchers({
+            create.Label(LABEL_RECURSIVE),
+        });
+        sequence.AddMockLabeledMatchers(
+            {
+                create.Or({
+                    create.And({
+                        create.Label(LABEL_RECURSIVE),
+                        create.Char('+'),
+                    }),
+                    create.Integer(),
+                }),
+            },
+            LABEL_RECURSIVE);
+
+        REQUIRE(sequence.GetFirstSet().ContainsAnyToken());
+    }
+
+    TEST_CASE("SequenceDispatchTable: Candidates keep the order of the sequences", "[parsing][sequence]")
+    {
+        DispatchTableTestsHelper helper;
+
+        {
+            auto& sequence = helper.AddSequence();
+            const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+            sequence.AddMockMatchers({create.KeywordIgnoreCase("menuDef")});
+        }
+        {
+            auto& sequence = helper.AddSequence();
+            const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+            sequence.AddMockMatchers({create.Char('{')});
+        }
+        {
+            auto& sequence = helper.AddSequence();
+            const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+            sequence.AddMockMatchers({create.Identifier()});
+        }
+        {
+            auto& sequence = helper.AddSequence();
+            const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+            sequence.AddMockMatchers({create.True()});
+        }
+        {
+            auto& sequence = helper.AddSequence();
+            const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+            sequence.AddMockMatchers({create.Keyword("itemDef")});
+        }
+
+        const table_t table(helper.GetSequences());
+        REQUIRE(table.IsBuiltFrom(helper.GetSequences()));
+
+        REQUIRE(table.GetCandidates(Identifier("MENUDEF"))
+                == std::vector{helper.Sequence(0), helper.Sequence(2), helper.Sequence(3)});
+        REQUIRE(table.GetCandidates(Identifier("itemDef"))
+                == std::vector{helper.Sequence(2), helper.Sequence(3), helper.Sequence(4)});
+        REQUIRE(table.GetCandidates(Identifier("name")) == std::vector{helper.Sequence(2), helper.Sequence(3)});
+        REQUIRE(table.GetCandidates(SimpleParserValue::Character(TokenPos(), '{')) == std::vector{helper.Sequence(1), helper.Sequence(3)});
+        REQUIRE(table.GetCandidates(SimpleParserValue::Character(TokenPos(), '}')) == std::vector{helper.Sequence(3)});
+        REQUIRE(table.GetCandidates(SimpleParserValue::Integer(TokenPos(), 5)) == std::vector{helper.Sequence(3)});
+    }
+
+    TEST_CASE("SequenceDispatchTable: Parser dispatches by the current sequences when the test list is modified", "[parsing][sequence]")
+    {
+        DispatchTableTestsHelper helper;
+        {
+            auto& sequence = helper.AddSequence();
+            const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+            sequence.AddMockMatchers({create.Keyword("switch")});
+        }
+        {
+            auto& sequence = helper.AddSequence();
+            const SimpleMatcherFactory create(sequence.GetLabelSupplier());
+            sequence.AddMockMatchers({create.Keyword("next")});
+        }
+
+        std::istringstream ss("switch next");
+        ParserSingleInputStream stream(ss, "InputString");
+        SimpleLexer lexer(&stream, SimpleLexer::Config());
+        DispatchTableTestsParser parser(&lexer);
+
+        // Replaces the only sequence in place so the list keeps both its address and its size
+        parser.m_tests = {helper.Sequence(0)};
+        helper.m_sequences[0]->Handle(
+            [&parser, &helper](SequenceResult<SimpleParserValue>&)
+            {
+                parser.m_tests[0] = helper.Sequence(1);
+            });
+
+        REQUIRE(parser.Parse());
+    }
+} // namespace test::parsing::sequence::dispatch_table
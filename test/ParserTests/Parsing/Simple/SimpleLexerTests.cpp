@@ -0,0 +1,69 @@
+#include "Parsing/Mock/MockParserLineStream.h"
+#include "Parsing/Simple/SimpleLexer.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+namespace test::parsing::simple::lexer
+{
+    SimpleLexer::Config CreateConfig(const bool useTokenArena, const bool stringEscapeSequences)
+    {
+        SimpleLexer::Config config;
+        config.m_string_escape_sequences = stringEscapeSequences;
+        config.m_use_token_arena = useTokenArena;
+
+        return config;
+    }
+
+    TEST_CASE("SimpleLexer: Ensure identifiers and strings are read the same with and without token arena", "[parsing][simple]")
+    {
+        const auto useTokenArena = GENERATE(false, true);
+        const std::vector<std::string> lines{R"(menuDef { name "main" })", R"(itemDef { name "main_item" })"};
+
+        MockParserLineStream mockStream(lines);
+        SimpleLexer lexer(&mockStream, CreateConfig(useTokenArena, false));
+
+        REQUIRE(lexer.GetToken(0).m_type == SimpleParserValueType::IDENTIFIER);
+        REQUIRE(lexer.GetToken(0).IdentifierValue() == "menuDef");
+        REQUIRE(lexer.GetToken(0).IdentifierHash() == std::hash<std::string>()("menuDef"));
+        REQUIRE(lexer.GetToken(1).m_type == SimpleParserValueType::CHARACTER);
+        REQUIRE(lexer.GetToken(1).CharacterValue() == '{');
+        REQUIRE(lexer.GetToken(2).IdentifierValue() == "name");
+        REQUIRE(lexer.GetToken(3).m_type == SimpleParserValueType::STRING);
+        REQUIRE(lexer.GetToken(3).StringValue() == "main");
+        REQUIRE(lexer.GetToken(4).CharacterValue() == '}');
+
+        lexer.PopTokens(5);
+
+        REQUIRE(lexer.GetToken(0).IdentifierValue() == "itemDef");
+        REQUIRE(lexer.GetToken(0).GetPos().m_line == 2);
+        REQUIRE(lexer.GetToken(2).IdentifierValue() == "name");
+        REQUIRE(lexer.GetToken(3).StringValue() == "main_item");
+        REQUIRE(lexer.GetToken(5).IsEof());
+    }
+
+    TEST_CASE("SimpleLexer: Ensure token arena shares text of equal tokens", "[parsing][simple]")
+    {
+        const std::vector<std::string> lines{R"(name "value" name)", R"("value" other)"};
+
+        MockParserLineStream mockStream(lines);
+        SimpleLexer lexer(&mockStream, CreateConfig(true, false));
+
+        REQUIRE(&lexer.GetToken(0).IdentifierValue() == &lexer.GetToken(2).IdentifierValue());
+        REQUIRE(&lexer.GetToken(1).StringValue() == &lexer.GetToken(3).StringValue());
+        REQUIRE(&lexer.GetToken(0).IdentifierValue() != &lexer.GetToken(4).IdentifierValue());
+        REQUIRE(lexer.GetToken(4).IdentifierValue() == "other");
+    }
+
+    TEST_CASE("SimpleLexer: Ensure token arena stores strings with resolved escape sequences", "[parsing][simple]")
+    {
+        const std::vector<std::string> lines{R"("hello \"world\"" "plain")"};
+
+        MockParserLineStream mockStream(lines);
+        SimpleLexer lexer(&mockStream, CreateConfig(true, true));
+
+        REQUIRE(lexer.GetToken(0).StringValue() == "hello \"world\"");
+        REQUIRE(lexer.GetToken(1).StringValue() == "plain");
+        REQUIRE(lexer.GetToken(2).IsEof());
+    }
+} // namespace test::parsing::simple::lexer
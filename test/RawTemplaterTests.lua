@@ -0,0 +1,61 @@
+RawTemplaterTests = {}
+
+function RawTemplaterTests:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "RawTemplaterTests")
+		}
+	end
+end
+
+function RawTemplaterTests:link(links)
+	
+end
+
+function RawTemplaterTests:use()
+	
+end
+
+function RawTemplaterTests:name()
+    return "RawTemplaterTests"
+end
+
+function RawTemplaterTests:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		-- RawTemplater is an executable, so the templating code it is made of is compiled into the tests directly
+		files {
+			path.join(folder, "RawTemplaterTests/**.h"), 
+			path.join(folder, "RawTemplaterTests/**.cpp"),
+			path.join(ProjectFolder(), "RawTemplater/Templating/**.h"),
+			path.join(ProjectFolder(), "RawTemplater/Templating/**.cpp")
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "RawTemplaterTests")
+			},
+			["RawTemplater/*"] = {
+				path.join(ProjectFolder(), "RawTemplater")
+			}
+		}
+		
+		self:include(includes)
+		Catch2Common:include(includes)
+		RawTemplater:include(includes)
+		Parser:include(includes)
+		catch2:include(includes)
+
+		links:linkto(Parser)
+		links:linkto(catch2)
+		links:linkto(Catch2Common)
+		links:linkall()
+end
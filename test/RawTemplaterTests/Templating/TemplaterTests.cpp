@@ -0,0 +1,111 @@
+#include "Templating/Templater.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace test::templating::templater
+{
+    const char* const VARIATIONS_TEMPLATE = "#options MODE (first, second)\n"
+                                            "#switch EXTRA\n"
+                                            "#options VARIANT (one, two)\n"
+                                            "\n"
+                                            "#ifdef EXTRA\n"
+                                            "#define EXTRA_SUFFIX \"_extra\"\n"
+                                            "#else\n"
+                                            "#define EXTRA_SUFFIX \"\"\n"
+                                            "#endif\n"
+                                            "\n"
+                                            "#filename \"out/\" + MODE + \"_\" + VARIANT + EXTRA_SUFFIX + \".txt\"\n"
+                                            "\n"
+                                            "mode MODE\n"
+                                            "variant VARIANT\n"
+                                            "#ifdef EXTRA\n"
+                                            "extra\n"
+                                            "#endif\n";
+
+    class TemplatingOutput
+    {
+    public:
+        bool m_success = false;
+        std::vector<std::string> m_templated_files;
+        std::map<std::string, std::string> m_file_contents;
+    };
+
+    TemplatingOutput TemplateToDirectory(const unsigned jobCount, const fs::path& outputDirectory)
+    {
+        fs::remove_all(outputDirectory);
+
+        std::istringstream templateStream(VARIATIONS_TEMPLATE);
+        std::ostringstream buildLog;
+
+        ::templating::Templater templater(templateStream, "variations.txt.template");
+        templater.SetBuildLogFile(&buildLog);
+        templater.SetJobCount(jobCount);
+
+        TemplatingOutput output;
+        output.m_success = templater.TemplateToDirectory(outputDirectory.string());
+
+        // The build log lists the templated files in the order they were written
+        std::istringstream buildLogLines(buildLog.str());
+        std::string line;
+        while (std::getline(buildLogLines, line))
+        {
+            const auto pathStart = line.find('"') + 1;
+            const auto pathEnd = line.rfind('"');
+            const fs::path templatedFile(line.substr(pathStart, pathEnd - pathStart));
+            output.m_templated_files.emplace_back(templatedFile.lexically_relative(outputDirectory).generic_string());
+        }
+
+        for (const auto& entry : fs::recursive_directory_iterator(outputDirectory))
+        {
+            if (!entry.is_regular_file())
+                continue;
+
+            std::ifstream fileStream(entry.path(), std::ios::in | std::ios::binary);
+            output.m_file_contents.emplace(entry.path().lexically_relative(outputDirectory).generic_string(),
+                                           std::string{std::istreambuf_iterator<char>(fileStream), std::istreambuf_iterator<char>()});
+        }
+
+        fs::remove_all(outputDirectory);
+
+        return output;
+    }
+
+    TEST_CASE("Templater: Ensure concurrent passes create same output as serial passes", "[templating]")
+    {
+        const auto outputDirectory = fs::temp_directory_path() / "oat_templater_test";
+
+        const auto serialOutput = TemplateToDirectory(1u, outputDirectory / "serial");
+        REQUIRE(serialOutput.m_success);
+
+        const std::vector<std::string> expectedFiles{
+            "out/first_one_extra.txt",
+            "out/first_two_extra.txt",
+            "out/first_one.txt",
+            "out/first_two.txt",
+            "out/second_one_extra.txt",
+            "out/second_two_extra.txt",
+            "out/second_one.txt",
+            "out/second_two.txt",
+        };
+        REQUIRE(serialOutput.m_templated_files == expectedFiles);
+        REQUIRE(serialOutput.m_file_contents.size() == expectedFiles.size());
+        REQUIRE(serialOutput.m_file_contents.at("out/first_two_extra.txt") == "mode first\nvariant two\nextra\n");
+        REQUIRE(serialOutput.m_file_contents.at("out/second_one.txt") == "mode second\nvariant one\n");
+
+        const auto concurrentOutput = TemplateToDirectory(4u, outputDirectory / "concurrent");
+        REQUIRE(concurrentOutput.m_success);
+        REQUIRE(concurrentOutput.m_templated_files == serialOutput.m_templated_files);
+        REQUIRE(concurrentOutput.m_file_contents == serialOutput.m_file_contents);
+
+        fs::remove_all(outputDirectory);
+    }
+} // namespace test::templating::templater
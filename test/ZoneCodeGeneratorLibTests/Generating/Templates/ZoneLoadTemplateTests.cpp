@@ -0,0 +1,171 @@
+#include "Generating/RenderingContext.h"
+#include "Generating/Templates/ZoneLoadTemplate.h"
+#include "OatTestPaths.h"
+#include "Parsing/Commands/CommandsFileReader.h"
+#include "Parsing/Header/HeaderFileReader.h"
+#include "Persistence/InMemory/InMemoryRepository.h"
+#include "ZoneCodeGeneratorArguments.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace test::generating::templates::zone_load_template
+{
+    constexpr auto TEST_HEADER = R"(
+enum XAssetType
+{
+    ASSET_TYPE_TEST,
+    ASSET_TYPE_OTHER
+};
+
+enum XFileBlock
+{
+    XFILE_BLOCK_TEMP,
+    XFILE_BLOCK_RUNTIME,
+    XFILE_BLOCK_VIRTUAL
+};
+
+typedef unsigned short scr_string_t;
+
+struct OtherAsset
+{
+    const char* name;
+};
+
+struct Element
+{
+    scr_string_t tag;
+    const char* otherName;
+    int value;
+};
+
+struct TestAsset
+{
+    const char* name;
+    scr_string_t tag;
+    int elementCount;
+    Element* elements;
+};
+)";
+
+    constexpr auto TEST_COMMANDS = R"(
+game Test;
+architecture x86;
+
+asset TestAsset AssetTest;
+asset OtherAsset AssetOther;
+
+block temp XFILE_BLOCK_TEMP default;
+block runtime XFILE_BLOCK_RUNTIME default;
+block normal XFILE_BLOCK_VIRTUAL default;
+
+use TestAsset;
+set block XFILE_BLOCK_TEMP;
+set string name;
+set scriptstring tag;
+set count elements elementCount;
+set reusable elements;
+
+use Element;
+set scriptstring tag;
+set string otherName;
+set assetref otherName ASSET_TYPE_OTHER;
+
+use OtherAsset;
+set block XFILE_BLOCK_TEMP;
+set string name;
+)";
+
+    void WriteFile(const fs::path& path, const char* content)
+    {
+        std::ofstream stream(path, std::ios::out | std::ios::binary);
+        stream << content;
+    }
+
+    std::string RenderTestAssetLoader()
+    {
+        const auto headerPath = oat::paths::GetTempDirectory() / "zone_load_template_test.h";
+        const auto commandsPath = oat::paths::GetTempDirectory() / "zone_load_template_test_commands.txt";
+        WriteFile(headerPath, TEST_HEADER);
+        WriteFile(commandsPath, TEST_COMMANDS);
+
+        const ZoneCodeGeneratorArguments args;
+        InMemoryRepository repository;
+        HeaderFileReader headerFileReader(&args, headerPath.string());
+        CommandsFileReader commandsFileReader(&args, commandsPath.string());
+        const auto readSuccessfully = headerFileReader.ReadHeaderFile(&repository) && commandsFileReader.ReadCommandsFile(&repository);
+
+        fs::remove(headerPath);
+        fs::remove(commandsPath);
+        REQUIRE(readSuccessfully);
+
+        const auto* assetDefinition = dynamic_cast<DefinitionWithMembers*>(repository.GetDataDefinitionByName("TestAsset"));
+        REQUIRE(assetDefinition);
+        auto* assetInformation = repository.GetInformationFor(assetDefinition);
+        REQUIRE(assetInformation);
+
+        const auto context = RenderingContext::BuildContext(&repository, assetInformation);
+        ZoneLoadTemplate zoneLoadTemplate;
+
+        std::ostringstream renderedCode;
+        for (const auto& file : zoneLoadTemplate.GetFilesToRender(*context))
+            zoneLoadTemplate.RenderFile(renderedCode, file.m_tag, *context);
+
+        return renderedCode.str();
+    }
+
+    size_t GetIndentation(const std::string& line)
+    {
+        const auto indentation = line.find_first_not_of(' ');
+        return indentation == std::string::npos ? line.size() : indentation;
+    }
+
+    bool IsInFullModeBlock(const std::vector<std::string>& lines, const size_t lineIndex)
+    {
+        const auto indentation = GetIndentation(lines[lineIndex]);
+        for (auto previousLineIndex = lineIndex; previousLineIndex > 0u; previousLineIndex--)
+        {
+            const auto& previousLine = lines[previousLineIndex - 1u];
+            const auto previousIndentation = GetIndentation(previousLine);
+            const auto previousStatement = std::string_view(previousLine).substr(previousIndentation);
+            if (previousIndentation >= indentation || previousStatement == "{")
+                continue;
+
+            return previousStatement.starts_with("if (m_mode == ZoneLoadingMode::FULL");
+        }
+
+        return false;
+    }
+
+    TEST_CASE("ZoneLoadTemplate: Only marks references when loading fully", "[zcg][templates]")
+    {
+        const auto renderedCode = RenderTestAssetLoader();
+
+        std::vector<std::string> lines;
+        std::istringstream renderedLines(renderedCode);
+        std::string line;
+        while (std::getline(renderedLines, line))
+            lines.emplace_back(std::move(line));
+
+        auto markCallCount = 0u;
+        for (auto lineIndex = 0u; lineIndex < lines.size(); lineIndex++)
+        {
+            if (lines[lineIndex].find("m_marker.Mark") == std::string::npos)
+                continue;
+
+            INFO(lines[lineIndex]);
+            REQUIRE(IsInFullModeBlock(lines, lineIndex));
+            markCallCount++;
+        }
+
+        // The script strings of the asset and its elements, the asset ref of the elements and the reused elements
+        REQUIRE(markCallCount >= 4u);
+    }
+} // namespace test::generating::templates::zone_load_template
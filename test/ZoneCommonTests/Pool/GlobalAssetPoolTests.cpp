@@ -0,0 +1,95 @@
+#include "Pool/AssetPoolDynamic.h"
+#include "Pool/GlobalAssetPool.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace test::pool::global_asset_pool
+{
+    template<int Id> struct TestAsset
+    {
+        int m_value;
+    };
+
+    template<typename T> XAssetInfo<T>* AddTestAsset(AssetPoolDynamic<T>& pool, T& asset, std::string name)
+    {
+        return pool.AddAsset(std::make_unique<XAssetInfo<T>>(0, std::move(name), &asset));
+    }
+
+    TEST_CASE("GlobalAssetPool: Pools of isolated threads are not visible to other threads", "[pool]")
+    {
+        using asset_t = TestAsset<0>;
+
+        AssetPoolDynamic<asset_t> sharedPool(0);
+        asset_t sharedAsset{1};
+        auto* sharedAssetInfo = AddTestAsset(sharedPool, sharedAsset, "shared");
+
+        // Threads only record what they found, the assertions happen after joining them
+        XAssetInfo<asset_t>* foundSharedAsset = nullptr;
+        auto foundIsolatedAssetValue = 0;
+        auto foundIsolatedAssetAfterOtherThread = false;
+        auto otherThreadFoundIsolatedAsset = true;
+        std::thread isolatedThread(
+            [&]
+            {
+                const GlobalAssetPoolThreadIsolation isolation;
+                AssetPoolDynamic<asset_t> isolatedPool(0);
+                asset_t isolatedAsset{2};
+                AddTestAsset(isolatedPool, isolatedAsset, "isolated");
+
+                foundSharedAsset = GlobalAssetPool<asset_t>::GetAssetByName("shared");
+                const auto* foundIsolatedAsset = GlobalAssetPool<asset_t>::GetAssetByName("isolated");
+                if (foundIsolatedAsset)
+                    foundIsolatedAssetValue = foundIsolatedAsset->Asset()->m_value;
+
+                std::thread otherIsolatedThread(
+                    [&]
+                    {
+                        const GlobalAssetPoolThreadIsolation otherIsolation;
+                        otherThreadFoundIsolatedAsset = GlobalAssetPool<asset_t>::GetAssetByName("isolated") != nullptr;
+                    });
+                otherIsolatedThread.join();
+
+                foundIsolatedAssetAfterOtherThread = GlobalAssetPool<asset_t>::GetAssetByName("isolated") != nullptr;
+            });
+        isolatedThread.join();
+
+        REQUIRE(foundSharedAsset == sharedAssetInfo);
+        REQUIRE(foundIsolatedAssetValue == 2);
+        REQUIRE(!otherThreadFoundIsolatedAsset);
+        REQUIRE(foundIsolatedAssetAfterOtherThread);
+        REQUIRE(GlobalAssetPool<asset_t>::GetAssetByName("isolated") == nullptr);
+    }
+
+    TEST_CASE("GlobalAssetPool: Shared pools take precedence over isolated pools with the same priority", "[pool]")
+    {
+        using asset_t = TestAsset<1>;
+
+        AssetPoolDynamic<asset_t> sharedPool(0);
+        asset_t sharedAsset{1};
+        auto* sharedAssetInfo = AddTestAsset(sharedPool, sharedAsset, "asset");
+
+        XAssetInfo<asset_t>* foundAsset = nullptr;
+        auto foundHigherPriorityAsset = false;
+        std::thread isolatedThread(
+            [&]
+            {
+                const GlobalAssetPoolThreadIsolation isolation;
+                AssetPoolDynamic<asset_t> isolatedPool(0);
+                asset_t isolatedAsset{2};
+                AddTestAsset(isolatedPool, isolatedAsset, "asset");
+                foundAsset = GlobalAssetPool<asset_t>::GetAssetByName("asset");
+
+                AssetPoolDynamic<asset_t> higherPriorityPool(1);
+                asset_t higherPriorityAsset{3};
+                const auto* higherPriorityAssetInfo = AddTestAsset(higherPriorityPool, higherPriorityAsset, "asset");
+                foundHigherPriorityAsset = GlobalAssetPool<asset_t>::GetAssetByName("asset") == higherPriorityAssetInfo;
+            });
+        isolatedThread.join();
+
+        REQUIRE(foundAsset == sharedAssetInfo);
+        REQUIRE(foundHigherPriorityAsset);
+    }
+} // namespace test::pool::global_asset_pool
@@ -0,0 +1,70 @@
+#include "OatTestPaths.h"
+#include "ZoneLoading.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // Stock zones cannot be distributed with the tests, so the zone to measure is taken from an environment variable
+    void BenchmarkZoneLoad(const char* zonePathVariable)
+    {
+        const auto* zonePath = std::getenv(zonePathVariable);
+        if (zonePath == nullptr || zonePath[0] == '\0')
+        {
+            WARN(std::format("Set {} to the path of a zone to load", zonePathVariable));
+            return;
+        }
+
+        REQUIRE(fs::is_regular_file(zonePath));
+
+        const auto measureLoad = [zonePath](const ZoneLoadingMode mode)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            const auto zone = ZoneLoading::LoadZone(zonePath, mode);
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+            REQUIRE(zone);
+
+            std::cout << std::format("Loaded {} assets of zone '{}' in {:.3f}s ({})\n",
+                                     zone->m_pools->GetTotalAssetCount(),
+                                     zone->m_name,
+                                     duration.count(),
+                                     mode == ZoneLoadingMode::FULL ? "full" : "header scan");
+
+            return duration;
+        };
+
+        const auto headerScanDuration = measureLoad(ZoneLoadingMode::HEADER_SCAN);
+        const auto fullDuration = measureLoad(ZoneLoadingMode::FULL);
+
+        // Header scans still stream all asset data, so this only shows what skipping marking and custom loading actions gains
+        std::cout << std::format("Header scan took {:.1f}% of the time of a full load\n", headerScanDuration / fullDuration * 100.0);
+    }
+} // namespace
+
+namespace test::zone_loading
+{
+    TEST_CASE("ZoneLoading: Does not load zone that does not exist", "[zone]")
+    {
+        const auto zonePath = oat::paths::GetTempDirectory() / "zone_that_does_not_exist.ff";
+
+        REQUIRE(!ZoneLoading::LoadZone(zonePath.string()));
+    }
+
+    TEST_CASE("ZoneLoading: Load time of largest IW4 zone", "[.][benchmark][zone]")
+    {
+        BenchmarkZoneLoad("OAT_BENCHMARK_ZONE_IW4");
+    }
+
+    TEST_CASE("ZoneLoading: Load time of largest T6 zone", "[.][benchmark][zone]")
+    {
+        BenchmarkZoneLoad("OAT_BENCHMARK_ZONE_T6");
+    }
+} // namespace test::zone_loading